@@ -0,0 +1,505 @@
+///
+/// @file OutOfSSA.cpp
+/// @brief 消除Phi指令，把SSA形式的IR转换为普通IR
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <iterator>
+
+#include "OutOfSSA.h"
+#include "DominatorTree.h"
+#include "CondBrInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 要处理的函数
+/// @param _scratch 打破并行复制环所用的临时寄存器
+///
+OutOfSSA::OutOfSSA(Function * _func, Value * _scratch) : func(_func), scratch(_scratch), liveness(_func, false)
+{}
+
+///
+/// @brief 执行Phi指令的消除
+/// @return true 函数被修改，false 没有Phi指令
+///
+bool OutOfSSA::run()
+{
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            phis.push_back(static_cast<PhiInstruction *>(inst));
+        }
+    }
+
+    if (phis.empty()) {
+        return false;
+    }
+
+    // 需要知道前驱基本块
+    func->buildCFG();
+
+    splitEdges();
+
+    computeLiveness();
+
+    coalesce();
+
+    insertCopies();
+
+    removeEmptySplits();
+
+    return true;
+}
+
+///
+/// @brief 获取合并后的值所共用的局部变量
+/// @param val 值
+/// @return LocalVariable* 共用的局部变量，没有被合并时返回nullptr
+///
+LocalVariable * OutOfSSA::getCoalescedVar(Value * val)
+{
+    auto iter = coalescedVars.find(val);
+    return iter == coalescedVars.end() ? nullptr : iter->second;
+}
+
+///
+/// @brief 拆分以条件跳转进入含Phi指令的基本块的控制流边。新的基本块放在原基本块之前，
+/// 回边的紧邻原基本块，布局上的前一个基本块的次之；前一个基本块顺序进入原基本块时，
+/// 其余的新基本块放到函数末尾，如旋转后的循环latch经出口的复制顺序离开循环
+///
+void OutOfSSA::splitEdges()
+{
+    std::vector<BasicBlock *> layout;
+    std::vector<BasicBlock *> tail;
+    BasicBlock * layoutPred = nullptr;
+    bool changed = false;
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        std::vector<PhiInstruction *> bbPhis;
+        for (auto inst: bb->getInsts()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                bbPhis.push_back(static_cast<PhiInstruction *>(inst));
+            } else if (inst != bb->getLabel()) {
+                break;
+            }
+        }
+
+        bool fallsIn = false;
+        BasicBlock * backMid = nullptr;
+        BasicBlock * predMid = nullptr;
+        std::vector<BasicBlock *> mids;
+
+        if (!bbPhis.empty()) {
+
+            for (auto pred: bb->getPredecessors()) {
+
+                if (pred == layoutPred) {
+                    fallsIn = true;
+                }
+
+                Instruction * term = pred->getTerminator();
+                if (term->getOp() != IRInstOperator::IRINST_OP_COND_BR) {
+                    continue;
+                }
+
+                // 新的基本块只含有跳转到原基本块的指令，紧邻原基本块时指令选择可直接顺序执行
+                LabelInstruction * label = func->newInst<LabelInstruction>();
+                func->getInterCode().getInsts().insert(bb->begin(), label);
+                BasicBlock * mid = new BasicBlock(func, label);
+                mid->addInst(func->newInst<GotoInstruction>(bb->getLabel()));
+
+                auto condBrInst = static_cast<CondBrInstruction *>(term);
+                if (condBrInst->getTrueTarget() == bb->getLabel()) {
+                    condBrInst->setTrueTarget(label);
+                }
+                if (condBrInst->getFalseTarget() == bb->getLabel()) {
+                    condBrInst->setFalseTarget(label);
+                }
+                splits.emplace_back(condBrInst, label);
+
+                for (auto phi: bbPhis) {
+                    for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+                        if (phi->getIncomingBlock(k) == pred) {
+                            phi->setIncomingBlock(k, mid);
+                        }
+                    }
+                }
+
+                if (pred == layoutPred) {
+                    predMid = mid;
+                } else if (!backMid && pred->getIndex() >= bb->getIndex()) {
+                    backMid = mid;
+                } else {
+                    mids.push_back(mid);
+                }
+                changed = true;
+            }
+        }
+
+        // 每次迭代经过的回边与前一个基本块都尽量顺序执行
+        if (fallsIn) {
+            tail.insert(tail.end(), mids.begin(), mids.end());
+        } else {
+            layout.insert(layout.end(), mids.begin(), mids.end());
+        }
+
+        if (predMid) {
+            layout.push_back(predMid);
+        }
+
+        if (backMid) {
+            layout.push_back(backMid);
+        }
+
+        layout.push_back(bb);
+        layoutPred = bb;
+    }
+
+    if (changed) {
+        layout.insert(layout.end(), tail.begin(), tail.end());
+        func->getBasicBlocks() = layout;
+        func->linearizeCFG();
+        func->buildCFG();
+    }
+}
+
+///
+/// @brief 按SSA模式计算活跃变量，得到有值的指令的编号与每个基本块出口处活跃的值
+///
+void OutOfSSA::computeLiveness()
+{
+    liveness.run();
+}
+
+///
+/// @brief 合并Phi指令与其来源值的等价类
+///
+void OutOfSSA::coalesce()
+{
+    size_t valueNum = (size_t) liveness.getValueNum();
+
+    classParent.resize(valueNum);
+    classMembers.resize(valueNum);
+    for (size_t v = 0; v < valueNum; ++v) {
+        classParent[v] = (int32_t) v;
+        classMembers[v].push_back((int32_t) v);
+    }
+
+    for (auto phi: phis) {
+
+        int32_t phiNo = getValueNo(phi);
+
+        for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+
+            int32_t argNo = getValueNo(phi->getIncomingValue(k));
+            if (argNo == -1 || getValueInst(argNo)->getType() != phi->getType()) {
+                continue;
+            }
+
+            int32_t phiClass = findClass(phiNo);
+            int32_t argClass = findClass(argNo);
+            if (phiClass == argClass) {
+                continue;
+            }
+
+            // 两个等价类的成员两两之间都不冲突时才能合并
+            bool conflict = false;
+            for (auto a: classMembers[phiClass]) {
+                for (auto b: classMembers[argClass]) {
+                    if (interfere(a, b)) {
+                        conflict = true;
+                        break;
+                    }
+                }
+                if (conflict) {
+                    break;
+                }
+            }
+
+            if (conflict) {
+                continue;
+            }
+
+            classParent[argClass] = phiClass;
+            classMembers[phiClass].insert(classMembers[phiClass].end(),
+                                          classMembers[argClass].begin(),
+                                          classMembers[argClass].end());
+            classMembers[argClass].clear();
+        }
+    }
+
+    // 每个含有Phi指令的等价类引入一个局部变量作为共用的存储空间
+    for (auto phi: phis) {
+
+        int32_t phiClass = findClass(getValueNo(phi));
+        if (coalescedVars.count(getValueInst(phiClass))) {
+            continue;
+        }
+
+        LocalVariable * var = func->newLocalVarValue(phi->getType());
+        for (auto member: classMembers[phiClass]) {
+            coalescedVars[getValueInst(member)] = var;
+        }
+    }
+}
+
+///
+/// @brief 在前驱基本块末尾插入复制指令，并删除Phi指令
+///
+void OutOfSSA::insertCopies()
+{
+    // 每个前驱基本块末尾的并行复制
+    std::unordered_map<BasicBlock *, std::vector<std::pair<Value *, Value *>>> blockCopies;
+    std::vector<BasicBlock *> copyBlocks;
+
+    for (auto phi: phis) {
+
+        Value * dst = coalescedVars[phi];
+
+        for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+
+            Value * src = getStorage(phi->getIncomingValue(k));
+            if (src == dst) {
+                // 同一等价类，不需要复制
+                continue;
+            }
+
+            BasicBlock * pred = phi->getIncomingBlock(k);
+            auto & copies = blockCopies[pred];
+            if (copies.empty()) {
+                copyBlocks.push_back(pred);
+            }
+            copies.emplace_back(dst, src);
+        }
+    }
+
+    for (auto pred: copyBlocks) {
+
+        std::vector<Instruction *> moveInsts;
+        sequentialize(blockCopies[pred], moveInsts);
+
+        // 插入到前驱基本块的跳转指令之前，前面已保证该跳转指令是无条件跳转
+        auto termIter = pred->getIterator(pred->getTerminator());
+        for (auto moveInst: moveInsts) {
+            pred->insert(termIter, moveInst);
+        }
+    }
+
+    // Phi指令的使用改为使用共用的局部变量
+    for (auto phi: phis) {
+        phi->replaceAllUsesWith(coalescedVars[phi]);
+    }
+
+    for (auto phi: phis) {
+        phi->getParent()->erase(phi);
+
+        coalescedVars.erase(phi);
+        phi->clearOperands();
+    }
+}
+
+///
+/// @brief 删除没有复制指令的拆分基本块，条件跳转改回原来的目标
+///
+void OutOfSSA::removeEmptySplits()
+{
+    std::vector<Instruction *> deadInsts;
+
+    for (auto & split: splits) {
+
+        CondBrInstruction * condBrInst = split.first;
+        LabelInstruction * label = split.second;
+        BasicBlock * mid = label->getParent();
+
+        Instruction * term = mid->getTerminator();
+        if (std::next(mid->begin()) != mid->getIterator(term)) {
+            continue;
+        }
+
+        LabelInstruction * target = static_cast<GotoInstruction *>(term)->getTarget();
+        if (condBrInst->getTrueTarget() == label) {
+            condBrInst->setTrueTarget(target);
+        }
+        if (condBrInst->getFalseTarget() == label) {
+            condBrInst->setFalseTarget(target);
+        }
+
+        deadInsts.push_back(term);
+        deadInsts.push_back(label);
+    }
+
+    if (deadInsts.empty()) {
+        return;
+    }
+
+    // 跳转与Label都没有操作数，先释放基本块，再直接从线性IR中移除
+    func->clearCFG();
+    for (auto inst: deadInsts) {
+        func->getInterCode().getInsts().remove(inst);
+    }
+
+    func->buildCFG();
+}
+
+///
+/// @brief 并行复制串行化
+/// @param copies 并行复制，每项为(目的, 源)，目的互不相同
+/// @param insts 串行化后的Move指令
+///
+void OutOfSSA::sequentialize(std::vector<std::pair<Value *, Value *>> & copies, std::vector<Instruction *> & insts)
+{
+    while (!copies.empty()) {
+
+        // 目的不再被其它复制读取的复制可以先执行
+        bool progress = false;
+        for (size_t k = 0; k < copies.size(); ++k) {
+
+            Value * dst = copies[k].first;
+            bool isSource = std::any_of(copies.begin(), copies.end(), [dst](const std::pair<Value *, Value *> & copy) {
+                return copy.second == dst;
+            });
+
+            if (!isSource) {
+                insts.push_back(func->newInst<MoveInstruction>(dst, copies[k].second));
+                copies.erase(copies.begin() + (int32_t) k);
+                progress = true;
+                break;
+            }
+        }
+
+        if (progress) {
+            continue;
+        }
+
+        // 剩下的复制都在环上，把一个目的的旧值暂存到临时寄存器，环即被打破。
+        // 该环的复制全部完成后才会再次出现环，因此临时寄存器只需一个
+        Value * dst = copies.front().first;
+        insts.push_back(func->newInst<MoveInstruction>(scratch, dst));
+        for (auto & copy: copies) {
+            if (copy.second == dst) {
+                copy.second = scratch;
+            }
+        }
+    }
+}
+
+///
+/// @brief 判断两个值的活跃范围是否冲突
+/// @param a 值编号
+/// @param b 值编号
+/// @return true 冲突
+///
+bool OutOfSSA::interfere(int32_t a, int32_t b)
+{
+    Instruction * instA = getValueInst(a);
+    Instruction * instB = getValueInst(b);
+    BasicBlock * bbA = instA->getParent();
+    BasicBlock * bbB = instB->getParent();
+
+    if (bbA == bbB) {
+
+        // 同一基本块的Phi指令同时定值，保守认为冲突
+        if ((instA->getOp() == IRInstOperator::IRINST_OP_PHI) && (instB->getOp() == IRInstOperator::IRINST_OP_PHI)) {
+            return true;
+        }
+
+        return liveness.getPosition(instA) < liveness.getPosition(instB) ? liveAfter(a, b) : liveAfter(b, a);
+    }
+
+    // SSA形式下活跃范围相交的两个值，其中一个的定值必定支配另一个的定值
+    DominatorTree * domTree = func->getDominatorTree();
+    if (domTree->dominates(bbA, bbB)) {
+        return liveAfter(a, b);
+    }
+    if (domTree->dominates(bbB, bbA)) {
+        return liveAfter(b, a);
+    }
+
+    return false;
+}
+
+///
+/// @brief 判断值x在值y定值之后是否活跃，x的定值支配y的定值
+/// @param x 值编号
+/// @param y 值编号
+/// @return true 活跃
+///
+bool OutOfSSA::liveAfter(int32_t x, int32_t y)
+{
+    BasicBlock * bb = getValueInst(y)->getParent();
+
+    if (liveness.getLiveOut(bb).test(x)) {
+        return true;
+    }
+
+    // 检查基本块内y之后是否还有x的使用，Phi指令的使用在前驱基本块出口，已包含在出口活跃中
+    int32_t pos = liveness.getPosition(getValueInst(y));
+    for (auto use: getValueInst(x)->getUses()) {
+        auto user = static_cast<Instruction *>(use->getUser());
+        if ((user->getParent() == bb) && (user->getOp() != IRInstOperator::IRINST_OP_PHI) &&
+            (liveness.getPosition(user) > pos)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief 获取值的编号
+/// @param val 值
+/// @return int32_t 编号，不是有值的指令时返回-1
+///
+int32_t OutOfSSA::getValueNo(Value * val)
+{
+    return liveness.getValueNo(val);
+}
+
+///
+/// @brief 获取编号对应的指令
+/// @param no 值编号
+/// @return Instruction* 指令
+///
+Instruction * OutOfSSA::getValueInst(int32_t no)
+{
+    return static_cast<Instruction *>(liveness.getValue(no));
+}
+
+///
+/// @brief 查找等价类的代表
+/// @param no 值编号
+/// @return int32_t 代表的编号
+///
+int32_t OutOfSSA::findClass(int32_t no)
+{
+    while (classParent[no] != no) {
+        classParent[no] = classParent[classParent[no]];
+        no = classParent[no];
+    }
+
+    return no;
+}
+
+///
+/// @brief 获取值实际的存储位置，被合并的值为共用的局部变量
+/// @param val 值
+/// @return Value* 存储位置
+///
+Value * OutOfSSA::getStorage(Value * val)
+{
+    LocalVariable * var = getCoalescedVar(val);
+    return var ? var : val;
+}
@@ -0,0 +1,180 @@
+///
+/// @file OutOfSSA.h
+/// @brief 消除Phi指令，把SSA形式的IR转换为普通IR
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Function.h"
+#include "Liveness.h"
+#include "PhiInstruction.h"
+
+class CondBrInstruction;
+class LabelInstruction;
+
+///
+/// @brief 消除Phi指令。步骤如下：
+/// (1) 以条件跳转结束的前驱基本块到含Phi指令的基本块之间的边进行拆分，关键边都在其中，
+///     这样复制指令总是插入在以无条件跳转结束的基本块末尾；
+/// (2) 计算活跃变量，Phi指令与其来源值在活跃范围不冲突时合并为同一个等价类，
+///     同一等价类的值共用一个局部变量的存储空间，它们之间不需要复制；
+/// (3) 剩余的来源值在前驱基本块末尾进行并行复制，并行复制按依赖关系串行化，
+///     出现环时借助临时寄存器打破；
+/// (4) 拆分出的基本块没有复制指令时删除，条件跳转恢复为直接跳到原基本块。
+///
+class OutOfSSA {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 要处理的函数
+    /// @param _scratch 打破并行复制环所用的临时寄存器
+    ///
+    OutOfSSA(Function * _func, Value * _scratch);
+
+    ///
+    /// @brief 执行Phi指令的消除
+    /// @return true 函数被修改，false 没有Phi指令
+    ///
+    bool run();
+
+    ///
+    /// @brief 获取合并后的值所共用的局部变量
+    /// @param val 值
+    /// @return LocalVariable* 共用的局部变量，没有被合并时返回nullptr
+    ///
+    LocalVariable * getCoalescedVar(Value * val);
+
+protected:
+    ///
+    /// @brief 拆分以条件跳转进入含Phi指令的基本块的控制流边
+    ///
+    void splitEdges();
+
+    ///
+    /// @brief 按SSA模式计算活跃变量，得到有值的指令的编号与每个基本块出口处活跃的值
+    ///
+    void computeLiveness();
+
+    ///
+    /// @brief 合并Phi指令与其来源值的等价类
+    ///
+    void coalesce();
+
+    ///
+    /// @brief 在前驱基本块末尾插入复制指令，并删除Phi指令
+    ///
+    void insertCopies();
+
+    ///
+    /// @brief 删除没有复制指令的拆分基本块，条件跳转改回原来的目标
+    ///
+    void removeEmptySplits();
+
+    ///
+    /// @brief 并行复制串行化
+    /// @param copies 并行复制，每项为(目的, 源)，目的互不相同
+    /// @param insts 串行化后的Move指令
+    ///
+    void sequentialize(std::vector<std::pair<Value *, Value *>> & copies, std::vector<Instruction *> & insts);
+
+    ///
+    /// @brief 判断两个值的活跃范围是否冲突
+    /// @param a 值编号
+    /// @param b 值编号
+    /// @return true 冲突
+    ///
+    bool interfere(int32_t a, int32_t b);
+
+    ///
+    /// @brief 判断值x在值y定值之后是否活跃，x的定值支配y的定值
+    /// @param x 值编号
+    /// @param y 值编号
+    /// @return true 活跃
+    ///
+    bool liveAfter(int32_t x, int32_t y);
+
+    ///
+    /// @brief 获取值的编号
+    /// @param val 值
+    /// @return int32_t 编号，不是有值的指令时返回-1
+    ///
+    int32_t getValueNo(Value * val);
+
+    ///
+    /// @brief 获取编号对应的指令
+    /// @param no 值编号
+    /// @return Instruction* 指令
+    ///
+    Instruction * getValueInst(int32_t no);
+
+    ///
+    /// @brief 查找等价类的代表
+    /// @param no 值编号
+    /// @return int32_t 代表的编号
+    ///
+    int32_t findClass(int32_t no);
+
+    ///
+    /// @brief 获取值实际的存储位置，被合并的值为共用的局部变量
+    /// @param val 值
+    /// @return Value* 存储位置
+    ///
+    Value * getStorage(Value * val);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 打破并行复制环所用的临时寄存器
+    ///
+    Value * scratch;
+
+    ///
+    /// @brief 函数内的Phi指令
+    ///
+    std::vector<PhiInstruction *> phis;
+
+    ///
+    /// @brief 被拆分的边，每项为(前驱的条件跳转, 拆分出的基本块的Label)
+    ///
+    std::vector<std::pair<CondBrInstruction *, LabelInstruction *>> splits;
+
+    ///
+    /// @brief SSA模式的活跃变量分析，同时给出有值的指令的稠密编号与线性位置
+    ///
+    Liveness liveness;
+
+    ///
+    /// @brief 等价类的并查集
+    ///
+    std::vector<int32_t> classParent;
+
+    ///
+    /// @brief 等价类的成员，只对代表有效
+    ///
+    std::vector<std::vector<int32_t>> classMembers;
+
+    ///
+    /// @brief 含有Phi指令的等价类中的值所共用的局部变量
+    ///
+    std::unordered_map<Value *, LocalVariable *> coalescedVars;
+};
@@ -13,9 +13,14 @@
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// </table>
 ///
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <functional>
+#include <queue>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 
@@ -30,6 +35,8 @@
 #include "FuncCallInstruction.h"
 #include "ArgInstruction.h"
 #include "MoveInstruction.h"
+#include "Liveness.h"
+#include "LoopInfo.h"
 
 /// @brief 构造函数
 /// @param tab 符号表
@@ -117,8 +124,11 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
     // 寄存器分配以及栈内局部变量的站内地址重新分配
     registerAllocation(func);
 
+    // 寄存器分配阶段可能插入了新的指令，重新划分基本块，指令选择时需要知道基本块的布局
+    func->buildCFG();
+
     // 获取函数的指令列表
-    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+    InstList & IrInsts = func->getInterCode().getInsts();
 
     // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
     for (auto inst: IrInsts) {
@@ -133,8 +143,18 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
     // 指令选择生成汇编指令
     InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
     instSelector.setShowLinearIR(this->showLinearIR);
+
+    // 可指派给变量的寄存器不能被指令选择临时借用
+    for (int32_t regNo = ARM32_ALLOC_FIRST_REG_NO; regNo <= ARM32_ALLOC_LAST_REG_NO; ++regNo) {
+        simpleRegisterAllocator.Allocate(regNo);
+    }
+
     instSelector.run();
 
+    for (int32_t regNo = ARM32_ALLOC_FIRST_REG_NO; regNo <= ARM32_ALLOC_LAST_REG_NO; ++regNo) {
+        simpleRegisterAllocator.free(regNo);
+    }
+
     // 删除无用的Label指令
     iloc.deleteUnusedLabel();
 
@@ -194,6 +214,10 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
     //  (2) LX寄存器用于函数调用，即R14。没有函数调用的函数可不用保护lx寄存器
     //  (3) R10寄存器用于立即数过大时要通过寄存器寻址，这里简化处理进行预留
 
+    // 指令选择不支持Phi指令，先消除Phi指令，尽量合并Phi指令与其来源值以减少复制
+    OutOfSSA outOfSSA(func, PlatformArm32::intRegVal[ARM32_SCRATCH_REG_NO]);
+    outOfSSA.run();
+
     // 至少有FP和LX寄存器需要保护
     std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
     protectedRegNo.clear();
@@ -208,8 +232,17 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
     // 当然也可以不做处理，不过性能更差。这个处理是可选的。
     adjustFuncCallInsts(func);
 
+    // 上面在基本块内插入了指令，重新划分基本块后按变量模式计算活跃区间，Move指令的目的操作数视为定值
+    func->buildCFG();
+
+    Liveness liveness(func, true);
+    liveness.run();
+
+    // 按循环嵌套深度加权的溢出代价，为频繁使用的变量指派被调用者保存的寄存器
+    assignRegisters(func, outOfSSA, liveness);
+
     // 为局部变量和临时变量在栈内分配空间，指定偏移，进行栈空间的分配
-    stackAlloc(func);
+    stackAlloc(func, outOfSSA, liveness);
 
     // 函数形参要求前四个寄存器分配，后面的参数采用栈传递，实现实参的值传递给形参
     // 这一步是必须的
@@ -292,15 +325,13 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 esp += 4;
 
                 // 引入赋值指令，把实参的值保存到内存变量上
-                Instruction * assignInst = new MoveInstruction(func, newVal, arg);
+                Instruction * assignInst = func->newInst<MoveInstruction>(newVal, arg);
 
                 // 更换实参变量为内存变量
                 callInst->setOperand(k, newVal);
 
-                // 赋值指令插入到函数调用指令的前面
-                // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
+                // 赋值指令插入到函数调用指令的前面，链表插入后pIter仍指向函数调用指令
+                insts.insert(pIter, assignInst);
             }
 
             // ARM32的函数调用约定，前四个参数通过寄存器传递
@@ -310,13 +341,12 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
 
                 auto arg = callInst->getOperand(k);
 
-                Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
+                Instruction * assignInst = func->newInst<MoveInstruction>(PlatformArm32::intRegVal[k], arg);
 
                 callInst->setOperand(k, PlatformArm32::intRegVal[k]);
 
                 // 函数调用指令前插入后，pIter仍指向函数调用指令
-                pIter = insts.insert(pIter, assignInst);
-                pIter++;
+                insts.insert(pIter, assignInst);
             }
 
 #if 0
@@ -325,8 +355,7 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 auto arg = callInst->getOperand(k);
 
                 // 产生ARG指令
-                pIter = insts.insert(pIter, new ArgInstruction(func, arg));
-                pIter++;
+                insts.insert(pIter, func->newInst<ArgInstruction>(arg));
             }
 #endif
 
@@ -342,19 +371,177 @@ void CodeGeneratorArm32::adjustFuncCallInsts(Function * func)
                 } else {
                     // 其它情况，需要产生赋值指令
                     // 新建一个赋值操作
-                    Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
+                    Instruction * assignInst = func->newInst<MoveInstruction>(callInst, PlatformArm32::intRegVal[0]);
 
                     // 函数调用指令的下一个指令的前面插入指令，因为有Exit指令，+1肯定有效
-                    pIter = insts.insert(pIter + 1, assignInst);
+                    pIter = insts.insert(std::next(pIter), assignInst);
+                }
+            }
+        }
+    }
+}
+
+/// @brief 按溢出代价为局部变量和临时变量指派寄存器
+/// @param func 要处理的函数
+/// @param outOfSSA Phi指令消除的结果，被合并的值共用存储空间，也共用寄存器
+/// @param liveness 变量模式的活跃变量分析
+void CodeGeneratorArm32::assignRegisters(Function * func, OutOfSSA & outOfSSA, Liveness & liveness)
+{
+    // 分配单元：共用存储空间的一组值，活跃区间取各值活跃区间的包络
+    struct AllocUnit {
+        std::vector<Value *> values;
+        LiveRange range;
+        int64_t cost = 0;
+        int32_t regId = -1;
+    };
+
+    std::vector<AllocUnit> units;
+    std::unordered_map<Value *, int32_t> unitNos;
+
+    // 还没有指派寄存器或栈空间的局部变量，含Phi指令消除时引入的共用局部变量。
+    // 在入口处活跃的变量存在未赋值就读取的路径，仍保存在栈中，保持原来的行为
+    BasicBlock * entryBlock = func->getBasicBlocks().front();
+    for (auto var: func->getVarValues()) {
+        if ((var->getRegId() == -1) && (!var->getMemoryAddr()) && !liveness.isLiveIn(entryBlock, var)) {
+            unitNos[var] = (int32_t) units.size();
+            units.emplace_back();
+            units.back().values.push_back(var);
+        }
+    }
+
+    // 临时变量，与Phi指令合并的值加入共用局部变量的分配单元
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (!inst->hasResultValue() || (inst->getRegId() != -1)) {
+            continue;
+        }
+
+        LocalVariable * coalescedVar = outOfSSA.getCoalescedVar(inst);
+        auto iter = coalescedVar ? unitNos.find(coalescedVar) : unitNos.end();
+        if (iter != unitNos.end()) {
+            unitNos[inst] = iter->second;
+            units[iter->second].values.push_back(inst);
+        } else if (!coalescedVar) {
+            unitNos[inst] = (int32_t) units.size();
+            units.emplace_back();
+            units.back().values.push_back(inst);
+        }
+    }
+
+    for (auto & unit: units) {
+        for (auto val: unit.values) {
+            LiveRange range = liveness.getLiveRange(val);
+            if (!range.empty()) {
+                unit.range.extend(range.start);
+                unit.range.extend(range.end);
+            }
+        }
+    }
+
+    // 溢出代价：每次定值或使用都需要一次访存，按所在基本块的循环嵌套深度加权，每深一层乘以10
+    LoopInfo * loopInfo = func->getLoopInfo();
+    for (auto bb: func->getBasicBlocks()) {
+
+        int64_t weight = 1;
+        for (int32_t depth = std::min(loopInfo->getLoopDepth(bb), 6); depth > 0; --depth) {
+            weight *= 10;
+        }
+
+        for (auto inst: bb->getInsts()) {
+
+            for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                auto iter = unitNos.find(inst->getOperand(k));
+                if (iter != unitNos.end()) {
+                    units[iter->second].cost += weight;
                 }
             }
+
+            auto iter = unitNos.find(inst);
+            if (iter != unitNos.end()) {
+                units[iter->second].cost += weight;
+            }
+        }
+    }
+
+    // 线性扫描：按活跃区间的起始位置处理，寄存器不够时溢出代价最小的分配单元
+    std::vector<int32_t> order;
+    for (int32_t k = 0; k < (int32_t) units.size(); ++k) {
+        if (!units[k].range.empty()) {
+            order.push_back(k);
+        }
+    }
+
+    std::stable_sort(order.begin(), order.end(), [&units](int32_t a, int32_t b) {
+        return units[a].range.start < units[b].range.start;
+    });
+
+    // 空闲寄存器，从后面取出时编号小的优先
+    std::vector<int32_t> freeRegs;
+    for (int32_t regNo = ARM32_ALLOC_LAST_REG_NO; regNo >= ARM32_ALLOC_FIRST_REG_NO; --regNo) {
+        freeRegs.push_back(regNo);
+    }
+
+    // 当前占有寄存器的分配单元
+    std::vector<int32_t> active;
+
+    for (auto no: order) {
+
+        AllocUnit & unit = units[no];
+
+        // 活跃区间已经结束的分配单元释放寄存器
+        for (auto iter = active.begin(); iter != active.end();) {
+            if (units[*iter].range.end < unit.range.start) {
+                freeRegs.push_back(units[*iter].regId);
+                iter = active.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+
+        if (!freeRegs.empty()) {
+            unit.regId = freeRegs.back();
+            freeRegs.pop_back();
+            active.push_back(no);
+            continue;
+        }
+
+        // 没有空闲寄存器，溢出代价最小者放弃寄存器
+        auto victim = std::min_element(active.begin(), active.end(), [&units](int32_t a, int32_t b) {
+            return units[a].cost < units[b].cost;
+        });
+
+        if ((victim != active.end()) && (units[*victim].cost < unit.cost)) {
+            unit.regId = units[*victim].regId;
+            units[*victim].regId = -1;
+            *victim = no;
         }
     }
+
+    // 指派寄存器，用到的被调用者保存的寄存器需要保护，保护寄存器按编号升序排列
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    for (auto & unit: units) {
+
+        if (unit.regId == -1) {
+            continue;
+        }
+
+        for (auto val: unit.values) {
+            val->setRegId(unit.regId);
+        }
+
+        if (std::find(protectedRegNo.begin(), protectedRegNo.end(), unit.regId) == protectedRegNo.end()) {
+            protectedRegNo.push_back(unit.regId);
+        }
+    }
+
+    std::sort(protectedRegNo.begin(), protectedRegNo.end());
 }
 
 /// @brief 栈空间分配
 /// @param func 要处理的函数
-void CodeGeneratorArm32::stackAlloc(Function * func)
+/// @param outOfSSA Phi指令消除的结果，被合并的值共用存储空间
+/// @param liveness 变量模式的活跃变量分析
+void CodeGeneratorArm32::stackAlloc(Function * func, OutOfSSA & outOfSSA, Liveness & liveness)
 {
     // 栈内分配的空间除了寄存器保护所分配的空间之外，还需要管理如下的空间
     // (1) 没有指派寄存器的局部变量、形参或临时变量的栈内分配
@@ -408,28 +595,77 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
         }
     }
 
-    // 遍历包含有值的指令，也就是临时变量
+    // 遍历包含有值的指令，也就是临时变量，按活跃区间共用栈空间
+    std::vector<std::pair<LiveRange, Instruction *>> temps;
     for (auto inst: func->getInterCode().getInsts()) {
 
         if (inst->hasResultValue() && (inst->getRegId() == -1)) {
             // 有值，并且没有分配寄存器
 
-            int32_t size = inst->getType()->getSize();
+            // 与Phi指令合并的值，使用共用局部变量的存储空间
+            LocalVariable * coalescedVar = outOfSSA.getCoalescedVar(inst);
+            if (coalescedVar) {
+                int32_t baseRegId;
+                int64_t offset;
+                coalescedVar->getMemoryAddr(&baseRegId, &offset);
+                inst->setMemoryAddr(baseRegId, offset);
+                continue;
+            }
+
+            temps.emplace_back(liveness.getLiveRange(inst), inst);
+        }
+    }
+
+    // 按活跃区间的起始位置线性扫描，区间已经结束的临时变量所占的栈空间可被后面的临时变量复用
+    std::stable_sort(temps.begin(), temps.end(), [](const auto & a, const auto & b) {
+        return a.first.start < b.first.start;
+    });
 
-            // 32位ARM平台按照4字节的大小整数倍分配局部变量
-            size = (size + 3) & ~3;
+    // 正在使用的栈空间，每项为(活跃区间的结束位置, 大小, 偏移)，按结束位置排成小顶堆
+    using StackSlot = std::tuple<int32_t, int32_t, int32_t>;
+    std::priority_queue<StackSlot, std::vector<StackSlot>, std::greater<StackSlot>> activeSlots;
+
+    // 按大小分类的空闲栈空间的偏移
+    std::unordered_map<int32_t, std::vector<int32_t>> freeSlots;
+
+    for (auto & temp: temps) {
+
+        const LiveRange & range = temp.first;
+        Instruction * inst = temp.second;
+
+        // 活跃区间在当前区间开始前已经结束，则其栈空间可以复用
+        while (!range.empty() && !activeSlots.empty() && (std::get<0>(activeSlots.top()) < range.start)) {
+            freeSlots[std::get<1>(activeSlots.top())].push_back(std::get<2>(activeSlots.top()));
+            activeSlots.pop();
+        }
+
+        int32_t size = inst->getType()->getSize();
 
+        // 32位ARM平台按照4字节的大小整数倍分配局部变量
+        size = (size + 3) & ~3;
+
+        int32_t offset;
+        std::vector<int32_t> & slots = freeSlots[size];
+        if (!slots.empty()) {
+            offset = slots.back();
+            slots.pop_back();
+        } else {
             // 累计当前作用域大小
             sp_esp += size;
+            offset = sp_esp;
+        }
 
-            // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
-            // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
-            // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
-            // 之后需要对所有使用到该Value的指令在寄存器分配前要变换。
-
-            // 局部变量偏移设置
-            inst->setMemoryAddr(ARM32_FP_REG_NO, -sp_esp);
+        if (!range.empty()) {
+            activeSlots.emplace(range.end, size, offset);
         }
+
+        // 这里要注意检查变量栈的偏移范围。一般采用机制寄存器+立即数方式间接寻址
+        // 若立即数满足要求，可采用基址寄存器+立即数变量的方式访问变量
+        // 否则，需要先把偏移量放到寄存器中，然后机制寄存器+偏移寄存器来寻址
+        // 之后需要对所有使用到该Value的指令在寄存器分配前要变换。
+
+        // 临时变量偏移设置
+        inst->setMemoryAddr(ARM32_FP_REG_NO, -offset);
     }
 
     // 通过栈传递的实参，ARM32的前四个通过寄存器传递
@@ -15,6 +15,8 @@
 ///
 #include "CodeGeneratorAsm.h"
 #include "SimpleRegisterAllocator.h"
+#include "OutOfSSA.h"
+#include "Liveness.h"
 
 class CodeGeneratorArm32 : public CodeGeneratorAsm {
 
@@ -41,9 +43,17 @@ protected:
     /// @param func 要处理的函数
     void registerAllocation(Function * func) override;
 
+    /// @brief 按溢出代价为局部变量和临时变量指派寄存器
+    /// @param func 要处理的函数
+    /// @param outOfSSA Phi指令消除的结果，被合并的值共用存储空间，也共用寄存器
+    /// @param liveness 变量模式的活跃变量分析
+    void assignRegisters(Function * func, OutOfSSA & outOfSSA, Liveness & liveness);
+
     /// @brief 栈空间分配
     /// @param func 要处理的函数
-    void stackAlloc(Function * func);
+    /// @param outOfSSA Phi指令消除的结果，被合并的值共用存储空间
+    /// @param liveness 变量模式的活跃变量分析
+    void stackAlloc(Function * func, OutOfSSA & outOfSSA, Liveness & liveness);
 
     /// @brief 寄存器分配前对函数内的指令进行调整，以便方便寄存器分配
     /// @param func 要处理的函数
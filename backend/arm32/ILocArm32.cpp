@@ -511,14 +511,14 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
     // 计算栈帧大小
     int off = func->getMaxDep();
 
-    // 不需要在栈内额外分配空间，则什么都不做
+    // 保存SP寄存器到FP寄存器中，函数出口通过FP恢复SP，栈内不需要分配空间时也要设置
+    mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
+
+    // 不需要在栈内额外分配空间
     if (0 == off) {
         return;
     }
 
-    // 保存SP寄存器到FP寄存器中
-    mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
-
     if (PlatformArm32::constExpr(off)) {
         // sub sp,sp,#16
         emit("sub", "sp", "sp", toStr(off));
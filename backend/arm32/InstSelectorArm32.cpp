@@ -34,7 +34,7 @@
 /// @param _irCode 指令
 /// @param _iloc ILoc
 /// @param _func 函数
-InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
+InstSelectorArm32::InstSelectorArm32(InstList & _irCode,
                                      ILocArm32 & _iloc,
                                      Function * _func,
                                      SimpleRegisterAllocator & allocator)
@@ -48,6 +48,7 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
     translator_handlers[IRInstOperator::IRINST_OP_COND_BR] = &InstSelectorArm32::translate_cond_br;
 
     translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorArm32::translate_assign;
+    translator_handlers[IRInstOperator::IRINST_OP_LOAD] = &InstSelectorArm32::translate_load;
 
     translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorArm32::translate_add_int32;
     translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorArm32::translate_sub_int32;
@@ -64,6 +65,15 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
     translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorArm32::translate_gt_int32;
     translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorArm32::translate_ge_int32;
 
+    // 移位与最值、绝对值，由优化遍生成
+    translator_handlers[IRInstOperator::IRINST_OP_SHL_I] = &InstSelectorArm32::translate_shl_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_ASHR_I] = &InstSelectorArm32::translate_ashr_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LSHR_I] = &InstSelectorArm32::translate_lshr_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MIN_I] = &InstSelectorArm32::translate_min_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MAX_I] = &InstSelectorArm32::translate_max_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_ABS_I] = &InstSelectorArm32::translate_abs_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MULH_I] = &InstSelectorArm32::translate_mulh_int32;
+
     translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorArm32::translate_call;
     translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorArm32::translate_arg;
 }
@@ -144,10 +154,34 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
 {
     Instanceof(gotoInst, GotoInstruction *, inst);
 
+    // 目标基本块紧随其后时顺序执行即可，不需要跳转
+    if (isFallThrough(inst, gotoInst->getTarget())) {
+        return;
+    }
+
     // 无条件跳转
     iloc.jump(gotoInst->getTarget()->getName());
 }
 
+///
+/// @brief 判断跳转目标是否是跳转指令所在基本块在布局上的下一个基本块，是则可顺序执行而无需跳转
+/// @param inst 跳转指令
+/// @param target 跳转目标
+/// @return true 目标紧随其后
+///
+bool InstSelectorArm32::isFallThrough(Instruction * inst, LabelInstruction * target)
+{
+    BasicBlock * bb = inst->getParent();
+    if (!bb) {
+        // 没有划分基本块
+        return false;
+    }
+
+    BasicBlock * nextBlock = func->getNextBlock(bb);
+
+    return nextBlock && (nextBlock->getLabel() == target);
+}
+
 /// @brief 函数入口指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_entry(Instruction * inst)
@@ -233,6 +267,30 @@ void InstSelectorArm32::translate_assign(Instruction * inst)
     }
 }
 
+/// @brief 读取全局变量指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_load(Instruction * inst)
+{
+    Value * var = inst->getOperand(0);
+
+    int32_t result_regId = inst->getRegId();
+
+    if (result_regId != -1) {
+        // 全局变量 => 寄存器
+
+        iloc.load_var(result_regId, var);
+    } else {
+        // 全局变量 => 内存
+
+        int32_t temp_regno = simpleRegisterAllocator.Allocate();
+
+        iloc.load_var(temp_regno, var);
+        iloc.store_var(temp_regno, inst, ARM32_TMP_REG_NO);
+
+        simpleRegisterAllocator.free(temp_regno);
+    }
+}
+
 /// @brief 二元操作指令翻译成ARM32汇编
 /// @param inst IR指令
 /// @param operator_name 操作码
@@ -324,6 +382,13 @@ void InstSelectorArm32::translate_mul_int32(Instruction * inst)
     translate_two_operator(inst, "mul");
 }
 
+/// @brief 整数乘法取高32位指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_mulh_int32(Instruction * inst)
+{
+    translate_two_operator(inst, "smmul");
+}
+
 /// @brief 整数除法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_div_int32(Instruction * inst)
@@ -454,6 +519,190 @@ void InstSelectorArm32::translate_neg_int32(Instruction * inst)
     simpleRegisterAllocator.free(result);
 }
 
+/// @brief 移位指令翻译成ARM32汇编，移位位数为常量时使用立即数
+/// @param inst IR指令
+/// @param operator_name 操作码
+void InstSelectorArm32::translate_shift_operator(Instruction * inst, string operator_name)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+
+    ConstInt * amount = dynamic_cast<ConstInt *>(inst->getOperand(1));
+    if (!amount || amount->getVal() < 0 || amount->getVal() > 31) {
+        // 位数在寄存器中
+        translate_two_operator(inst, operator_name);
+        return;
+    }
+
+    int32_t arg1_reg_no = arg1->getRegId();
+    int32_t result_reg_no = inst->getRegId();
+    int32_t load_result_reg_no, load_arg1_reg_no;
+
+    // 看arg1是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
+    if (arg1_reg_no == -1) {
+        load_arg1_reg_no = simpleRegisterAllocator.Allocate(arg1);
+        iloc.load_var(load_arg1_reg_no, arg1);
+    } else {
+        load_arg1_reg_no = arg1_reg_no;
+    }
+
+    // 看结果变量是否是寄存器，若不是则需要分配一个新的寄存器来保存运算的结果
+    if (result_reg_no == -1) {
+        load_result_reg_no = simpleRegisterAllocator.Allocate(result);
+    } else {
+        load_result_reg_no = result_reg_no;
+    }
+
+    iloc.inst(operator_name,
+              PlatformArm32::regName[load_result_reg_no],
+              PlatformArm32::regName[load_arg1_reg_no],
+              "#" + std::to_string(amount->getVal()));
+
+    // 结果不是寄存器，则需要把结果保存到结果变量中
+    if (result_reg_no == -1) {
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
+    }
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数左移指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_shl_int32(Instruction * inst)
+{
+    translate_shift_operator(inst, "lsl");
+}
+
+/// @brief 整数算术右移指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_ashr_int32(Instruction * inst)
+{
+    translate_shift_operator(inst, "asr");
+}
+
+/// @brief 整数逻辑右移指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_lshr_int32(Instruction * inst)
+{
+    translate_shift_operator(inst, "lsr");
+}
+
+/// @brief 按比较结果二选一的指令翻译成ARM32汇编，比较两个操作数后用条件传送选择结果
+/// @param inst IR指令
+/// @param first_cond 选择第一个操作数的条件码
+/// @param second_cond 选择第二个操作数的条件码
+void InstSelectorArm32::translate_select_operator(Instruction * inst, string first_cond, string second_cond)
+{
+    Value * result = inst;
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int32_t arg1_reg_no = arg1->getRegId();
+    int32_t arg2_reg_no = arg2->getRegId();
+    int32_t result_reg_no = inst->getRegId();
+    int32_t load_result_reg_no, load_arg1_reg_no, load_arg2_reg_no;
+
+    // 看arg1是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
+    if (arg1_reg_no == -1) {
+        load_arg1_reg_no = simpleRegisterAllocator.Allocate(arg1);
+        iloc.load_var(load_arg1_reg_no, arg1);
+    } else {
+        load_arg1_reg_no = arg1_reg_no;
+    }
+
+    // 看arg2是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
+    if (arg2_reg_no == -1) {
+        load_arg2_reg_no = simpleRegisterAllocator.Allocate(arg2);
+        iloc.load_var(load_arg2_reg_no, arg2);
+    } else {
+        load_arg2_reg_no = arg2_reg_no;
+    }
+
+    // 看结果变量是否是寄存器，若不是则需要分配一个新的寄存器来保存运算的结果
+    if (result_reg_no == -1) {
+        load_result_reg_no = simpleRegisterAllocator.Allocate(result);
+    } else {
+        load_result_reg_no = result_reg_no;
+    }
+
+    iloc.inst("cmp", PlatformArm32::regName[load_arg1_reg_no], PlatformArm32::regName[load_arg2_reg_no]);
+
+    // 两个条件互斥，只有一条传送执行，结果寄存器与某个操作数相同时也正确
+    iloc.inst("mov" + first_cond,
+              PlatformArm32::regName[load_result_reg_no],
+              PlatformArm32::regName[load_arg1_reg_no]);
+    iloc.inst("mov" + second_cond,
+              PlatformArm32::regName[load_result_reg_no],
+              PlatformArm32::regName[load_arg2_reg_no]);
+
+    // 结果不是寄存器，则需要把结果保存到结果变量中
+    if (result_reg_no == -1) {
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
+    }
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg1);
+    simpleRegisterAllocator.free(arg2);
+    simpleRegisterAllocator.free(result);
+}
+
+/// @brief 整数最小值指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_min_int32(Instruction * inst)
+{
+    translate_select_operator(inst, "lt", "ge");
+}
+
+/// @brief 整数最大值指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_max_int32(Instruction * inst)
+{
+    translate_select_operator(inst, "gt", "le");
+}
+
+/// @brief 整数绝对值指令翻译成ARM32汇编
+/// @param inst IR指令
+void InstSelectorArm32::translate_abs_int32(Instruction * inst)
+{
+    Value * result = inst;
+    Value * arg = inst->getOperand(1); // 操作数在第二个位置，第一个是常量0
+
+    int32_t arg_reg_no = arg->getRegId();
+    int32_t result_reg_no = inst->getRegId();
+    int32_t load_arg_reg_no, load_result_reg_no;
+
+    // 看arg是否是寄存器，若是则寄存器寻址，否则要load变量到寄存器中
+    if (arg_reg_no == -1) {
+        load_arg_reg_no = simpleRegisterAllocator.Allocate(arg);
+        iloc.load_var(load_arg_reg_no, arg);
+    } else {
+        load_arg_reg_no = arg_reg_no;
+    }
+
+    // 看结果变量是否是寄存器，若不是则需要分配一个新的寄存器来保存运算的结果
+    if (result_reg_no == -1) {
+        load_result_reg_no = simpleRegisterAllocator.Allocate(result);
+    } else {
+        load_result_reg_no = result_reg_no;
+    }
+
+    // 非负时原样传送，负数时用rsb求负，两条指令的条件互斥
+    iloc.inst("cmp", PlatformArm32::regName[load_arg_reg_no], "#0");
+    iloc.inst("movge", PlatformArm32::regName[load_result_reg_no], PlatformArm32::regName[load_arg_reg_no]);
+    iloc.inst("rsblt", PlatformArm32::regName[load_result_reg_no], PlatformArm32::regName[load_arg_reg_no], "#0");
+
+    // 结果不是寄存器，则需要把结果保存到结果变量中
+    if (result_reg_no == -1) {
+        iloc.store_var(load_result_reg_no, result, ARM32_TMP_REG_NO);
+    }
+
+    // 释放寄存器
+    simpleRegisterAllocator.free(arg);
+    simpleRegisterAllocator.free(result);
+}
+
 /// @brief 函数调用指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_call(Instruction * inst)
@@ -490,12 +739,13 @@ void InstSelectorArm32::translate_call(Instruction * inst)
             newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
             esp += 4;
 
-            Instruction * assignInst = new MoveInstruction(func, newVal, arg);
+            Instruction * assignInst = func->newInst<MoveInstruction>(newVal, arg);
 
             // 翻译赋值指令
             translate_assign(assignInst);
 
-            delete assignInst;
+            // 指令的内存随函数统一释放，这里只解除对操作数的使用
+            assignInst->clearOperands();
         }
 
         for (int32_t k = 0; k < operandNum && k < 4; k++) {
@@ -506,12 +756,13 @@ void InstSelectorArm32::translate_call(Instruction * inst)
             // 如果是临时变量，该变量可更改为寄存器变量即可，或者设置寄存器号
             // 如果不是，则必须开辟一个寄存器变量，然后赋值即可
 
-            Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
+            Instruction * assignInst = func->newInst<MoveInstruction>(PlatformArm32::intRegVal[k], arg);
 
             // 翻译赋值指令
             translate_assign(assignInst);
 
-            delete assignInst;
+            // 指令的内存随函数统一释放，这里只解除对操作数的使用
+            assignInst->clearOperands();
         }
     }
 
@@ -528,12 +779,13 @@ void InstSelectorArm32::translate_call(Instruction * inst)
     if (callInst->hasResultValue()) {
 
         // 新建一个赋值操作
-        Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
+        Instruction * assignInst = func->newInst<MoveInstruction>(callInst, PlatformArm32::intRegVal[0]);
 
         // 翻译赋值指令
         translate_assign(assignInst);
 
-        delete assignInst;
+        // 指令的内存随函数统一释放，这里只解除对操作数的使用
+        assignInst->clearOperands();
     }
 
     // 函数调用后清零，使得下次可正常统计
@@ -608,12 +860,19 @@ void InstSelectorArm32::translate_cond_br(Instruction * inst)
     // 比较条件值与0
     iloc.inst("cmp", PlatformArm32::regName[loadCondRegNo], "#0");
     
-    // 如果条件值不为0，跳转到真分支，否则跳转到假分支
-    // ARM汇编使用bne (branch if not equal) 指令在比较结果不等于0时跳转
-    iloc.inst("bne", trueLabel->getName());
-    
-    // 无条件跳转到假分支
-    iloc.jump(falseLabel->getName());
+    if (isFallThrough(inst, trueLabel)) {
+        // 真分支紧随其后，条件值为0时跳转到假分支即可
+        iloc.inst("beq", falseLabel->getName());
+    } else {
+        // 如果条件值不为0，跳转到真分支，否则跳转到假分支
+        // ARM汇编使用bne (branch if not equal) 指令在比较结果不等于0时跳转
+        iloc.inst("bne", trueLabel->getName());
+
+        // 假分支紧随其后则顺序执行，否则无条件跳转到假分支
+        if (!isFallThrough(inst, falseLabel)) {
+            iloc.jump(falseLabel->getName());
+        }
+    }
     
     // 释放临时寄存器
     if (condRegNo == -1) {
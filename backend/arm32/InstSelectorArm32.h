@@ -24,6 +24,7 @@
 #include "PlatformArm32.h"
 #include "SimpleRegisterAllocator.h"
 #include "RegVariable.h"
+#include "LabelInstruction.h"
 
 using namespace std;
 
@@ -31,7 +32,7 @@ using namespace std;
 class InstSelectorArm32 {
 
     /// @brief 所有的IR指令
-    std::vector<Instruction *> & ir;
+    InstList & ir;
 
     /// @brief 指令变换
     ILocArm32 & iloc;
@@ -60,6 +61,10 @@ protected:
     /// @param inst IR指令
     void translate_assign(Instruction * inst);
 
+    /// @brief 读取全局变量指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_load(Instruction * inst);
+
     /// @brief Label指令指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_label(Instruction * inst);
@@ -120,6 +125,45 @@ protected:
     /// @param inst IR指令
     void translate_ge_int32(Instruction * inst);
 
+    /// @brief 整数左移指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_shl_int32(Instruction * inst);
+
+    /// @brief 整数算术右移指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_ashr_int32(Instruction * inst);
+
+    /// @brief 整数逻辑右移指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_lshr_int32(Instruction * inst);
+
+    /// @brief 整数最小值指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_min_int32(Instruction * inst);
+
+    /// @brief 整数最大值指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_max_int32(Instruction * inst);
+
+    /// @brief 整数绝对值指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_abs_int32(Instruction * inst);
+
+    /// @brief 整数乘法取高32位指令翻译成ARM32汇编
+    /// @param inst IR指令
+    void translate_mulh_int32(Instruction * inst);
+
+    /// @brief 移位指令翻译成ARM32汇编，移位位数为常量时使用立即数
+    /// @param inst IR指令
+    /// @param operator_name 操作码
+    void translate_shift_operator(Instruction * inst, string operator_name);
+
+    /// @brief 按比较结果二选一的指令翻译成ARM32汇编，比较两个操作数后用条件传送选择结果
+    /// @param inst IR指令
+    /// @param first_cond 选择第一个操作数的条件码
+    /// @param second_cond 选择第二个操作数的条件码
+    void translate_select_operator(Instruction * inst, string first_cond, string second_cond);
+
     /// @brief 二元操作指令翻译成ARM32汇编
     /// @param inst IR指令
     /// @param operator_name 操作码
@@ -140,6 +184,14 @@ protected:
     ///
     void outputIRInstruction(Instruction * inst);
 
+    ///
+    /// @brief 判断跳转目标是否是跳转指令所在基本块在布局上的下一个基本块，是则可顺序执行而无需跳转
+    /// @param inst 跳转指令
+    /// @param target 跳转目标
+    /// @return true 目标紧随其后
+    ///
+    bool isFallThrough(Instruction * inst, LabelInstruction * target);
+
     /// @brief IR翻译动作函数原型
     typedef void (InstSelectorArm32::*translate_handler)(Instruction *);
 
@@ -169,7 +221,7 @@ public:
     /// @param _irCode IR指令
     /// @param _func 函数
     /// @param _iloc 后端指令
-    InstSelectorArm32(std::vector<Instruction *> & _irCode,
+    InstSelectorArm32(InstList & _irCode,
                       ILocArm32 & _iloc,
                       Function * _func,
                       SimpleRegisterAllocator & allocator);
@@ -22,6 +22,9 @@
 // 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO
 #define ARM32_TMP_REG_NO 10
 
+// 消除Phi指令时打破并行复制环所用的寄存器为IP，即R12
+#define ARM32_SCRATCH_REG_NO 12
+
 // 栈寄存器SP和FP
 #define ARM32_SP_REG_NO 13
 #define ARM32_FP_REG_NO 11
@@ -29,6 +32,11 @@
 // 函数跳转寄存器LX
 #define ARM32_LX_REG_NO 14
 
+// 寄存器分配时可指派给变量的寄存器范围，均为被调用者保存的寄存器，使用时需要保护。
+// 指令选择时临时借助的寄存器不使用这个范围
+#define ARM32_ALLOC_FIRST_REG_NO 5
+#define ARM32_ALLOC_LAST_REG_NO 9
+
 /// @brief ARM32平台信息
 class PlatformArm32 {
 
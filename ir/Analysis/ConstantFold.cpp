@@ -0,0 +1,193 @@
+///
+/// @file ConstantFold.cpp
+/// @brief 整数运算的常量折叠，语义与目标机器的32位补码运算一致
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <limits>
+
+#include "ConstantFold.h"
+
+///
+/// @brief 判断二元运算是否满足交换律
+/// @param op 运算符
+/// @return true 满足交换律
+///
+bool isCommutative(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NEQ_I:
+        case IRInstOperator::IRINST_OP_MIN_I:
+        case IRInstOperator::IRINST_OP_MAX_I:
+        case IRInstOperator::IRINST_OP_MULH_I:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 判断是否为比较运算，比较的结果为0或1
+/// @param op 运算符
+/// @return true 是比较运算
+///
+bool isComparison(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NEQ_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 获取结果取反的比较运算，如a<b取反为a>=b
+/// @param op 比较运算符
+/// @return IRInstOperator 取反后的运算符
+///
+IRInstOperator invertComparison(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_EQ_I:
+            return IRInstOperator::IRINST_OP_NEQ_I;
+        case IRInstOperator::IRINST_OP_NEQ_I:
+            return IRInstOperator::IRINST_OP_EQ_I;
+        case IRInstOperator::IRINST_OP_LT_I:
+            return IRInstOperator::IRINST_OP_GE_I;
+        case IRInstOperator::IRINST_OP_LE_I:
+            return IRInstOperator::IRINST_OP_GT_I;
+        case IRInstOperator::IRINST_OP_GT_I:
+            return IRInstOperator::IRINST_OP_LE_I;
+        case IRInstOperator::IRINST_OP_GE_I:
+            return IRInstOperator::IRINST_OP_LT_I;
+        default:
+            return op;
+    }
+}
+
+///
+/// @brief 获取交换操作数后结果不变的比较运算，如a<b交换为b>a
+/// @param op 比较运算符
+/// @return IRInstOperator 交换后的运算符
+///
+IRInstOperator swapComparison(IRInstOperator op)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_LT_I:
+            return IRInstOperator::IRINST_OP_GT_I;
+        case IRInstOperator::IRINST_OP_LE_I:
+            return IRInstOperator::IRINST_OP_GE_I;
+        case IRInstOperator::IRINST_OP_GT_I:
+            return IRInstOperator::IRINST_OP_LT_I;
+        case IRInstOperator::IRINST_OP_GE_I:
+            return IRInstOperator::IRINST_OP_LE_I;
+        default:
+            return op;
+    }
+}
+
+///
+/// @brief 对两个整数常量进行二元运算。加减乘、求负与绝对值按32位补码回绕；
+/// 除数为0以及INT32_MIN除以-1在运行时的行为未定义，不折叠，保留到运行时；
+/// 移位位数超出0到31的范围时，目标机器的结果与C++不同，也不折叠
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @param result 运算结果
+/// @return true 折叠成功，false 不是可折叠的运算或者不能折叠
+///
+bool constantFoldBinary(IRInstOperator op, int32_t lhs, int32_t rhs, int32_t & result)
+{
+    // 有符号溢出在C++中未定义，借助无符号运算得到回绕的结果
+    uint32_t ulhs = (uint32_t) lhs;
+    uint32_t urhs = (uint32_t) rhs;
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+            result = (int32_t) (ulhs + urhs);
+            return true;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            result = (int32_t) (ulhs - urhs);
+            return true;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            result = (int32_t) (ulhs * urhs);
+            return true;
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+            if (rhs == 0 || (lhs == std::numeric_limits<int32_t>::min() && rhs == -1)) {
+                return false;
+            }
+            result = op == IRInstOperator::IRINST_OP_DIV_I ? lhs / rhs : lhs % rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_NEG_I:
+            // 一元运算的第一个操作数为常量0
+            result = (int32_t) (0u - urhs);
+            return true;
+        case IRInstOperator::IRINST_OP_ABS_I:
+            result = rhs < 0 ? (int32_t) (0u - urhs) : rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_SHL_I:
+        case IRInstOperator::IRINST_OP_ASHR_I:
+        case IRInstOperator::IRINST_OP_LSHR_I:
+            if (rhs < 0 || rhs > 31) {
+                return false;
+            }
+            if (op == IRInstOperator::IRINST_OP_SHL_I) {
+                result = (int32_t) (ulhs << rhs);
+            } else if (op == IRInstOperator::IRINST_OP_LSHR_I) {
+                result = (int32_t) (ulhs >> rhs);
+            } else {
+                // 负数右移在C++17中由实现定义，按符号位补齐计算
+                result = lhs < 0 ? (int32_t) ~(~ulhs >> rhs) : lhs >> rhs;
+            }
+            return true;
+        case IRInstOperator::IRINST_OP_MULH_I:
+            // 64位乘积不会溢出，取高32位
+            result = (int32_t) (((int64_t) lhs * (int64_t) rhs) >> 32);
+            return true;
+        case IRInstOperator::IRINST_OP_MIN_I:
+            result = lhs < rhs ? lhs : rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_MAX_I:
+            result = lhs > rhs ? lhs : rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            result = lhs == rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_NEQ_I:
+            result = lhs != rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_LT_I:
+            result = lhs < rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_LE_I:
+            result = lhs <= rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_GT_I:
+            result = lhs > rhs;
+            return true;
+        case IRInstOperator::IRINST_OP_GE_I:
+            result = lhs >= rhs;
+            return true;
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,60 @@
+///
+/// @file ConstantFold.h
+/// @brief 整数运算的常量折叠，语义与目标机器的32位补码运算一致
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+#include "Instruction.h"
+
+///
+/// @brief 判断二元运算是否满足交换律
+/// @param op 运算符
+/// @return true 满足交换律
+///
+bool isCommutative(IRInstOperator op);
+
+///
+/// @brief 判断是否为比较运算，比较的结果为0或1
+/// @param op 运算符
+/// @return true 是比较运算
+///
+bool isComparison(IRInstOperator op);
+
+///
+/// @brief 获取结果取反的比较运算，如a<b取反为a>=b
+/// @param op 比较运算符
+/// @return IRInstOperator 取反后的运算符
+///
+IRInstOperator invertComparison(IRInstOperator op);
+
+///
+/// @brief 获取交换操作数后结果不变的比较运算，如a<b交换为b>a
+/// @param op 比较运算符
+/// @return IRInstOperator 交换后的运算符
+///
+IRInstOperator swapComparison(IRInstOperator op);
+
+///
+/// @brief 对两个整数常量进行二元运算。加减乘、求负与绝对值按32位补码回绕；
+/// 除数为0以及INT32_MIN除以-1在运行时的行为未定义，不折叠，保留到运行时；
+/// 移位位数超出0到31的范围时，目标机器的结果与C++不同，也不折叠
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @param result 运算结果
+/// @return true 折叠成功，false 不是可折叠的运算或者不能折叠
+///
+bool constantFoldBinary(IRInstOperator op, int32_t lhs, int32_t rhs, int32_t & result);
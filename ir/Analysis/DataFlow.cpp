@@ -0,0 +1,201 @@
+///
+/// @file DataFlow.cpp
+/// @brief 基于位向量的通用数据流分析框架
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <utility>
+
+#include "DataFlow.h"
+#include "DominatorTree.h"
+#include "Function.h"
+
+///
+/// @brief 构造函数，函数必须已经划分基本块
+/// @param _func 函数
+/// @param _direction 分析方向
+/// @param _meet 交汇运算
+/// @param _bitNum 位向量的位数，通常为稠密编号的个数
+///
+DataFlowAnalysis::DataFlowAnalysis(Function * _func,
+                                   DataFlowDirection _direction,
+                                   DataFlowMeet _meet,
+                                   int32_t _bitNum)
+    : func(_func), direction(_direction), meetOp(_meet), bitNum(_bitNum), boundary(_bitNum)
+{
+    size_t blockNum = func->getBasicBlocks().size();
+
+    gens.assign(blockNum, BitVector(bitNum));
+    kills.assign(blockNum, BitVector(bitNum));
+
+    // 交集运算时，尚未计算的值取全集，不影响交汇的结果
+    bool top = meetOp == DataFlowMeet::INTERSECT;
+    ins.assign(blockNum, BitVector(bitNum, top));
+    outs.assign(blockNum, BitVector(bitNum, top));
+}
+
+///
+/// @brief 获取基本块的gen集合，求解前设置
+/// @param bb 基本块
+/// @return BitVector& gen集合
+///
+BitVector & DataFlowAnalysis::getGen(BasicBlock * bb)
+{
+    return gens[bb->getIndex()];
+}
+
+///
+/// @brief 获取基本块的kill集合，求解前设置
+/// @param bb 基本块
+/// @return BitVector& kill集合
+///
+BitVector & DataFlowAnalysis::getKill(BasicBlock * bb)
+{
+    return kills[bb->getIndex()];
+}
+
+///
+/// @brief 设置边界值，即前向分析时入口的输入，后向分析时出口的输出，默认为空集
+/// @param val 边界值
+///
+void DataFlowAnalysis::setBoundary(const BitVector & val)
+{
+    boundary = val;
+}
+
+///
+/// @brief 求解数据流方程
+///
+void DataFlowAnalysis::solve()
+{
+    bool forward = direction == DataFlowDirection::FORWARD;
+
+    // 后向分析在逆向控制流图上按逆后序处理，正好是后支配树计算时所用的序列
+    DominatorTree * tree = forward ? func->getDominatorTree() : func->getPostDominatorTree();
+    const std::vector<BasicBlock *> & order = tree->getRPO();
+
+    std::vector<int32_t> orderNo(func->getBasicBlocks().size(), -1);
+    for (size_t k = 0; k < order.size(); ++k) {
+        orderNo[order[k]->getIndex()] = (int32_t) k;
+    }
+
+    // 工作表，按逆后序编号索引，开始时所有基本块都需要处理
+    BitVector pending((int32_t) order.size(), true);
+    BitVector result(bitNum);
+
+    int32_t pos = pending.findFirst();
+    while (pos != -1) {
+
+        pending.reset(pos);
+        visitCount++;
+
+        BasicBlock * bb = order[pos];
+        int32_t bbNo = bb->getIndex();
+
+        BitVector & input = forward ? ins[bbNo] : outs[bbNo];
+        BitVector & output = forward ? outs[bbNo] : ins[bbNo];
+
+        meet(bb, input);
+        transfer(bb, input, result);
+
+        if (result != output) {
+            std::swap(output, result);
+
+            // 输出变化，计算方向上的后继需要重新处理
+            for (auto next: forward ? bb->getSuccessors() : bb->getPredecessors()) {
+                if (orderNo[next->getIndex()] != -1) {
+                    pending.set(orderNo[next->getIndex()]);
+                }
+            }
+        }
+
+        // 继续本遍中后面的基本块，到尾部后从头开始下一遍
+        pos = pending.findNext(pos);
+        if (pos == -1) {
+            pos = pending.findFirst();
+        }
+    }
+}
+
+///
+/// @brief 获取基本块入口处的数据流值
+/// @param bb 基本块
+/// @return const BitVector& 数据流值
+///
+const BitVector & DataFlowAnalysis::getIn(BasicBlock * bb) const
+{
+    return ins[bb->getIndex()];
+}
+
+///
+/// @brief 获取基本块出口处的数据流值
+/// @param bb 基本块
+/// @return const BitVector& 数据流值
+///
+const BitVector & DataFlowAnalysis::getOut(BasicBlock * bb) const
+{
+    return outs[bb->getIndex()];
+}
+
+///
+/// @brief 获取求解时处理基本块的次数，用于观察收敛速度
+/// @return int32_t 次数
+///
+int32_t DataFlowAnalysis::getVisitCount() const
+{
+    return visitCount;
+}
+
+///
+/// @brief 交汇运算，求基本块的输入：前向分析为所有前驱出口值的交汇，后向分析为所有后继入口值的交汇。
+/// 没有前驱（后向时为后继）的基本块取边界值
+/// @param bb 基本块
+/// @param result 交汇结果
+///
+void DataFlowAnalysis::meet(BasicBlock * bb, BitVector & result)
+{
+    bool forward = direction == DataFlowDirection::FORWARD;
+
+    std::vector<BasicBlock *> & neighbors = forward ? bb->getPredecessors() : bb->getSuccessors();
+    if (neighbors.empty()) {
+        result = boundary;
+        return;
+    }
+
+    bool first = true;
+    for (auto neighbor: neighbors) {
+
+        const BitVector & val = forward ? outs[neighbor->getIndex()] : ins[neighbor->getIndex()];
+
+        if (first) {
+            result = val;
+            first = false;
+        } else if (meetOp == DataFlowMeet::UNION) {
+            result.unionWith(val);
+        } else {
+            result.intersectWith(val);
+        }
+    }
+}
+
+///
+/// @brief 传递函数，由基本块的输入计算输出
+/// @param bb 基本块
+/// @param input 输入
+/// @param output 输出
+///
+void DataFlowAnalysis::transfer(BasicBlock * bb, const BitVector & input, BitVector & output)
+{
+    output = input;
+    output.subtract(kills[bb->getIndex()]);
+    output.unionWith(gens[bb->getIndex()]);
+}
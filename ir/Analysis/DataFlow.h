@@ -0,0 +1,186 @@
+///
+/// @file DataFlow.h
+/// @brief 基于位向量的通用数据流分析框架
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BitVector.h"
+
+class Function;
+class BasicBlock;
+
+///
+/// @brief 数据流分析的方向
+///
+enum class DataFlowDirection : std::int8_t {
+
+    /// @brief 前向，如到达定值、可用表达式
+    FORWARD,
+
+    /// @brief 后向，如活跃变量
+    BACKWARD,
+};
+
+///
+/// @brief 数据流分析的交汇运算
+///
+enum class DataFlowMeet : std::int8_t {
+
+    /// @brief 并集，存在一条路径即可（may分析）
+    UNION,
+
+    /// @brief 交集，所有路径都需满足（must分析）
+    INTERSECT,
+};
+
+///
+/// @brief 基于位向量的数据流分析。使用者设置每个基本块的gen与kill集合后求解，
+/// 默认的传递函数为 结果 = gen ∪ (输入 - kill)。
+/// 求解采用工作表算法，工作表是按逆后序编号的位向量，每次取编号最小的待处理基本块，
+/// 因此按逆后序（后向分析时为逆向控制流图上的逆后序）逐遍处理，无环部分一遍即可收敛。
+/// 前向分析时从入口不可达的基本块不参与计算，保持初值。
+/// 需要特殊交汇或传递方式的分析可继承后重写meet与transfer
+///
+class DataFlowAnalysis {
+
+public:
+    ///
+    /// @brief 构造函数，函数必须已经划分基本块
+    /// @param _func 函数
+    /// @param _direction 分析方向
+    /// @param _meet 交汇运算
+    /// @param _bitNum 位向量的位数，通常为稠密编号的个数
+    ///
+    DataFlowAnalysis(Function * _func, DataFlowDirection _direction, DataFlowMeet _meet, int32_t _bitNum);
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~DataFlowAnalysis() = default;
+
+    ///
+    /// @brief 获取基本块的gen集合，求解前设置
+    /// @param bb 基本块
+    /// @return BitVector& gen集合
+    ///
+    BitVector & getGen(BasicBlock * bb);
+
+    ///
+    /// @brief 获取基本块的kill集合，求解前设置
+    /// @param bb 基本块
+    /// @return BitVector& kill集合
+    ///
+    BitVector & getKill(BasicBlock * bb);
+
+    ///
+    /// @brief 设置边界值，即前向分析时入口的输入，后向分析时出口的输出，默认为空集
+    /// @param val 边界值
+    ///
+    void setBoundary(const BitVector & val);
+
+    ///
+    /// @brief 求解数据流方程
+    ///
+    void solve();
+
+    ///
+    /// @brief 获取基本块入口处的数据流值
+    /// @param bb 基本块
+    /// @return const BitVector& 数据流值
+    ///
+    const BitVector & getIn(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取基本块出口处的数据流值
+    /// @param bb 基本块
+    /// @return const BitVector& 数据流值
+    ///
+    const BitVector & getOut(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取求解时处理基本块的次数，用于观察收敛速度
+    /// @return int32_t 次数
+    ///
+    int32_t getVisitCount() const;
+
+protected:
+    ///
+    /// @brief 交汇运算，求基本块的输入：前向分析为所有前驱出口值的交汇，后向分析为所有后继入口值的交汇。
+    /// 没有前驱（后向时为后继）的基本块取边界值
+    /// @param bb 基本块
+    /// @param result 交汇结果
+    ///
+    virtual void meet(BasicBlock * bb, BitVector & result);
+
+    ///
+    /// @brief 传递函数，由基本块的输入计算输出
+    /// @param bb 基本块
+    /// @param input 输入
+    /// @param output 输出
+    ///
+    virtual void transfer(BasicBlock * bb, const BitVector & input, BitVector & output);
+
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 分析方向
+    ///
+    DataFlowDirection direction;
+
+    ///
+    /// @brief 交汇运算
+    ///
+    DataFlowMeet meetOp;
+
+    ///
+    /// @brief 位向量的位数
+    ///
+    int32_t bitNum;
+
+    ///
+    /// @brief 按基本块布局序号索引的gen集合
+    ///
+    std::vector<BitVector> gens;
+
+    ///
+    /// @brief 按基本块布局序号索引的kill集合
+    ///
+    std::vector<BitVector> kills;
+
+    ///
+    /// @brief 按基本块布局序号索引的入口值
+    ///
+    std::vector<BitVector> ins;
+
+    ///
+    /// @brief 按基本块布局序号索引的出口值
+    ///
+    std::vector<BitVector> outs;
+
+    ///
+    /// @brief 边界值
+    ///
+    BitVector boundary;
+
+    ///
+    /// @brief 求解时处理基本块的次数
+    ///
+    int32_t visitCount = 0;
+};
@@ -0,0 +1,438 @@
+///
+/// @file DominatorTree.cpp
+/// @brief 支配树、后支配树以及支配边界分析的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <utility>
+
+#include "DominatorTree.h"
+#include "Function.h"
+
+///
+/// @brief 构造函数，构造时即完成计算
+/// @param _func 函数
+/// @param _post true：后支配树，false：支配树
+///
+DominatorTree::DominatorTree(Function * _func, bool _post) : func(_func), post(_post)
+{
+    recalculate();
+}
+
+///
+/// @brief 根据函数当前的控制流图重新计算
+///
+void DominatorTree::recalculate()
+{
+    cfgVersion = func->getCFGVersion();
+
+    size_t blockNum = func->getBasicBlocks().size();
+
+    rpo.clear();
+    roots.clear();
+    rpoNumber.assign(blockNum, -1);
+    idom.clear();
+    children.assign(blockNum, {});
+    frontier.assign(blockNum, {});
+    level.assign(blockNum, -1);
+    dfsIn.assign(blockNum, -1);
+    dfsOut.assign(blockNum, -1);
+
+    if (blockNum == 0) {
+        return;
+    }
+
+    computeRPO();
+    computeIDom();
+    buildTree();
+    computeFrontier();
+}
+
+///
+/// @brief 计算时对应的函数控制流图版本，与函数的当前版本不一致则说明已失效
+/// @return uint64_t 控制流图版本
+///
+uint64_t DominatorTree::getCFGVersion() const
+{
+    return cfgVersion;
+}
+
+///
+/// @brief 是否是后支配树
+/// @return true 后支配树
+///
+bool DominatorTree::isPostDominator() const
+{
+    return post;
+}
+
+///
+/// @brief 获取计算方向上的前驱，后支配树时为控制流图上的后继
+/// @param bb 基本块
+/// @return std::vector<BasicBlock *>& 前驱列表
+///
+std::vector<BasicBlock *> & DominatorTree::preds(BasicBlock * bb) const
+{
+    return post ? bb->getSuccessors() : bb->getPredecessors();
+}
+
+///
+/// @brief 获取计算方向上的后继，后支配树时为控制流图上的前驱
+/// @param bb 基本块
+/// @return std::vector<BasicBlock *>& 后继列表
+///
+std::vector<BasicBlock *> & DominatorTree::succs(BasicBlock * bb) const
+{
+    return post ? bb->getPredecessors() : bb->getSuccessors();
+}
+
+///
+/// @brief 计算逆后序，并记录每个基本块的逆后序编号
+///
+void DominatorTree::computeRPO()
+{
+    std::vector<BasicBlock *> & blocks = func->getBasicBlocks();
+
+    std::vector<BasicBlock *> postOrder;
+    std::vector<char> visited(blocks.size(), 0);
+
+    // 非递归的深度优先遍历，栈中保存基本块以及下一个要访问的后继序号
+    std::vector<std::pair<BasicBlock *, size_t>> stack;
+
+    auto dfs = [&](BasicBlock * start) {
+        visited[start->getIndex()] = 1;
+        stack.emplace_back(start, 0);
+
+        while (!stack.empty()) {
+            BasicBlock * bb = stack.back().first;
+            size_t & next = stack.back().second;
+
+            std::vector<BasicBlock *> & nexts = succs(bb);
+            if (next < nexts.size()) {
+                BasicBlock * succ = nexts[next++];
+                if (!visited[succ->getIndex()]) {
+                    visited[succ->getIndex()] = 1;
+                    stack.emplace_back(succ, 0);
+                }
+            } else {
+                postOrder.push_back(bb);
+                stack.pop_back();
+            }
+        }
+    };
+
+    if (!post) {
+        dfs(func->getEntryBlock());
+    } else {
+        // 虚拟出口的后继首先是没有后继的出口基本块
+        for (auto bb: blocks) {
+            if (bb->getSuccessors().empty()) {
+                roots.push_back(bb);
+                dfs(bb);
+            }
+        }
+
+        // 不能到达出口的基本块（死循环）也要挂在虚拟出口下，逆布局顺序选取可使循环的尾部成为根
+        for (auto iter = blocks.rbegin(); iter != blocks.rend(); ++iter) {
+            if (!visited[(*iter)->getIndex()]) {
+                roots.push_back(*iter);
+                dfs(*iter);
+            }
+        }
+    }
+
+    rpo.assign(postOrder.rbegin(), postOrder.rend());
+
+    // 后支配树时0号为虚拟出口，基本块从1开始编号
+    int32_t base = post ? 1 : 0;
+    for (size_t k = 0; k < rpo.size(); ++k) {
+        rpoNumber[rpo[k]->getIndex()] = (int32_t) k + base;
+    }
+
+    // 前驱按逆后序编号连续存放，迭代时只访问整数数组，避免反复经由基本块对象间接访问
+    std::vector<char> rootChild(rpo.size() + base, 0);
+    for (auto bb: roots) {
+        rootChild[rpoNumber[bb->getIndex()]] = 1;
+    }
+
+    predOffset.assign(1, 0);
+    predList.clear();
+    for (int32_t k = 0; k < base; ++k) {
+        predOffset.push_back((int32_t) predList.size());
+    }
+    for (size_t k = 0; k < rpo.size(); ++k) {
+        if (rootChild[k + base]) {
+            // 虚拟出口到根的边
+            predList.push_back(0);
+        }
+        for (auto pred: preds(rpo[k])) {
+            int32_t p = rpoNumber[pred->getIndex()];
+            if (p != -1) {
+                predList.push_back(p);
+            }
+        }
+        predOffset.push_back((int32_t) predList.size());
+    }
+}
+
+///
+/// @brief 迭代计算直接支配者
+///
+void DominatorTree::computeIDom()
+{
+    int32_t base = post ? 1 : 0;
+    int32_t nodeNum = (int32_t) rpo.size() + base;
+
+    idom.assign(nodeNum, -1);
+    idom[0] = 0;
+
+    // 按照逆后序编号求两个节点在当前支配树上的最近公共祖先
+    auto intersect = [this](int32_t a, int32_t b) {
+        while (a != b) {
+            while (a > b) {
+                a = idom[a];
+            }
+            while (b > a) {
+                b = idom[b];
+            }
+        }
+        return a;
+    };
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (int32_t k = 1; k < nodeNum; ++k) {
+
+            int32_t newIdom = -1;
+
+            for (int32_t i = predOffset[k]; i < predOffset[k + 1]; ++i) {
+                int32_t p = predList[i];
+                if (idom[p] == -1) {
+                    // 还没有处理过的前驱
+                    continue;
+                }
+                newIdom = (newIdom == -1) ? p : intersect(p, newIdom);
+            }
+
+            if (idom[k] != newIdom) {
+                idom[k] = newIdom;
+                changed = true;
+            }
+        }
+    }
+}
+
+///
+/// @brief 建立支配树的孩子列表、深度以及先序区间编号
+///
+void DominatorTree::buildTree()
+{
+    if (!post) {
+        roots.push_back(rpo.front());
+    }
+
+    // 按照逆后序加入孩子，使得每个节点的孩子保持确定的顺序
+    for (auto bb: rpo) {
+        BasicBlock * parent = getIDom(bb);
+        if (parent) {
+            children[parent->getIndex()].push_back(bb);
+        }
+    }
+
+    // 非递归的先序遍历，计算深度和区间编号
+    int32_t counter = 0;
+    std::vector<std::pair<BasicBlock *, size_t>> stack;
+
+    for (auto root: roots) {
+
+        level[root->getIndex()] = 0;
+        dfsIn[root->getIndex()] = counter++;
+        stack.emplace_back(root, 0);
+
+        while (!stack.empty()) {
+            BasicBlock * bb = stack.back().first;
+            size_t & next = stack.back().second;
+
+            std::vector<BasicBlock *> & kids = children[bb->getIndex()];
+            if (next < kids.size()) {
+                BasicBlock * kid = kids[next++];
+                level[kid->getIndex()] = level[bb->getIndex()] + 1;
+                dfsIn[kid->getIndex()] = counter++;
+                stack.emplace_back(kid, 0);
+            } else {
+                dfsOut[bb->getIndex()] = counter++;
+                stack.pop_back();
+            }
+        }
+    }
+}
+
+///
+/// @brief 计算支配边界
+///
+void DominatorTree::computeFrontier()
+{
+    int32_t base = post ? 1 : 0;
+
+    for (int32_t k = base; k < (int32_t) idom.size(); ++k) {
+
+        if (predOffset[k + 1] - predOffset[k] < 2) {
+            continue;
+        }
+
+        BasicBlock * bb = rpo[k - base];
+
+        for (int32_t i = predOffset[k]; i < predOffset[k + 1]; ++i) {
+
+            // 从前驱沿支配树向上直到bb的直接支配者，路径上的节点的支配边界都含有bb
+            int32_t runner = predList[i];
+            while (runner != idom[k] && runner >= base) {
+                std::vector<BasicBlock *> & df = frontier[rpo[runner - base]->getIndex()];
+                if (df.empty() || df.back() != bb) {
+                    df.push_back(bb);
+                }
+                runner = idom[runner];
+            }
+        }
+    }
+}
+
+///
+/// @brief 获取直接支配者
+/// @param bb 基本块
+/// @return BasicBlock* 直接支配者，根节点、不可达的基本块或者直接后支配者为虚拟出口时返回nullptr
+///
+BasicBlock * DominatorTree::getIDom(BasicBlock * bb) const
+{
+    int32_t base = post ? 1 : 0;
+
+    int32_t num = rpoNumber[bb->getIndex()];
+    if (num <= 0) {
+        return nullptr;
+    }
+
+    int32_t parent = idom[num];
+    if (parent < base) {
+        return nullptr;
+    }
+
+    return rpo[parent - base];
+}
+
+///
+/// @brief 获取支配树上的孩子，即直接支配的基本块
+/// @param bb 基本块
+/// @return const std::vector<BasicBlock *>& 孩子列表
+///
+const std::vector<BasicBlock *> & DominatorTree::getChildren(BasicBlock * bb) const
+{
+    return children[bb->getIndex()];
+}
+
+///
+/// @brief 获取支配树的根，后支配树时为直接后支配者为虚拟出口的基本块
+/// @return const std::vector<BasicBlock *>& 根列表，支配树只有入口基本块一个
+///
+const std::vector<BasicBlock *> & DominatorTree::getRoots() const
+{
+    return roots;
+}
+
+///
+/// @brief 获取支配边界
+/// @param bb 基本块
+/// @return const std::vector<BasicBlock *>& 支配边界
+///
+const std::vector<BasicBlock *> & DominatorTree::getDominanceFrontier(BasicBlock * bb) const
+{
+    return frontier[bb->getIndex()];
+}
+
+///
+/// @brief 判断a是否支配b，a支配a。通过支配树的先序编号区间判断，O(1)
+/// @param a 基本块
+/// @param b 基本块
+/// @return true a支配b
+///
+bool DominatorTree::dominates(BasicBlock * a, BasicBlock * b) const
+{
+    if (!isReachable(a) || !isReachable(b)) {
+        return false;
+    }
+
+    return (dfsIn[a->getIndex()] <= dfsIn[b->getIndex()]) && (dfsOut[b->getIndex()] <= dfsOut[a->getIndex()]);
+}
+
+///
+/// @brief 判断a是否严格支配b
+/// @param a 基本块
+/// @param b 基本块
+/// @return true a严格支配b
+///
+bool DominatorTree::properlyDominates(BasicBlock * a, BasicBlock * b) const
+{
+    return (a != b) && dominates(a, b);
+}
+
+///
+/// @brief 判断基本块是否在树中，即从入口可达（后支配树时总是在树中）
+/// @param bb 基本块
+/// @return true 可达
+///
+bool DominatorTree::isReachable(BasicBlock * bb) const
+{
+    return rpoNumber[bb->getIndex()] != -1;
+}
+
+///
+/// @brief 获取基本块在支配树中的深度，根的深度为0
+/// @param bb 基本块
+/// @return int32_t 深度，不在树中时为-1
+///
+int32_t DominatorTree::getLevel(BasicBlock * bb) const
+{
+    return level[bb->getIndex()];
+}
+
+///
+/// @brief 获取计算时所用的逆后序序列，只含有可达的基本块。后支配树时为逆向控制流图上的逆后序
+/// @return const std::vector<BasicBlock *>& 逆后序序列
+///
+const std::vector<BasicBlock *> & DominatorTree::getRPO() const
+{
+    return rpo;
+}
+
+///
+/// @brief 按支配树先序遍历得到的基本块序列，子节点按逆后序
+/// @return std::vector<BasicBlock *> 先序序列
+///
+std::vector<BasicBlock *> DominatorTree::getPreOrder() const
+{
+    // 进入编号和离开编号都在[0, 2n)之间，按进入编号放入对应位置即可得到先序序列
+    std::vector<BasicBlock *> slots(2 * rpo.size(), nullptr);
+    for (auto bb: rpo) {
+        slots[dfsIn[bb->getIndex()]] = bb;
+    }
+
+    std::vector<BasicBlock *> order;
+    order.reserve(rpo.size());
+    for (auto bb: slots) {
+        if (bb) {
+            order.push_back(bb);
+        }
+    }
+
+    return order;
+}
@@ -0,0 +1,230 @@
+///
+/// @file DominatorTree.h
+/// @brief 支配树、后支配树以及支配边界分析的头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class Function;
+class BasicBlock;
+
+///
+/// @brief 支配树。采用Cooper-Harvey-Kennedy的迭代算法，按逆后序迭代求直接支配者，
+/// 在实际的控制流图上通常两三遍即可收敛，整体近似线性。
+/// 后支配树在逆向控制流图上计算，引入一个虚拟出口作为根，
+/// 函数的出口基本块以及不能到达出口的基本块（如死循环）都作为虚拟出口的前驱。
+///
+class DominatorTree {
+
+public:
+    ///
+    /// @brief 构造函数，构造时即完成计算
+    /// @param _func 函数
+    /// @param _post true：后支配树，false：支配树
+    ///
+    DominatorTree(Function * _func, bool _post = false);
+
+    ///
+    /// @brief 根据函数当前的控制流图重新计算
+    ///
+    void recalculate();
+
+    ///
+    /// @brief 计算时对应的函数控制流图版本，与函数的当前版本不一致则说明已失效
+    /// @return uint64_t 控制流图版本
+    ///
+    uint64_t getCFGVersion() const;
+
+    ///
+    /// @brief 是否是后支配树
+    /// @return true 后支配树
+    ///
+    bool isPostDominator() const;
+
+    ///
+    /// @brief 获取直接支配者
+    /// @param bb 基本块
+    /// @return BasicBlock* 直接支配者，根节点、不可达的基本块或者直接后支配者为虚拟出口时返回nullptr
+    ///
+    BasicBlock * getIDom(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取支配树上的孩子，即直接支配的基本块
+    /// @param bb 基本块
+    /// @return const std::vector<BasicBlock *>& 孩子列表
+    ///
+    const std::vector<BasicBlock *> & getChildren(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取支配树的根，后支配树时为直接后支配者为虚拟出口的基本块
+    /// @return const std::vector<BasicBlock *>& 根列表，支配树只有入口基本块一个
+    ///
+    const std::vector<BasicBlock *> & getRoots() const;
+
+    ///
+    /// @brief 获取支配边界
+    /// @param bb 基本块
+    /// @return const std::vector<BasicBlock *>& 支配边界
+    ///
+    const std::vector<BasicBlock *> & getDominanceFrontier(BasicBlock * bb) const;
+
+    ///
+    /// @brief 判断a是否支配b，a支配a。通过支配树的先序编号区间判断，O(1)
+    /// @param a 基本块
+    /// @param b 基本块
+    /// @return true a支配b
+    ///
+    bool dominates(BasicBlock * a, BasicBlock * b) const;
+
+    ///
+    /// @brief 判断a是否严格支配b
+    /// @param a 基本块
+    /// @param b 基本块
+    /// @return true a严格支配b
+    ///
+    bool properlyDominates(BasicBlock * a, BasicBlock * b) const;
+
+    ///
+    /// @brief 判断基本块是否在树中，即从入口可达（后支配树时总是在树中）
+    /// @param bb 基本块
+    /// @return true 可达
+    ///
+    bool isReachable(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取基本块在支配树中的深度，根的深度为0
+    /// @param bb 基本块
+    /// @return int32_t 深度，不在树中时为-1
+    ///
+    int32_t getLevel(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取计算时所用的逆后序序列，只含有可达的基本块。后支配树时为逆向控制流图上的逆后序
+    /// @return const std::vector<BasicBlock *>& 逆后序序列
+    ///
+    const std::vector<BasicBlock *> & getRPO() const;
+
+    ///
+    /// @brief 按支配树先序遍历得到的基本块序列，子节点按逆后序
+    /// @return std::vector<BasicBlock *> 先序序列
+    ///
+    std::vector<BasicBlock *> getPreOrder() const;
+
+private:
+    ///
+    /// @brief 计算逆后序，并记录每个基本块的逆后序编号
+    ///
+    void computeRPO();
+
+    ///
+    /// @brief 迭代计算直接支配者
+    ///
+    void computeIDom();
+
+    ///
+    /// @brief 建立支配树的孩子列表、深度以及先序区间编号
+    ///
+    void buildTree();
+
+    ///
+    /// @brief 计算支配边界
+    ///
+    void computeFrontier();
+
+    ///
+    /// @brief 获取计算方向上的前驱，后支配树时为控制流图上的后继
+    /// @param bb 基本块
+    /// @return std::vector<BasicBlock *>& 前驱列表
+    ///
+    std::vector<BasicBlock *> & preds(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取计算方向上的后继，后支配树时为控制流图上的前驱
+    /// @param bb 基本块
+    /// @return std::vector<BasicBlock *>& 后继列表
+    ///
+    std::vector<BasicBlock *> & succs(BasicBlock * bb) const;
+
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 是否是后支配树
+    ///
+    bool post;
+
+    ///
+    /// @brief 计算时的控制流图版本
+    ///
+    uint64_t cfgVersion = 0;
+
+    ///
+    /// @brief 逆后序序列
+    ///
+    std::vector<BasicBlock *> rpo;
+
+    ///
+    /// @brief 基本块的逆后序编号，按基本块的布局序号索引，-1表示不可达。虚拟出口的编号为0
+    ///
+    std::vector<int32_t> rpoNumber;
+
+    ///
+    /// @brief 按逆后序编号索引的前驱起始位置，第k个节点的前驱为predList[predOffset[k], predOffset[k+1])
+    ///
+    std::vector<int32_t> predOffset;
+
+    ///
+    /// @brief 计算方向上的前驱的逆后序编号，不含不可达的前驱，后支配树的根含有虚拟出口0
+    ///
+    std::vector<int32_t> predList;
+
+    ///
+    /// @brief 直接支配者的逆后序编号，按逆后序编号索引，0号为根（后支配树时为虚拟出口）
+    ///
+    std::vector<int32_t> idom;
+
+    ///
+    /// @brief 支配树的孩子列表，按基本块的布局序号索引
+    ///
+    std::vector<std::vector<BasicBlock *>> children;
+
+    ///
+    /// @brief 支配树的根
+    ///
+    std::vector<BasicBlock *> roots;
+
+    ///
+    /// @brief 支配边界，按基本块的布局序号索引
+    ///
+    std::vector<std::vector<BasicBlock *>> frontier;
+
+    ///
+    /// @brief 支配树中的深度，按基本块的布局序号索引
+    ///
+    std::vector<int32_t> level;
+
+    ///
+    /// @brief 支配树先序遍历的进入编号，按基本块的布局序号索引
+    ///
+    std::vector<int32_t> dfsIn;
+
+    ///
+    /// @brief 支配树先序遍历的离开编号，按基本块的布局序号索引
+    ///
+    std::vector<int32_t> dfsOut;
+};
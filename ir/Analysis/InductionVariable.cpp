@@ -0,0 +1,369 @@
+///
+/// @file InductionVariable.cpp
+/// @brief 归纳变量的识别与循环迭代次数的计算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <limits>
+
+#include "InductionVariable.h"
+#include "LoopInfo.h"
+#include "ConstantFold.h"
+#include "Function.h"
+#include "ConstInt.h"
+#include "CondBrInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数，构造时即完成计算
+/// @param _loop 循环
+///
+InductionVariableInfo::InductionVariableInfo(Loop * _loop) : loop(_loop)
+{
+    preheader = loop->getPreheader();
+    latch = loop->getLatch();
+
+    if (!preheader || !latch) {
+        return;
+    }
+
+    findInductionVariables();
+    computeTripCount();
+}
+
+///
+/// @brief 获取循环
+/// @return Loop* 循环
+///
+Loop * InductionVariableInfo::getLoop() const
+{
+    return loop;
+}
+
+///
+/// @brief 获取所有的基本归纳变量
+/// @return const std::vector<InductionVariable>& 归纳变量列表
+///
+const std::vector<InductionVariable> & InductionVariableInfo::getInductionVariables() const
+{
+    return ivs;
+}
+
+///
+/// @brief 按Phi指令或next查找基本归纳变量
+/// @param val 值
+/// @return const InductionVariable* 归纳变量，不是时返回nullptr
+///
+const InductionVariable * InductionVariableInfo::getInductionVariable(Value * val) const
+{
+    for (auto & iv: ivs) {
+        if (val == iv.phi || val == iv.next) {
+            return &iv;
+        }
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 判断值在循环内是否不变：常量，或者定义在循环外的指令
+/// @param val 值
+/// @return true 不变
+///
+bool InductionVariableInfo::isInvariant(Value * val) const
+{
+    if (dynamic_cast<ConstInt *>(val)) {
+        return true;
+    }
+
+    auto inst = dynamic_cast<Instruction *>(val);
+    return inst && inst->hasResultValue() && !loop->contains(inst->getParent());
+}
+
+///
+/// @brief 获取决定出口的比较指令
+/// @return Instruction* 比较指令，出口条件不是归纳变量与循环不变量的比较时为nullptr
+///
+Instruction * InductionVariableInfo::getExitCompare() const
+{
+    return exitCompare;
+}
+
+///
+/// @brief 获取出口比较的归纳变量
+/// @return const InductionVariable* 归纳变量，没有时为nullptr
+///
+const InductionVariable * InductionVariableInfo::getExitVariable() const
+{
+    return exitIV == -1 ? nullptr : &ivs[exitIV];
+}
+
+///
+/// @brief 获取规范后的出口比较运算符，即exitVariable op exitBound成立时留在循环内
+/// @return IRInstOperator 比较运算符
+///
+IRInstOperator InductionVariableInfo::getExitPredicate() const
+{
+    return exitPredicate;
+}
+
+///
+/// @brief 获取出口比较的另一侧，常量或者循环不变量
+/// @return Value* 比较的界限
+///
+Value * InductionVariableInfo::getExitBound() const
+{
+    return exitBound;
+}
+
+///
+/// @brief 出口比较的是否为归纳变量的next
+/// @return true 比较next，false 比较Phi指令
+///
+bool InductionVariableInfo::isExitOnNext() const
+{
+    return exitOnNext;
+}
+
+///
+/// @brief 出口是否在latch，即先执行循环体再判断
+/// @return true 在latch，false 在循环头
+///
+bool InductionVariableInfo::isExitAtLatch() const
+{
+    return exitAtLatch;
+}
+
+///
+/// @brief 是否求出了精确的迭代次数
+/// @return true 求出了
+///
+bool InductionVariableInfo::hasTripCount() const
+{
+    return tripCount >= 0;
+}
+
+///
+/// @brief 获取迭代次数，即循环体执行的次数
+/// @return int64_t 迭代次数，不能精确计算时为-1
+///
+int64_t InductionVariableInfo::getTripCount() const
+{
+    return tripCount;
+}
+
+///
+/// @brief 识别循环头中的基本归纳变量
+///
+void InductionVariableInfo::findInductionVariables()
+{
+    BasicBlock * header = loop->getHeader();
+
+    for (auto inst: header->getInsts()) {
+
+        if (inst == header->getLabel()) {
+            continue;
+        }
+
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            break;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(inst);
+        if (phi->getIncomingNum() != 2) {
+            continue;
+        }
+
+        Value * init = phi->getIncomingValueForBlock(preheader);
+        auto next = dynamic_cast<Instruction *>(phi->getIncomingValueForBlock(latch));
+        if (!init || !next || !loop->contains(next->getParent())) {
+            continue;
+        }
+
+        // next为phi + c、c + phi或者phi - c
+        Value * lhs = next->getOperandsNum() == 2 ? next->getOperand(0) : nullptr;
+        Value * rhs = next->getOperandsNum() == 2 ? next->getOperand(1) : nullptr;
+        ConstInt * stepConst = nullptr;
+        bool negate = false;
+
+        if (next->getOp() == IRInstOperator::IRINST_OP_ADD_I) {
+            if (lhs == phi) {
+                stepConst = dynamic_cast<ConstInt *>(rhs);
+            } else if (rhs == phi) {
+                stepConst = dynamic_cast<ConstInt *>(lhs);
+            }
+        } else if (next->getOp() == IRInstOperator::IRINST_OP_SUB_I && lhs == phi) {
+            stepConst = dynamic_cast<ConstInt *>(rhs);
+            negate = true;
+        }
+
+        if (!stepConst) {
+            continue;
+        }
+
+        int32_t step = stepConst->getVal();
+        if (negate) {
+            if (step == std::numeric_limits<int32_t>::min()) {
+                continue;
+            }
+            step = -step;
+        }
+
+        InductionVariable iv;
+        iv.phi = phi;
+        iv.init = init;
+        iv.next = next;
+        iv.step = step;
+        ivs.push_back(iv);
+    }
+}
+
+///
+/// @brief 识别出口条件并计算迭代次数
+///
+void InductionVariableInfo::computeTripCount()
+{
+    if (loop->getExitingBlocks().size() != 1) {
+        return;
+    }
+
+    // 循环头同时是latch时，循环体在比较之前执行，按出口在latch处理
+    BasicBlock * exiting = loop->getExitingBlocks().front();
+    if (exiting == latch) {
+        exitAtLatch = true;
+    } else if (exiting != loop->getHeader()) {
+        return;
+    }
+
+    Instruction * term = exiting->getTerminator();
+    if (!term || term->getOp() != IRInstOperator::IRINST_OP_COND_BR) {
+        return;
+    }
+
+    auto condBr = static_cast<CondBrInstruction *>(term);
+    auto cond = dynamic_cast<Instruction *>(condBr->getCondition());
+    if (!cond || !isComparison(cond->getOp()) || cond->getOperandsNum() != 2) {
+        return;
+    }
+
+    // 规范为iv op bound，op成立时留在循环内
+    IRInstOperator op = cond->getOp();
+    const InductionVariable * iv = getInductionVariable(cond->getOperand(0));
+    Value * boundVal = cond->getOperand(1);
+    Value * ivVal = cond->getOperand(0);
+
+    if (!iv || !isInvariant(boundVal)) {
+        iv = getInductionVariable(cond->getOperand(1));
+        boundVal = cond->getOperand(0);
+        ivVal = cond->getOperand(1);
+        op = swapComparison(op);
+    }
+
+    if (!iv || !isInvariant(boundVal)) {
+        return;
+    }
+
+    if (!loop->contains(condBr->getTrueTarget()->getParent())) {
+        op = invertComparison(op);
+    }
+
+    exitCompare = cond;
+    exitIV = (int32_t) (iv - ivs.data());
+    exitOnNext = ivVal == iv->next;
+    exitPredicate = op;
+    exitBound = boundVal;
+
+    auto init = dynamic_cast<ConstInt *>(iv->init);
+    auto bound = dynamic_cast<ConstInt *>(boundVal);
+    if (!init || !bound) {
+        return;
+    }
+
+    int64_t start = (int64_t) init->getVal() + (exitOnNext ? iv->step : 0);
+    if (start < std::numeric_limits<int32_t>::min() || start > std::numeric_limits<int32_t>::max()) {
+        return;
+    }
+
+    int64_t count;
+    if (!countIterations(op, start, iv->step, bound->getVal(), count)) {
+        return;
+    }
+
+    tripCount = exitAtLatch ? count + 1 : count;
+}
+
+///
+/// @brief 按比较求值：从start开始每次加step，计算连续满足value op bound的值的个数
+/// @param op 比较运算符
+/// @param start 第一个值
+/// @param step 增量
+/// @param bound 比较的常量
+/// @param count 满足的个数
+/// @return true 个数确定
+///
+bool InductionVariableInfo::countIterations(IRInstOperator op,
+                                            int64_t start,
+                                            int64_t step,
+                                            int64_t bound,
+                                            int64_t & count)
+{
+    switch (op) {
+        case IRInstOperator::IRINST_OP_LE_I:
+            bound += 1;
+            [[fallthrough]];
+        case IRInstOperator::IRINST_OP_LT_I:
+            if (start >= bound) {
+                count = 0;
+            } else if (step <= 0) {
+                return false;
+            } else {
+                count = (bound - start + step - 1) / step;
+            }
+            break;
+        case IRInstOperator::IRINST_OP_GE_I:
+            bound -= 1;
+            [[fallthrough]];
+        case IRInstOperator::IRINST_OP_GT_I:
+            if (start <= bound) {
+                count = 0;
+            } else if (step >= 0) {
+                return false;
+            } else {
+                count = (start - bound - step - 1) / (-step);
+            }
+            break;
+        case IRInstOperator::IRINST_OP_NEQ_I:
+            if (start == bound) {
+                count = 0;
+            } else if (step == 0 || (bound - start) % step != 0 || (bound - start) / step < 0) {
+                return false;
+            } else {
+                count = (bound - start) / step;
+            }
+            break;
+        case IRInstOperator::IRINST_OP_EQ_I:
+            if (start != bound) {
+                count = 0;
+            } else if (step == 0) {
+                return false;
+            } else {
+                count = 1;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    // 第一个不满足比较的值也要在int32的范围内，否则回绕后可能又满足比较
+    int64_t last = start + count * step;
+    return last >= std::numeric_limits<int32_t>::min() && last <= std::numeric_limits<int32_t>::max();
+}
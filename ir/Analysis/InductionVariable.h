@@ -0,0 +1,214 @@
+///
+/// @file InductionVariable.h
+/// @brief 归纳变量的识别与循环迭代次数的计算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Instruction.h"
+
+class Loop;
+class BasicBlock;
+class PhiInstruction;
+
+///
+/// @brief 基本归纳变量，即递推式{init, +, step}：循环头的Phi指令从前置基本块进入时取init，
+/// 从latch进入时取next，next为Phi指令加上常量step
+///
+struct InductionVariable {
+
+    /// @brief 循环头的Phi指令
+    PhiInstruction * phi = nullptr;
+
+    /// @brief 进入循环时的初值
+    Value * init = nullptr;
+
+    /// @brief 下一次迭代的值，phi + step
+    Instruction * next = nullptr;
+
+    /// @brief 每次迭代的增量
+    int32_t step = 0;
+};
+
+///
+/// @brief 循环的归纳变量与迭代次数。要求循环有前置基本块与唯一的latch。
+/// 迭代次数指latch执行的次数，即循环体执行的次数，在以下条件下可以精确计算：
+/// 循环只有一个出口基本块，且是循环头或者latch；出口条件为归纳变量（Phi指令或next）与常量的比较；
+/// 归纳变量的初值为常量；到比较不成立为止，参与比较的值都不超出int32的范围。
+/// 出口在循环头时迭代次数为比较成立的次数，出口在latch时先执行循环体再比较，还要加上1。
+/// 界限是循环不变量而不是常量时，仍然记录出口比较，供按运行时迭代次数展开等使用
+///
+class InductionVariableInfo {
+
+public:
+    ///
+    /// @brief 构造函数，构造时即完成计算
+    /// @param _loop 循环
+    ///
+    explicit InductionVariableInfo(Loop * _loop);
+
+    ///
+    /// @brief 获取循环
+    /// @return Loop* 循环
+    ///
+    Loop * getLoop() const;
+
+    ///
+    /// @brief 获取所有的基本归纳变量
+    /// @return const std::vector<InductionVariable>& 归纳变量列表
+    ///
+    const std::vector<InductionVariable> & getInductionVariables() const;
+
+    ///
+    /// @brief 按Phi指令或next查找基本归纳变量
+    /// @param val 值
+    /// @return const InductionVariable* 归纳变量，不是时返回nullptr
+    ///
+    const InductionVariable * getInductionVariable(Value * val) const;
+
+    ///
+    /// @brief 判断值在循环内是否不变：常量，或者定义在循环外的指令
+    /// @param val 值
+    /// @return true 不变
+    ///
+    bool isInvariant(Value * val) const;
+
+    ///
+    /// @brief 获取决定出口的比较指令
+    /// @return Instruction* 比较指令，出口条件不是归纳变量与循环不变量的比较时为nullptr
+    ///
+    Instruction * getExitCompare() const;
+
+    ///
+    /// @brief 获取出口比较的归纳变量
+    /// @return const InductionVariable* 归纳变量，没有时为nullptr
+    ///
+    const InductionVariable * getExitVariable() const;
+
+    ///
+    /// @brief 获取规范后的出口比较运算符，即exitVariable op exitBound成立时留在循环内
+    /// @return IRInstOperator 比较运算符
+    ///
+    IRInstOperator getExitPredicate() const;
+
+    ///
+    /// @brief 获取出口比较的另一侧，常量或者循环不变量
+    /// @return Value* 比较的界限
+    ///
+    Value * getExitBound() const;
+
+    ///
+    /// @brief 出口比较的是否为归纳变量的next
+    /// @return true 比较next，false 比较Phi指令
+    ///
+    bool isExitOnNext() const;
+
+    ///
+    /// @brief 出口是否在latch，即先执行循环体再判断
+    /// @return true 在latch，false 在循环头
+    ///
+    bool isExitAtLatch() const;
+
+    ///
+    /// @brief 是否求出了精确的迭代次数
+    /// @return true 求出了
+    ///
+    bool hasTripCount() const;
+
+    ///
+    /// @brief 获取迭代次数，即循环体执行的次数
+    /// @return int64_t 迭代次数，不能精确计算时为-1
+    ///
+    int64_t getTripCount() const;
+
+    ///
+    /// @brief 按比较求值：从start开始每次加step，计算连续满足value op bound的值的个数。
+    /// 第一个不满足的值也会被计算出来，它超出int32的范围时运算会回绕，结果不确定
+    /// @param op 比较运算符
+    /// @param start 第一个值
+    /// @param step 增量
+    /// @param bound 比较的常量
+    /// @param count 满足的个数
+    /// @return true 个数确定
+    ///
+    static bool countIterations(IRInstOperator op, int64_t start, int64_t step, int64_t bound, int64_t & count);
+
+private:
+    ///
+    /// @brief 识别循环头中的基本归纳变量
+    ///
+    void findInductionVariables();
+
+    ///
+    /// @brief 识别出口条件并计算迭代次数
+    ///
+    void computeTripCount();
+
+    ///
+    /// @brief 循环
+    ///
+    Loop * loop;
+
+    ///
+    /// @brief 前置基本块
+    ///
+    BasicBlock * preheader = nullptr;
+
+    ///
+    /// @brief 唯一的latch
+    ///
+    BasicBlock * latch = nullptr;
+
+    ///
+    /// @brief 基本归纳变量
+    ///
+    std::vector<InductionVariable> ivs;
+
+    ///
+    /// @brief 决定出口的比较指令
+    ///
+    Instruction * exitCompare = nullptr;
+
+    ///
+    /// @brief 出口比较的归纳变量在ivs中的序号
+    ///
+    int32_t exitIV = -1;
+
+    ///
+    /// @brief 规范后的出口比较运算符
+    ///
+    IRInstOperator exitPredicate = IRInstOperator::IRINST_OP_MAX;
+
+    ///
+    /// @brief 出口比较的界限
+    ///
+    Value * exitBound = nullptr;
+
+    ///
+    /// @brief 出口比较的是否为next
+    ///
+    bool exitOnNext = false;
+
+    ///
+    /// @brief 出口是否在latch
+    ///
+    bool exitAtLatch = false;
+
+    ///
+    /// @brief 迭代次数，不能精确计算时为-1
+    ///
+    int64_t tripCount = -1;
+};
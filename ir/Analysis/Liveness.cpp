@@ -0,0 +1,337 @@
+///
+/// @file Liveness.cpp
+/// @brief 活跃变量分析，给出基本块入口、出口的活跃集合以及值的活跃区间
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "Liveness.h"
+#include "Function.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 函数
+/// @param _trackVariables true 变量模式，同时跟踪局部变量；false SSA模式
+///
+Liveness::Liveness(Function * _func, bool _trackVariables) : func(_func), trackVariables(_trackVariables)
+{}
+
+///
+/// @brief 计算活跃集合与活跃区间，函数修改后需要重新创建分析
+///
+void Liveness::run()
+{
+    numberValues();
+
+    collectDefUses();
+
+    propagate();
+
+    computeRanges();
+}
+
+///
+/// @brief 获取值的编号，即活跃集合中的位号
+/// @param val 值
+/// @return int32_t 编号，不跟踪的值返回-1
+///
+int32_t Liveness::getValueNo(Value * val) const
+{
+    return numbering.getNo(val);
+}
+
+///
+/// @brief 获取编号对应的值
+/// @param no 编号
+/// @return Value* 值
+///
+Value * Liveness::getValue(int32_t no) const
+{
+    return numbering.getValue(no);
+}
+
+///
+/// @brief 获取跟踪的值的个数
+/// @return int32_t 个数
+///
+int32_t Liveness::getValueNum() const
+{
+    return numbering.size();
+}
+
+///
+/// @brief 获取基本块入口处活跃的值
+/// @param bb 基本块
+/// @return const BitVector& 按值编号的集合
+///
+const BitVector & Liveness::getLiveIn(BasicBlock * bb) const
+{
+    return liveIns[bb->getIndex()];
+}
+
+///
+/// @brief 获取基本块出口处活跃的值，包括作为后继Phi指令来源的值
+/// @param bb 基本块
+/// @return const BitVector& 按值编号的集合
+///
+const BitVector & Liveness::getLiveOut(BasicBlock * bb) const
+{
+    return liveOuts[bb->getIndex()];
+}
+
+///
+/// @brief 判断值在基本块入口处是否活跃
+/// @param bb 基本块
+/// @param val 值
+/// @return true 活跃
+///
+bool Liveness::isLiveIn(BasicBlock * bb, Value * val) const
+{
+    int32_t no = getValueNo(val);
+    return no != -1 && liveIns[bb->getIndex()].test(no);
+}
+
+///
+/// @brief 判断值在基本块出口处是否活跃
+/// @param bb 基本块
+/// @param val 值
+/// @return true 活跃
+///
+bool Liveness::isLiveOut(BasicBlock * bb, Value * val) const
+{
+    int32_t no = getValueNo(val);
+    return no != -1 && liveOuts[bb->getIndex()].test(no);
+}
+
+///
+/// @brief 获取指令的线性位置，按基本块的布局顺序从0开始编号
+/// @param inst 指令
+/// @return int32_t 位置，不在基本块内的指令返回-1
+///
+int32_t Liveness::getPosition(Instruction * inst) const
+{
+    auto iter = positions.find(inst);
+    return iter == positions.end() ? -1 : iter->second;
+}
+
+///
+/// @brief 获取值的活跃区间
+/// @param val 值
+/// @return LiveRange 活跃区间，不跟踪的值为空区间
+///
+LiveRange Liveness::getLiveRange(Value * val) const
+{
+    int32_t no = getValueNo(val);
+    return no == -1 ? LiveRange() : ranges[no];
+}
+
+///
+/// @brief 获取编号对应的值的活跃区间
+/// @param no 值编号
+/// @return const LiveRange& 活跃区间
+///
+const LiveRange & Liveness::getLiveRange(int32_t no) const
+{
+    return ranges[no];
+}
+
+///
+/// @brief 对跟踪的值编号，对指令按布局顺序编排位置
+///
+void Liveness::numberValues()
+{
+    numbering.numberInstructions(func);
+    if (trackVariables) {
+        numbering.numberVariables(func);
+    }
+
+    int32_t pos = 0;
+    for (auto bb: func->getBasicBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            positions[inst] = pos++;
+        }
+    }
+}
+
+///
+/// @brief 计算每个基本块定值的值，收集向上暴露的使用
+///
+void Liveness::collectDefUses()
+{
+    int32_t valueNum = numbering.size();
+
+    defs.assign(func->getBasicBlocks().size(), BitVector(valueNum));
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        int32_t bbNo = bb->getIndex();
+        BitVector & bbDefs = defs[bbNo];
+
+        for (auto inst: bb->getInsts()) {
+
+            if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                // Phi指令的来源值在前驱基本块的出口处使用
+                auto phi = static_cast<PhiInstruction *>(inst);
+                for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+                    int32_t no = getValueNo(phi->getIncomingValue(k));
+                    if (no != -1) {
+                        phiUses.emplace_back(phi->getIncomingBlock(k)->getIndex(), no);
+                    }
+                }
+            } else {
+                // 同一指令的使用先于定值，基本块内此前没有定值的使用是向上暴露的
+                for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                    if (!isUseOperand(inst, k)) {
+                        continue;
+                    }
+                    int32_t no = getValueNo(inst->getOperand(k));
+                    if (no != -1 && !bbDefs.test(no)) {
+                        upwardUses.emplace_back(bbNo, no);
+                    }
+                }
+            }
+
+            int32_t defNo = getDefNo(inst);
+            if (defNo != -1) {
+                bbDefs.set(defNo);
+            }
+        }
+    }
+}
+
+///
+/// @brief 从向上暴露的使用出发沿前驱回溯，计算活跃集合
+///
+void Liveness::propagate()
+{
+    std::vector<BasicBlock *> & blocks = func->getBasicBlocks();
+    int32_t valueNum = numbering.size();
+
+    liveIns.assign(blocks.size(), BitVector(valueNum));
+    liveOuts.assign(blocks.size(), BitVector(valueNum));
+
+    // 入口处新变为活跃的(基本块, 值)，需要继续向前驱传播
+    std::vector<std::pair<int32_t, int32_t>> worklist;
+
+    auto markLiveIn = [&](int32_t bbNo, int32_t no) {
+        if (!liveIns[bbNo].test(no)) {
+            liveIns[bbNo].set(no);
+            worklist.emplace_back(bbNo, no);
+        }
+    };
+
+    // 出口活跃且基本块内没有定值的值，入口处也活跃
+    auto markLiveOut = [&](int32_t bbNo, int32_t no) {
+        if (!liveOuts[bbNo].test(no)) {
+            liveOuts[bbNo].set(no);
+            if (!defs[bbNo].test(no)) {
+                markLiveIn(bbNo, no);
+            }
+        }
+    };
+
+    for (auto & use: phiUses) {
+        markLiveOut(use.first, use.second);
+    }
+
+    for (auto & use: upwardUses) {
+        markLiveIn(use.first, use.second);
+    }
+
+    while (!worklist.empty()) {
+
+        auto item = worklist.back();
+        worklist.pop_back();
+
+        for (auto pred: blocks[item.first]->getPredecessors()) {
+            markLiveOut(pred->getIndex(), item.second);
+        }
+    }
+
+    // 只在计算过程中使用
+    upwardUses.clear();
+    phiUses.clear();
+}
+
+///
+/// @brief 计算每个值的活跃区间
+///
+void Liveness::computeRanges()
+{
+    ranges.assign((size_t) numbering.size(), LiveRange());
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        int32_t bbNo = bb->getIndex();
+        int32_t from = getPosition(bb->getLabel());
+        int32_t pos = from;
+
+        for (auto inst: bb->getInsts()) {
+
+            if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                    int32_t no = isUseOperand(inst, k) ? getValueNo(inst->getOperand(k)) : -1;
+                    if (no != -1) {
+                        ranges[no].extend(pos);
+                    }
+                }
+            }
+
+            int32_t defNo = getDefNo(inst);
+            if (defNo != -1) {
+                ranges[defNo].extend(pos);
+            }
+
+            pos++;
+        }
+
+        // 入口活跃的值从基本块开始处活跃，出口活跃的值一直活跃到基本块结束处
+        const BitVector & liveIn = liveIns[bbNo];
+        for (int32_t no = liveIn.findFirst(); no != -1; no = liveIn.findNext(no)) {
+            ranges[no].extend(from);
+        }
+
+        const BitVector & liveOut = liveOuts[bbNo];
+        for (int32_t no = liveOut.findFirst(); no != -1; no = liveOut.findNext(no)) {
+            ranges[no].extend(pos - 1);
+        }
+    }
+}
+
+///
+/// @brief 获取指令定值的值，Move指令定值其目的操作数
+/// @param inst 指令
+/// @return int32_t 值编号，不定值跟踪的值时返回-1
+///
+int32_t Liveness::getDefNo(Instruction * inst) const
+{
+    if (inst->hasResultValue()) {
+        return getValueNo(inst);
+    }
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+        return getValueNo(inst->getOperand(0));
+    }
+
+    return -1;
+}
+
+///
+/// @brief 判断指令的第k个操作数是否为使用
+/// @param inst 指令
+/// @param k 操作数序号
+/// @return true 是使用
+///
+bool Liveness::isUseOperand(Instruction * inst, int32_t k) const
+{
+    return !((inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) && (k == 0));
+}
@@ -0,0 +1,259 @@
+///
+/// @file Liveness.h
+/// @brief 活跃变量分析，给出基本块入口、出口的活跃集合以及值的活跃区间
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BitVector.h"
+#include "ValueNumbering.h"
+
+class Function;
+class BasicBlock;
+class Instruction;
+class Value;
+
+///
+/// @brief 活跃区间，端点为指令的线性位置，两端都包含在内。
+/// 区间是值所有活跃位置的包络，两个区间不相交时两个值一定不会同时活跃
+///
+struct LiveRange {
+
+    /// @brief 起始位置，-1表示空区间
+    int32_t start = -1;
+
+    /// @brief 结束位置
+    int32_t end = -1;
+
+    ///
+    /// @brief 是否为空区间
+    /// @return true 空
+    ///
+    bool empty() const
+    {
+        return start == -1;
+    }
+
+    ///
+    /// @brief 把位置并入区间
+    /// @param pos 位置
+    ///
+    void extend(int32_t pos)
+    {
+        if (start == -1 || pos < start) {
+            start = pos;
+        }
+        if (pos > end) {
+            end = pos;
+        }
+    }
+
+    ///
+    /// @brief 判断两个区间是否相交
+    /// @param other 另一个区间
+    /// @return true 相交
+    ///
+    bool overlaps(const LiveRange & other) const
+    {
+        return !empty() && !other.empty() && start <= other.end && other.start <= end;
+    }
+};
+
+///
+/// @brief 活跃变量分析，函数必须已经划分基本块。分两种模式：
+/// (1) SSA模式只跟踪有值的指令，每个值只有一个定值；Phi指令的来源值在对应前驱基本块的出口处使用，
+///     Phi指令本身在所在基本块的入口处定值；
+/// (2) 变量模式在有值的指令之外还跟踪局部变量，一个变量可有多个定值。
+/// 两种模式下Move指令的目的操作数都是定值而不是使用。
+/// 活跃集合按Appel的逐变量路径探索计算：从每个向上暴露的使用沿前驱回溯，直到遇到定值所在的基本块，
+/// 每个(基本块, 值)对只处理一次，计算量与活跃集合的总大小成正比，不需要数据流迭代。
+/// 活跃区间在指令按布局顺序线性编号后，由各基本块的活跃集合与块内的定值、使用位置求包络得到
+///
+class Liveness {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 函数
+    /// @param _trackVariables true 变量模式，同时跟踪局部变量；false SSA模式
+    ///
+    Liveness(Function * _func, bool _trackVariables);
+
+    ///
+    /// @brief 计算活跃集合与活跃区间，函数修改后需要重新创建分析
+    ///
+    void run();
+
+    ///
+    /// @brief 获取值的编号，即活跃集合中的位号
+    /// @param val 值
+    /// @return int32_t 编号，不跟踪的值返回-1
+    ///
+    int32_t getValueNo(Value * val) const;
+
+    ///
+    /// @brief 获取编号对应的值
+    /// @param no 编号
+    /// @return Value* 值
+    ///
+    Value * getValue(int32_t no) const;
+
+    ///
+    /// @brief 获取跟踪的值的个数
+    /// @return int32_t 个数
+    ///
+    int32_t getValueNum() const;
+
+    ///
+    /// @brief 获取基本块入口处活跃的值
+    /// @param bb 基本块
+    /// @return const BitVector& 按值编号的集合
+    ///
+    const BitVector & getLiveIn(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取基本块出口处活跃的值，包括作为后继Phi指令来源的值
+    /// @param bb 基本块
+    /// @return const BitVector& 按值编号的集合
+    ///
+    const BitVector & getLiveOut(BasicBlock * bb) const;
+
+    ///
+    /// @brief 判断值在基本块入口处是否活跃
+    /// @param bb 基本块
+    /// @param val 值
+    /// @return true 活跃
+    ///
+    bool isLiveIn(BasicBlock * bb, Value * val) const;
+
+    ///
+    /// @brief 判断值在基本块出口处是否活跃
+    /// @param bb 基本块
+    /// @param val 值
+    /// @return true 活跃
+    ///
+    bool isLiveOut(BasicBlock * bb, Value * val) const;
+
+    ///
+    /// @brief 获取指令的线性位置，按基本块的布局顺序从0开始编号
+    /// @param inst 指令
+    /// @return int32_t 位置，不在基本块内的指令返回-1
+    ///
+    int32_t getPosition(Instruction * inst) const;
+
+    ///
+    /// @brief 获取值的活跃区间
+    /// @param val 值
+    /// @return LiveRange 活跃区间，不跟踪的值为空区间
+    ///
+    LiveRange getLiveRange(Value * val) const;
+
+    ///
+    /// @brief 获取编号对应的值的活跃区间
+    /// @param no 值编号
+    /// @return const LiveRange& 活跃区间
+    ///
+    const LiveRange & getLiveRange(int32_t no) const;
+
+protected:
+    ///
+    /// @brief 对跟踪的值编号，对指令按布局顺序编排位置
+    ///
+    void numberValues();
+
+    ///
+    /// @brief 计算每个基本块定值的值，收集向上暴露的使用
+    ///
+    void collectDefUses();
+
+    ///
+    /// @brief 从向上暴露的使用出发沿前驱回溯，计算活跃集合
+    ///
+    void propagate();
+
+    ///
+    /// @brief 计算每个值的活跃区间
+    ///
+    void computeRanges();
+
+    ///
+    /// @brief 获取指令定值的值，Move指令定值其目的操作数
+    /// @param inst 指令
+    /// @return int32_t 值编号，不定值跟踪的值时返回-1
+    ///
+    int32_t getDefNo(Instruction * inst) const;
+
+    ///
+    /// @brief 判断指令的第k个操作数是否为使用
+    /// @param inst 指令
+    /// @param k 操作数序号
+    /// @return true 是使用
+    ///
+    bool isUseOperand(Instruction * inst, int32_t k) const;
+
+private:
+    ///
+    /// @brief 要分析的函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 是否同时跟踪局部变量
+    ///
+    bool trackVariables;
+
+    ///
+    /// @brief 跟踪的值的稠密编号
+    ///
+    ValueNumbering numbering;
+
+    ///
+    /// @brief 指令的线性位置
+    ///
+    std::unordered_map<Instruction *, int32_t> positions;
+
+    ///
+    /// @brief 按基本块布局序号索引的基本块内定值的值
+    ///
+    std::vector<BitVector> defs;
+
+    ///
+    /// @brief 向上暴露的使用，每项为(基本块布局序号, 值编号)，值在该基本块入口活跃
+    ///
+    std::vector<std::pair<int32_t, int32_t>> upwardUses;
+
+    ///
+    /// @brief 作为Phi指令来源的使用，每项为(前驱基本块布局序号, 值编号)，值在该基本块出口活跃
+    ///
+    std::vector<std::pair<int32_t, int32_t>> phiUses;
+
+    ///
+    /// @brief 按基本块布局序号索引的入口活跃集合
+    ///
+    std::vector<BitVector> liveIns;
+
+    ///
+    /// @brief 按基本块布局序号索引的出口活跃集合
+    ///
+    std::vector<BitVector> liveOuts;
+
+    ///
+    /// @brief 按值编号索引的活跃区间
+    ///
+    std::vector<LiveRange> ranges;
+};
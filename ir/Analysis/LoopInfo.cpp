@@ -0,0 +1,420 @@
+///
+/// @file LoopInfo.cpp
+/// @brief 自然循环的识别与循环嵌套树
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+
+#include "LoopInfo.h"
+#include "DominatorTree.h"
+#include "Function.h"
+
+///
+/// @brief 构造函数
+/// @param _header 循环头
+///
+Loop::Loop(BasicBlock * _header) : header(_header)
+{
+    blocks.push_back(header);
+    blockSet.insert(header);
+}
+
+///
+/// @brief 获取循环头
+/// @return BasicBlock* 循环头
+///
+BasicBlock * Loop::getHeader() const
+{
+    return header;
+}
+
+///
+/// @brief 获取外层循环
+/// @return Loop* 外层循环，最外层循环时为nullptr
+///
+Loop * Loop::getParentLoop() const
+{
+    return parent;
+}
+
+///
+/// @brief 获取直接内层循环
+/// @return const std::vector<Loop *>& 内层循环列表
+///
+const std::vector<Loop *> & Loop::getSubLoops() const
+{
+    return subLoops;
+}
+
+///
+/// @brief 获取循环的基本块，含内层循环的基本块
+/// @return const std::vector<BasicBlock *>& 基本块列表，第一个为循环头
+///
+const std::vector<BasicBlock *> & Loop::getBlocks() const
+{
+    return blocks;
+}
+
+///
+/// @brief 判断基本块是否在循环内
+/// @param bb 基本块
+/// @return true 在循环内
+///
+bool Loop::contains(BasicBlock * bb) const
+{
+    return blockSet.count(bb) != 0;
+}
+
+///
+/// @brief 判断另一个循环是否为本循环或者嵌套在本循环内
+/// @param loop 循环
+/// @return true 嵌套在内
+///
+bool Loop::contains(const Loop * loop) const
+{
+    while (loop && loop->depth > depth) {
+        loop = loop->parent;
+    }
+
+    return loop == this;
+}
+
+///
+/// @brief 获取循环的嵌套深度，最外层循环为1
+/// @return int32_t 深度
+///
+int32_t Loop::getLoopDepth() const
+{
+    return depth;
+}
+
+///
+/// @brief 获取通过回边跳转到循环头的基本块
+/// @return const std::vector<BasicBlock *>& latch列表
+///
+const std::vector<BasicBlock *> & Loop::getLatches() const
+{
+    return latches;
+}
+
+///
+/// @brief 获取唯一的latch
+/// @return BasicBlock* latch，有多个时返回nullptr
+///
+BasicBlock * Loop::getLatch() const
+{
+    return latches.size() == 1 ? latches.front() : nullptr;
+}
+
+///
+/// @brief 获取有后继在循环外的循环内基本块
+/// @return const std::vector<BasicBlock *>& 基本块列表
+///
+const std::vector<BasicBlock *> & Loop::getExitingBlocks() const
+{
+    return exitingBlocks;
+}
+
+///
+/// @brief 获取循环外有前驱在循环内的基本块，即循环的出口
+/// @return const std::vector<BasicBlock *>& 基本块列表
+///
+const std::vector<BasicBlock *> & Loop::getExitBlocks() const
+{
+    return exitBlocks;
+}
+
+///
+/// @brief 获取前置基本块：循环头在循环外的唯一前驱，且该前驱只有循环头一个后继
+/// @return BasicBlock* 前置基本块，不存在时返回nullptr
+///
+BasicBlock * Loop::getPreheader() const
+{
+    BasicBlock * preheader = nullptr;
+
+    for (auto pred: header->getPredecessors()) {
+
+        if (contains(pred)) {
+            continue;
+        }
+
+        if (preheader && (preheader != pred)) {
+            return nullptr;
+        }
+
+        preheader = pred;
+    }
+
+    if (!preheader || (preheader->getSuccessors().size() != 1)) {
+        return nullptr;
+    }
+
+    return preheader;
+}
+
+///
+/// @brief 构造函数，构造时即完成计算
+/// @param _func 函数
+///
+LoopInfo::LoopInfo(Function * _func) : func(_func)
+{
+    compute();
+}
+
+///
+/// @brief 析构函数
+///
+LoopInfo::~LoopInfo()
+{
+    clear();
+}
+
+///
+/// @brief 控制流图改变后重新计算
+///
+void LoopInfo::recalculate()
+{
+    clear();
+    compute();
+}
+
+///
+/// @brief 获取计算时控制流图的版本
+/// @return uint64_t 版本
+///
+uint64_t LoopInfo::getCFGVersion() const
+{
+    return cfgVersion;
+}
+
+///
+/// @brief 获取包含基本块的最内层循环
+/// @param bb 基本块
+/// @return Loop* 循环，不在循环内时为nullptr
+///
+Loop * LoopInfo::getLoopFor(BasicBlock * bb) const
+{
+    return blockLoops[bb->getIndex()];
+}
+
+///
+/// @brief 获取基本块的循环嵌套深度
+/// @param bb 基本块
+/// @return int32_t 深度，不在循环内时为0
+///
+int32_t LoopInfo::getLoopDepth(BasicBlock * bb) const
+{
+    Loop * loop = getLoopFor(bb);
+    return loop ? loop->getLoopDepth() : 0;
+}
+
+///
+/// @brief 判断基本块是否为循环头
+/// @param bb 基本块
+/// @return true 是循环头
+///
+bool LoopInfo::isLoopHeader(BasicBlock * bb) const
+{
+    Loop * loop = getLoopFor(bb);
+    return loop && (loop->getHeader() == bb);
+}
+
+///
+/// @brief 获取所有的循环，内层循环在外层循环之前
+/// @return const std::vector<Loop *>& 循环列表
+///
+const std::vector<Loop *> & LoopInfo::getLoops() const
+{
+    return loops;
+}
+
+///
+/// @brief 获取最外层的循环
+/// @return const std::vector<Loop *>& 循环列表
+///
+const std::vector<Loop *> & LoopInfo::getTopLevelLoops() const
+{
+    return topLevelLoops;
+}
+
+///
+/// @brief 输出循环嵌套树，用于调试
+/// @param str 输出的字符串
+///
+void LoopInfo::toString(std::string & str) const
+{
+    // 外层循环在后，逆序输出时外层先于内层
+    for (auto iter = loops.rbegin(); iter != loops.rend(); ++iter) {
+
+        Loop * loop = *iter;
+
+        str += std::string((size_t) (loop->getLoopDepth() - 1) * 4, ' ');
+        str += "loop " + loop->getHeader()->getIRName() + " depth " + std::to_string(loop->getLoopDepth()) + ":";
+        for (auto bb: loop->getBlocks()) {
+            str += " " + bb->getIRName();
+        }
+        str += "\n";
+    }
+}
+
+///
+/// @brief 识别自然循环，建立循环嵌套树
+///
+void LoopInfo::compute()
+{
+    cfgVersion = func->getCFGVersion();
+    blockLoops.assign(func->getBasicBlocks().size(), nullptr);
+
+    DominatorTree * domTree = func->getDominatorTree();
+    std::vector<BasicBlock *> order = domTree->getPreOrder();
+
+    // 支配树先序的逆序，被支配的内层循环头先处理
+    for (auto iter = order.rbegin(); iter != order.rend(); ++iter) {
+
+        BasicBlock * header = *iter;
+
+        Loop * loop = nullptr;
+        for (auto pred: header->getPredecessors()) {
+
+            // 回边：目标支配源
+            if (domTree->isReachable(pred) && domTree->dominates(header, pred)) {
+                if (!loop) {
+                    loop = new Loop(header);
+                }
+                loop->latches.push_back(pred);
+            }
+        }
+
+        if (loop) {
+            loops.push_back(loop);
+            discover(loop);
+        }
+    }
+
+    populate();
+}
+
+///
+/// @brief 从latch沿前驱回溯，收集循环体并连接内层循环
+/// @param loop 循环
+///
+void LoopInfo::discover(Loop * loop)
+{
+    DominatorTree * domTree = func->getDominatorTree();
+    std::vector<BasicBlock *> worklist = loop->latches;
+
+    while (!worklist.empty()) {
+
+        BasicBlock * bb = worklist.back();
+        worklist.pop_back();
+
+        Loop * subLoop = blockLoops[bb->getIndex()];
+        if (!subLoop) {
+
+            // 尚未归属任何循环的基本块，属于本循环
+            blockLoops[bb->getIndex()] = loop;
+
+            if (bb != loop->header) {
+                for (auto pred: bb->getPredecessors()) {
+                    if (domTree->isReachable(pred)) {
+                        worklist.push_back(pred);
+                    }
+                }
+            }
+            continue;
+        }
+
+        // 已经属于某个内层循环，找到其最外层的循环，作为本循环的直接内层循环
+        while (subLoop->parent) {
+            subLoop = subLoop->parent;
+        }
+
+        if (subLoop == loop) {
+            continue;
+        }
+
+        subLoop->parent = loop;
+        loop->subLoops.push_back(subLoop);
+
+        // 跳过内层循环的循环体，从其循环头的前驱继续
+        for (auto pred: subLoop->header->getPredecessors()) {
+            if (domTree->isReachable(pred)) {
+                worklist.push_back(pred);
+            }
+        }
+    }
+}
+
+///
+/// @brief 计算每个循环的基本块列表、深度与出口
+///
+void LoopInfo::populate()
+{
+    // 外层循环在后，逆序处理时外层循环的深度先确定
+    for (auto iter = loops.rbegin(); iter != loops.rend(); ++iter) {
+
+        Loop * loop = *iter;
+        if (loop->parent) {
+            loop->depth = loop->parent->depth + 1;
+        } else {
+            loop->depth = 1;
+            topLevelLoops.push_back(loop);
+        }
+    }
+
+    // 按布局顺序把基本块加入所在的各层循环，循环头在构造时已加入
+    for (auto bb: func->getBasicBlocks()) {
+        for (Loop * loop = blockLoops[bb->getIndex()]; loop; loop = loop->parent) {
+            if (bb != loop->header) {
+                loop->blocks.push_back(bb);
+                loop->blockSet.insert(bb);
+            }
+        }
+    }
+
+    for (auto loop: loops) {
+        for (auto bb: loop->blocks) {
+
+            bool exiting = false;
+            for (auto succ: bb->getSuccessors()) {
+
+                if (loop->contains(succ)) {
+                    continue;
+                }
+
+                exiting = true;
+                if (std::find(loop->exitBlocks.begin(), loop->exitBlocks.end(), succ) == loop->exitBlocks.end()) {
+                    loop->exitBlocks.push_back(succ);
+                }
+            }
+
+            if (exiting) {
+                loop->exitingBlocks.push_back(bb);
+            }
+        }
+    }
+}
+
+///
+/// @brief 释放所有的循环
+///
+void LoopInfo::clear()
+{
+    for (auto loop: loops) {
+        delete loop;
+    }
+
+    loops.clear();
+    topLevelLoops.clear();
+    blockLoops.clear();
+}
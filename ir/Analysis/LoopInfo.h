@@ -0,0 +1,278 @@
+///
+/// @file LoopInfo.h
+/// @brief 自然循环的识别与循环嵌套树
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class Function;
+class BasicBlock;
+
+///
+/// @brief 自然循环。循环头支配循环内的所有基本块，回边的源基本块称为latch。
+/// 循环的基本块列表第一个为循环头，其余按布局顺序存放，包含内层循环的基本块
+///
+class Loop {
+
+    friend class LoopInfo;
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _header 循环头
+    ///
+    explicit Loop(BasicBlock * _header);
+
+    ///
+    /// @brief 获取循环头
+    /// @return BasicBlock* 循环头
+    ///
+    BasicBlock * getHeader() const;
+
+    ///
+    /// @brief 获取外层循环
+    /// @return Loop* 外层循环，最外层循环时为nullptr
+    ///
+    Loop * getParentLoop() const;
+
+    ///
+    /// @brief 获取直接内层循环
+    /// @return const std::vector<Loop *>& 内层循环列表
+    ///
+    const std::vector<Loop *> & getSubLoops() const;
+
+    ///
+    /// @brief 获取循环的基本块，含内层循环的基本块
+    /// @return const std::vector<BasicBlock *>& 基本块列表，第一个为循环头
+    ///
+    const std::vector<BasicBlock *> & getBlocks() const;
+
+    ///
+    /// @brief 判断基本块是否在循环内
+    /// @param bb 基本块
+    /// @return true 在循环内
+    ///
+    bool contains(BasicBlock * bb) const;
+
+    ///
+    /// @brief 判断另一个循环是否为本循环或者嵌套在本循环内
+    /// @param loop 循环
+    /// @return true 嵌套在内
+    ///
+    bool contains(const Loop * loop) const;
+
+    ///
+    /// @brief 获取循环的嵌套深度，最外层循环为1
+    /// @return int32_t 深度
+    ///
+    int32_t getLoopDepth() const;
+
+    ///
+    /// @brief 获取通过回边跳转到循环头的基本块
+    /// @return const std::vector<BasicBlock *>& latch列表
+    ///
+    const std::vector<BasicBlock *> & getLatches() const;
+
+    ///
+    /// @brief 获取唯一的latch
+    /// @return BasicBlock* latch，有多个时返回nullptr
+    ///
+    BasicBlock * getLatch() const;
+
+    ///
+    /// @brief 获取有后继在循环外的循环内基本块
+    /// @return const std::vector<BasicBlock *>& 基本块列表
+    ///
+    const std::vector<BasicBlock *> & getExitingBlocks() const;
+
+    ///
+    /// @brief 获取循环外有前驱在循环内的基本块，即循环的出口
+    /// @return const std::vector<BasicBlock *>& 基本块列表
+    ///
+    const std::vector<BasicBlock *> & getExitBlocks() const;
+
+    ///
+    /// @brief 获取前置基本块：循环头在循环外的唯一前驱，且该前驱只有循环头一个后继
+    /// @return BasicBlock* 前置基本块，不存在时返回nullptr
+    ///
+    BasicBlock * getPreheader() const;
+
+private:
+    ///
+    /// @brief 循环头
+    ///
+    BasicBlock * header;
+
+    ///
+    /// @brief 外层循环
+    ///
+    Loop * parent = nullptr;
+
+    ///
+    /// @brief 直接内层循环
+    ///
+    std::vector<Loop *> subLoops;
+
+    ///
+    /// @brief 循环的基本块
+    ///
+    std::vector<BasicBlock *> blocks;
+
+    ///
+    /// @brief 循环的基本块集合，用于快速判断
+    ///
+    std::unordered_set<BasicBlock *> blockSet;
+
+    ///
+    /// @brief latch列表
+    ///
+    std::vector<BasicBlock *> latches;
+
+    ///
+    /// @brief 有后继在循环外的循环内基本块
+    ///
+    std::vector<BasicBlock *> exitingBlocks;
+
+    ///
+    /// @brief 循环的出口基本块
+    ///
+    std::vector<BasicBlock *> exitBlocks;
+
+    ///
+    /// @brief 嵌套深度
+    ///
+    int32_t depth = 1;
+};
+
+///
+/// @brief 循环信息。在支配树上查找回边（目标支配源的边）识别自然循环，
+/// 按支配树先序的逆序处理循环头，内层循环先于外层循环建立，
+/// 从latch沿前驱回溯到循环头得到循环体，遇到已属于某个循环的基本块时直接跳到其最外层循环的循环头，
+/// 因此每个基本块只被访问常数次，整体线性。不可达的基本块不属于任何循环，不可归约的环不识别为循环
+///
+class LoopInfo {
+
+public:
+    ///
+    /// @brief 构造函数，构造时即完成计算
+    /// @param _func 函数
+    ///
+    explicit LoopInfo(Function * _func);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~LoopInfo();
+
+    ///
+    /// @brief 控制流图改变后重新计算
+    ///
+    void recalculate();
+
+    ///
+    /// @brief 获取计算时控制流图的版本
+    /// @return uint64_t 版本
+    ///
+    uint64_t getCFGVersion() const;
+
+    ///
+    /// @brief 获取包含基本块的最内层循环
+    /// @param bb 基本块
+    /// @return Loop* 循环，不在循环内时为nullptr
+    ///
+    Loop * getLoopFor(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取基本块的循环嵌套深度
+    /// @param bb 基本块
+    /// @return int32_t 深度，不在循环内时为0
+    ///
+    int32_t getLoopDepth(BasicBlock * bb) const;
+
+    ///
+    /// @brief 判断基本块是否为循环头
+    /// @param bb 基本块
+    /// @return true 是循环头
+    ///
+    bool isLoopHeader(BasicBlock * bb) const;
+
+    ///
+    /// @brief 获取所有的循环，内层循环在外层循环之前
+    /// @return const std::vector<Loop *>& 循环列表
+    ///
+    const std::vector<Loop *> & getLoops() const;
+
+    ///
+    /// @brief 获取最外层的循环
+    /// @return const std::vector<Loop *>& 循环列表
+    ///
+    const std::vector<Loop *> & getTopLevelLoops() const;
+
+    ///
+    /// @brief 输出循环嵌套树，用于调试
+    /// @param str 输出的字符串
+    ///
+    void toString(std::string & str) const;
+
+private:
+    ///
+    /// @brief 识别自然循环，建立循环嵌套树
+    ///
+    void compute();
+
+    ///
+    /// @brief 从latch沿前驱回溯，收集循环体并连接内层循环
+    /// @param loop 循环
+    ///
+    void discover(Loop * loop);
+
+    ///
+    /// @brief 计算每个循环的基本块列表、深度与出口
+    ///
+    void populate();
+
+    ///
+    /// @brief 释放所有的循环
+    ///
+    void clear();
+
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 计算时控制流图的版本
+    ///
+    uint64_t cfgVersion = 0;
+
+    ///
+    /// @brief 所有的循环，内层循环在外层循环之前
+    ///
+    std::vector<Loop *> loops;
+
+    ///
+    /// @brief 最外层的循环
+    ///
+    std::vector<Loop *> topLevelLoops;
+
+    ///
+    /// @brief 按基本块布局序号索引的最内层循环
+    ///
+    std::vector<Loop *> blockLoops;
+};
@@ -0,0 +1,97 @@
+///
+/// @file SideEffect.cpp
+/// @brief 函数的副作用分析，计算每个函数可能修改的全局变量
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "SideEffect.h"
+#include "FuncCallInstruction.h"
+#include "GlobalVariable.h"
+#include "Function.h"
+
+///
+/// @brief 构造函数，构造时即完成计算
+/// @param funcs 模块中的所有函数
+///
+SideEffectInfo::SideEffectInfo(const std::vector<Function *> & funcs)
+{
+    compute(funcs);
+}
+
+///
+/// @brief 判断调用函数是否可能修改全局变量
+/// @param func 被调用的函数
+/// @param global 全局变量
+/// @return true 可能修改
+///
+bool SideEffectInfo::mayWrite(Function * func, Value * global) const
+{
+    return getWrittenGlobals(func).count(global) != 0;
+}
+
+///
+/// @brief 获取函数可能修改的全局变量，含被调用函数修改的
+/// @param func 函数
+/// @return const std::unordered_set<Value *>& 全局变量集合
+///
+const std::unordered_set<Value *> & SideEffectInfo::getWrittenGlobals(Function * func) const
+{
+    auto iter = writtenGlobals.find(func);
+    return iter == writtenGlobals.end() ? emptySet : iter->second;
+}
+
+///
+/// @brief 收集每个函数直接修改的全局变量与调用的函数，再沿调用图传播到不动点
+/// @param funcs 模块中的所有函数
+///
+void SideEffectInfo::compute(const std::vector<Function *> & funcs)
+{
+    std::unordered_map<Function *, std::vector<Function *>> callees;
+
+    for (auto func: funcs) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        auto & written = writtenGlobals[func];
+        for (auto inst: func->getInterCode().getInsts()) {
+
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                if (dynamic_cast<GlobalVariable *>(inst->getOperand(0))) {
+                    written.insert(inst->getOperand(0));
+                }
+            } else if (inst->getOp() == IRInstOperator::IRINST_OP_FUNC_CALL) {
+                Function * callee = static_cast<FuncCallInstruction *>(inst)->calledFunction;
+                if (!callee->isBuiltin() && callee != func) {
+                    callees[func].push_back(callee);
+                }
+            }
+        }
+    }
+
+    // 被调用函数的副作用并入调用者，直到没有变化，调用链的长度决定迭代次数
+    bool changed = true;
+    while (changed) {
+
+        changed = false;
+        for (auto & entry: callees) {
+
+            auto & written = writtenGlobals[entry.first];
+            for (auto callee: entry.second) {
+                for (auto global: writtenGlobals[callee]) {
+                    changed |= written.insert(global).second;
+                }
+            }
+        }
+    }
+}
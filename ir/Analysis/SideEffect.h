@@ -0,0 +1,70 @@
+///
+/// @file SideEffect.h
+/// @brief 函数的副作用分析，计算每个函数可能修改的全局变量
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class Function;
+class Value;
+
+///
+/// @brief 副作用分析。MiniC没有指针，函数只能通过Move指令对全局变量赋值来影响调用者，
+/// 因此函数的副作用就是其直接赋值的全局变量与所有被调用函数的副作用的并集。
+/// 在调用图上迭代到不动点，递归调用也能正确处理。内置函数不修改用户的全局变量
+///
+class SideEffectInfo {
+
+public:
+    ///
+    /// @brief 构造函数，构造时即完成计算
+    /// @param funcs 模块中的所有函数
+    ///
+    explicit SideEffectInfo(const std::vector<Function *> & funcs);
+
+    ///
+    /// @brief 判断调用函数是否可能修改全局变量
+    /// @param func 被调用的函数
+    /// @param global 全局变量
+    /// @return true 可能修改
+    ///
+    bool mayWrite(Function * func, Value * global) const;
+
+    ///
+    /// @brief 获取函数可能修改的全局变量，含被调用函数修改的
+    /// @param func 函数
+    /// @return const std::unordered_set<Value *>& 全局变量集合
+    ///
+    const std::unordered_set<Value *> & getWrittenGlobals(Function * func) const;
+
+private:
+    ///
+    /// @brief 收集每个函数直接修改的全局变量与调用的函数，再沿调用图传播到不动点
+    /// @param funcs 模块中的所有函数
+    ///
+    void compute(const std::vector<Function *> & funcs);
+
+    ///
+    /// @brief 每个函数可能修改的全局变量
+    ///
+    std::unordered_map<Function *, std::unordered_set<Value *>> writtenGlobals;
+
+    ///
+    /// @brief 空集合，没有记录的函数（如内置函数）返回它
+    ///
+    std::unordered_set<Value *> emptySet;
+};
@@ -0,0 +1,95 @@
+///
+/// @file ValueNumbering.cpp
+/// @brief 函数内值的稠密编号，作为位向量的下标
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "ValueNumbering.h"
+#include "Function.h"
+
+///
+/// @brief 按布局顺序对函数内有值的指令编号
+/// @param func 函数
+///
+void ValueNumbering::numberInstructions(Function * func)
+{
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->hasResultValue()) {
+            insert(inst);
+        }
+    }
+}
+
+///
+/// @brief 对函数的局部变量编号（含形参对应的局部变量）
+/// @param func 函数
+///
+void ValueNumbering::numberVariables(Function * func)
+{
+    for (auto var: func->getVarValues()) {
+        insert(var);
+    }
+}
+
+///
+/// @brief 对值编号，已有编号时直接返回
+/// @param val 值
+/// @return int32_t 编号
+///
+int32_t ValueNumbering::insert(Value * val)
+{
+    auto result = numbers.emplace(val, (int32_t) values.size());
+    if (result.second) {
+        values.push_back(val);
+    }
+
+    return result.first->second;
+}
+
+///
+/// @brief 获取值的编号
+/// @param val 值
+/// @return int32_t 编号，没有编号时为-1
+///
+int32_t ValueNumbering::getNo(Value * val) const
+{
+    auto iter = numbers.find(val);
+    return iter == numbers.end() ? -1 : iter->second;
+}
+
+///
+/// @brief 获取编号对应的值
+/// @param no 编号
+/// @return Value* 值
+///
+Value * ValueNumbering::getValue(int32_t no) const
+{
+    return values[no];
+}
+
+///
+/// @brief 获取已编号的值的个数，也是位向量需要的位数
+/// @return int32_t 个数
+///
+int32_t ValueNumbering::size() const
+{
+    return (int32_t) values.size();
+}
+
+///
+/// @brief 清除所有编号
+///
+void ValueNumbering::clear()
+{
+    numbers.clear();
+    values.clear();
+}
@@ -0,0 +1,86 @@
+///
+/// @file ValueNumbering.h
+/// @brief 函数内值的稠密编号，作为位向量的下标
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Function;
+class Value;
+
+///
+/// @brief 值的稠密编号。编号从0开始连续分配，数据流分析以编号作为位向量的下标。
+/// 基本块的稠密编号就是其布局序号BasicBlock::getIndex()，不在这里重复编号
+///
+class ValueNumbering {
+
+public:
+    ///
+    /// @brief 按布局顺序对函数内有值的指令编号
+    /// @param func 函数
+    ///
+    void numberInstructions(Function * func);
+
+    ///
+    /// @brief 对函数的局部变量编号（含形参对应的局部变量）
+    /// @param func 函数
+    ///
+    void numberVariables(Function * func);
+
+    ///
+    /// @brief 对值编号，已有编号时直接返回
+    /// @param val 值
+    /// @return int32_t 编号
+    ///
+    int32_t insert(Value * val);
+
+    ///
+    /// @brief 获取值的编号
+    /// @param val 值
+    /// @return int32_t 编号，没有编号时为-1
+    ///
+    int32_t getNo(Value * val) const;
+
+    ///
+    /// @brief 获取编号对应的值
+    /// @param no 编号
+    /// @return Value* 值
+    ///
+    Value * getValue(int32_t no) const;
+
+    ///
+    /// @brief 获取已编号的值的个数，也是位向量需要的位数
+    /// @return int32_t 个数
+    ///
+    int32_t size() const;
+
+    ///
+    /// @brief 清除所有编号
+    ///
+    void clear();
+
+private:
+    ///
+    /// @brief 值到编号的映射
+    ///
+    std::unordered_map<Value *, int32_t> numbers;
+
+    ///
+    /// @brief 按编号存放的值
+    ///
+    std::vector<Value *> values;
+};
@@ -0,0 +1,264 @@
+///
+/// @file BasicBlock.cpp
+/// @brief 基本块的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+
+#include "BasicBlock.h"
+#include "Function.h"
+
+///
+/// @brief 构造函数
+/// @param _func 所属函数
+/// @param _label 基本块的首指令，Label指令或者Entry指令，必须已在函数的线性IR中
+///
+BasicBlock::BasicBlock(Function * _func, Instruction * _label) : func(_func), label(_label), last(_label)
+{
+    _label->setParent(this);
+}
+
+///
+/// @brief 获取所属函数
+/// @return Function* 函数
+///
+Function * BasicBlock::getFunction()
+{
+    return func;
+}
+
+///
+/// @brief 获取基本块的首指令，即Label指令或者Entry指令
+/// @return Instruction* 首指令
+///
+Instruction * BasicBlock::getLabel()
+{
+    return label;
+}
+
+///
+/// @brief 获取基本块的指令序列
+/// @return InstRange 线性IR中基本块的指令范围，含首指令和结束指令
+///
+InstRange BasicBlock::getInsts()
+{
+    return InstRange(begin(), end());
+}
+
+///
+/// @brief 获取基本块第一条指令的迭代器
+/// @return InstList::iterator 迭代器
+///
+InstList::iterator BasicBlock::begin()
+{
+    return getList().getIterator(label);
+}
+
+///
+/// @brief 获取基本块最后一条指令之后的迭代器
+/// @return InstList::iterator 迭代器
+///
+InstList::iterator BasicBlock::end()
+{
+    return getList().getIterator(last->getNextInst());
+}
+
+///
+/// @brief 获取指向基本块中指定指令的迭代器
+/// @param inst 基本块中的指令
+/// @return InstList::iterator 迭代器
+///
+InstList::iterator BasicBlock::getIterator(Instruction * inst)
+{
+    return getList().getIterator(inst);
+}
+
+///
+/// @brief 在基本块尾部追加指令，并设置指令所属的基本块
+/// @param inst 不在线性IR中的指令
+///
+void BasicBlock::addInst(Instruction * inst)
+{
+    insert(end(), inst);
+}
+
+///
+/// @brief 在pos之前插入指令，并设置指令所属的基本块
+/// @param pos 插入位置，不能是首指令，end()表示追加到尾部
+/// @param inst 不在线性IR中的指令
+/// @return InstList::iterator 指向插入指令的迭代器
+///
+InstList::iterator BasicBlock::insert(InstList::iterator pos, Instruction * inst)
+{
+    if (pos == end()) {
+        last = inst;
+    }
+
+    inst->setParent(this);
+
+    return getList().insert(pos, inst);
+}
+
+///
+/// @brief 从基本块以及线性IR中移除指令，指令本身不释放
+/// @param pos 要移除的指令，不能是首指令
+/// @return InstList::iterator 被移除指令的下一个位置
+///
+InstList::iterator BasicBlock::erase(InstList::iterator pos)
+{
+    Instruction * inst = *pos;
+
+    if (inst == last) {
+        last = inst->getPrevInst();
+    }
+
+    inst->setParent(nullptr);
+
+    return getList().erase(pos);
+}
+
+///
+/// @brief 从基本块以及线性IR中移除指令，指令本身不释放
+/// @param inst 要移除的指令，不能是首指令
+///
+void BasicBlock::erase(Instruction * inst)
+{
+    erase(getIterator(inst));
+}
+
+///
+/// @brief 把线性IR中紧跟在基本块之后的指令并入基本块，用于划分基本块
+/// @param inst 紧跟在基本块最后一条指令之后的指令
+///
+void BasicBlock::extendTo(Instruction * inst)
+{
+    last = inst;
+    inst->setParent(this);
+}
+
+///
+/// @brief 获取基本块的结束指令
+/// @return Instruction* 跳转指令或Exit指令，若没有则返回nullptr
+///
+Instruction * BasicBlock::getTerminator()
+{
+    return isTerminator(last) ? last : nullptr;
+}
+
+///
+/// @brief 获取前驱基本块
+/// @return std::vector<BasicBlock *>& 前驱列表
+///
+std::vector<BasicBlock *> & BasicBlock::getPredecessors()
+{
+    return preds;
+}
+
+///
+/// @brief 获取后继基本块
+/// @return std::vector<BasicBlock *>& 后继列表
+///
+std::vector<BasicBlock *> & BasicBlock::getSuccessors()
+{
+    return succs;
+}
+
+///
+/// @brief 添加一条到succ的控制流边，同时维护succ的前驱
+/// @param succ 后继基本块
+///
+void BasicBlock::addSuccessor(BasicBlock * succ)
+{
+    // 条件跳转的真假目标相同时只保留一条边
+    if (std::find(succs.begin(), succs.end(), succ) != succs.end()) {
+        return;
+    }
+
+    succs.push_back(succ);
+    succ->preds.push_back(this);
+}
+
+///
+/// @brief 清除前驱和后继
+///
+void BasicBlock::clearEdges()
+{
+    preds.clear();
+    succs.clear();
+}
+
+///
+/// @brief 是否为函数的入口基本块
+/// @return true 是入口基本块
+///
+bool BasicBlock::isEntry()
+{
+    return label->getOp() == IRInstOperator::IRINST_OP_ENTRY;
+}
+
+///
+/// @brief 获取基本块在函数布局中的序号
+/// @return int32_t 序号
+///
+int32_t BasicBlock::getIndex()
+{
+    return index;
+}
+
+///
+/// @brief 设置基本块在函数布局中的序号
+/// @param _index 序号
+///
+void BasicBlock::setIndex(int32_t _index)
+{
+    index = _index;
+}
+
+///
+/// @brief 获取基本块的名字，即首Label的IR名字，用于调试输出
+/// @return std::string 名字
+///
+std::string BasicBlock::getIRName()
+{
+    if (isEntry()) {
+        return "entry";
+    }
+
+    return label->getIRName();
+}
+
+///
+/// @brief 判断指令是否是基本块的结束指令
+/// @param inst 指令
+/// @return true 是Goto、CondBr或Exit指令
+///
+bool BasicBlock::isTerminator(Instruction * inst)
+{
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_GOTO:
+        case IRInstOperator::IRINST_OP_COND_BR:
+        case IRInstOperator::IRINST_OP_EXIT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 获取所属函数的线性IR链表
+/// @return InstList& 指令链表
+///
+InstList & BasicBlock::getList()
+{
+    return func->getInterCode().getInsts();
+}
@@ -0,0 +1,207 @@
+///
+/// @file BasicBlock.h
+/// @brief 基本块的头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "InstList.h"
+
+class Function;
+
+///
+/// @brief 基本块。由Label指令（入口块为Entry指令）开始，由跳转指令或Exit指令结束的指令序列。
+/// 基本块不拥有指令，而是函数线性IR链表中连续的一段，通过基本块插入或删除指令时线性IR同步变化，
+/// 调整基本块的布局只需整段拼接
+///
+class BasicBlock {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 所属函数
+    /// @param _label 基本块的首指令，Label指令或者Entry指令，必须已在函数的线性IR中
+    ///
+    BasicBlock(Function * _func, Instruction * _label);
+
+    ///
+    /// @brief 获取所属函数
+    /// @return Function* 函数
+    ///
+    Function * getFunction();
+
+    ///
+    /// @brief 获取基本块的首指令，即Label指令或者Entry指令
+    /// @return Instruction* 首指令
+    ///
+    Instruction * getLabel();
+
+    ///
+    /// @brief 获取基本块的指令序列
+    /// @return InstRange 线性IR中基本块的指令范围，含首指令和结束指令
+    ///
+    InstRange getInsts();
+
+    ///
+    /// @brief 获取基本块第一条指令的迭代器
+    /// @return InstList::iterator 迭代器
+    ///
+    InstList::iterator begin();
+
+    ///
+    /// @brief 获取基本块最后一条指令之后的迭代器
+    /// @return InstList::iterator 迭代器
+    ///
+    InstList::iterator end();
+
+    ///
+    /// @brief 获取指向基本块中指定指令的迭代器
+    /// @param inst 基本块中的指令
+    /// @return InstList::iterator 迭代器
+    ///
+    InstList::iterator getIterator(Instruction * inst);
+
+    ///
+    /// @brief 在基本块尾部追加指令，并设置指令所属的基本块
+    /// @param inst 不在线性IR中的指令
+    ///
+    void addInst(Instruction * inst);
+
+    ///
+    /// @brief 在pos之前插入指令，并设置指令所属的基本块
+    /// @param pos 插入位置，不能是首指令，end()表示追加到尾部
+    /// @param inst 不在线性IR中的指令
+    /// @return InstList::iterator 指向插入指令的迭代器
+    ///
+    InstList::iterator insert(InstList::iterator pos, Instruction * inst);
+
+    ///
+    /// @brief 从基本块以及线性IR中移除指令，指令本身不释放
+    /// @param pos 要移除的指令，不能是首指令
+    /// @return InstList::iterator 被移除指令的下一个位置
+    ///
+    InstList::iterator erase(InstList::iterator pos);
+
+    ///
+    /// @brief 从基本块以及线性IR中移除指令，指令本身不释放
+    /// @param inst 要移除的指令，不能是首指令
+    ///
+    void erase(Instruction * inst);
+
+    ///
+    /// @brief 把线性IR中紧跟在基本块之后的指令并入基本块，用于划分基本块
+    /// @param inst 紧跟在基本块最后一条指令之后的指令
+    ///
+    void extendTo(Instruction * inst);
+
+    ///
+    /// @brief 获取基本块的结束指令
+    /// @return Instruction* 跳转指令或Exit指令，若没有则返回nullptr
+    ///
+    Instruction * getTerminator();
+
+    ///
+    /// @brief 获取前驱基本块
+    /// @return std::vector<BasicBlock *>& 前驱列表
+    ///
+    std::vector<BasicBlock *> & getPredecessors();
+
+    ///
+    /// @brief 获取后继基本块
+    /// @return std::vector<BasicBlock *>& 后继列表
+    ///
+    std::vector<BasicBlock *> & getSuccessors();
+
+    ///
+    /// @brief 添加一条到succ的控制流边，同时维护succ的前驱
+    /// @param succ 后继基本块
+    ///
+    void addSuccessor(BasicBlock * succ);
+
+    ///
+    /// @brief 清除前驱和后继
+    ///
+    void clearEdges();
+
+    ///
+    /// @brief 是否为函数的入口基本块
+    /// @return true 是入口基本块
+    ///
+    bool isEntry();
+
+    ///
+    /// @brief 获取基本块在函数布局中的序号
+    /// @return int32_t 序号
+    ///
+    int32_t getIndex();
+
+    ///
+    /// @brief 设置基本块在函数布局中的序号
+    /// @param _index 序号
+    ///
+    void setIndex(int32_t _index);
+
+    ///
+    /// @brief 获取基本块的名字，即首Label的IR名字，用于调试输出
+    /// @return std::string 名字
+    ///
+    std::string getIRName();
+
+    ///
+    /// @brief 判断指令是否是基本块的结束指令
+    /// @param inst 指令
+    /// @return true 是Goto、CondBr或Exit指令
+    ///
+    static bool isTerminator(Instruction * inst);
+
+private:
+    ///
+    /// @brief 获取所属函数的线性IR链表
+    /// @return InstList& 指令链表
+    ///
+    InstList & getList();
+
+    ///
+    /// @brief 所属函数
+    ///
+    Function * func;
+
+    ///
+    /// @brief 首指令，Label指令或者Entry指令
+    ///
+    Instruction * label;
+
+    ///
+    /// @brief 基本块的最后一条指令，与首指令一起确定线性IR中基本块的范围
+    ///
+    Instruction * last;
+
+    ///
+    /// @brief 前驱基本块
+    ///
+    std::vector<BasicBlock *> preds;
+
+    ///
+    /// @brief 后继基本块
+    ///
+    std::vector<BasicBlock *> succs;
+
+    ///
+    /// @brief 基本块在函数布局中的序号
+    ///
+    int32_t index = -1;
+};
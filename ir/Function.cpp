@@ -14,11 +14,18 @@
 /// </table>
 ///
 
+#include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <unordered_set>
 
 #include "IRConstant.h"
 #include "Function.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "CondBrInstruction.h"
+#include "DominatorTree.h"
+#include "LoopInfo.h"
 
 /// @brief 指定函数名字、函数类型的构造函数
 /// @param _name 函数名称
@@ -63,6 +70,248 @@ InterCode & Function::getInterCode()
     return code;
 }
 
+///
+/// @brief 根据线性IR划分基本块，并建立前驱后继关系。可重复调用，每次都重新划分。
+/// 划分时对线性IR做规范化：顺序执行进入下一个Label的基本块补充Goto指令，
+/// 跳转指令后没有Label的指令序列补充新的Label指令，确保每个基本块都有首指令和结束指令。
+/// 补充的指令直接插入线性IR中，基本块就是线性IR中连续的一段
+///
+void Function::buildCFG()
+{
+    clearCFG();
+
+    InstList & insts = code.getInsts();
+
+    // 当前正在填充的基本块，为空则说明上一个基本块已经以跳转指令结束
+    BasicBlock * curBlock = nullptr;
+
+    for (auto iter = insts.begin(); iter != insts.end(); ++iter) {
+
+        Instruction * inst = *iter;
+
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+
+            // 顺序执行进入Label的情况，补充无条件跳转，使得控制流边都是显式的
+            if (curBlock) {
+                curBlock->addInst(newInst<GotoInstruction>(inst));
+            }
+
+            curBlock = new BasicBlock(this, inst);
+            curBlock->setIndex((int32_t) blocks.size());
+            blocks.push_back(curBlock);
+            continue;
+        }
+
+        if (!curBlock) {
+
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ENTRY) {
+                // 入口基本块
+                curBlock = new BasicBlock(this, inst);
+                curBlock->setIndex((int32_t) blocks.size());
+                blocks.push_back(curBlock);
+                continue;
+            }
+
+            // 跳转指令之后没有Label的指令，不可达，这里新建Label使其成为独立的基本块
+            curBlock = new BasicBlock(this, *insts.insert(iter, newInst<LabelInstruction>()));
+            curBlock->setIndex((int32_t) blocks.size());
+            blocks.push_back(curBlock);
+        }
+
+        curBlock->extendTo(inst);
+
+        if (BasicBlock::isTerminator(inst)) {
+            curBlock = nullptr;
+        }
+    }
+
+    // 建立控制流边，跳转目标Label所在的基本块即为后继
+    for (auto bb: blocks) {
+
+        Instruction * term = bb->getTerminator();
+        if (!term) {
+            continue;
+        }
+
+        if (term->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+            bb->addSuccessor(static_cast<GotoInstruction *>(term)->getTarget()->getParent());
+        } else if (term->getOp() == IRInstOperator::IRINST_OP_COND_BR) {
+            auto condBrInst = static_cast<CondBrInstruction *>(term);
+            bb->addSuccessor(condBrInst->getTrueTarget()->getParent());
+            bb->addSuccessor(condBrInst->getFalseTarget()->getParent());
+        }
+    }
+}
+
+///
+/// @brief 按照基本块的布局顺序重新排列线性IR，用于基本块列表调整顺序或增删后同步线性IR。
+/// 基本块内指令的增删已经直接反映在线性IR中，这里只需按布局把各基本块整段拼接到尾部
+///
+void Function::linearizeCFG()
+{
+    InstList & insts = code.getInsts();
+
+    // 基本块的布局序号可能变化，依赖的分析结果失效
+    invalidateCFG();
+
+    int32_t index = 0;
+    for (auto bb: blocks) {
+        bb->setIndex(index++);
+        insts.splice(insts.end(), insts, bb->begin(), bb->end());
+    }
+}
+
+///
+/// @brief 删除基本块：从线性IR中移除其所有指令并释放基本块，随后重新划分基本块。
+/// 调用前需保证保留的指令不再使用被删除基本块中的值，Phi指令也不再有来自被删除基本块的来源
+/// @param deadBlocks 要删除的基本块
+///
+void Function::removeBasicBlocks(const std::vector<BasicBlock *> & deadBlocks)
+{
+    std::vector<Instruction *> deadInsts;
+    for (auto bb: deadBlocks) {
+        for (auto inst: bb->getInsts()) {
+            deadInsts.push_back(inst);
+        }
+    }
+
+    // 先解除所有的使用，被删除的指令之间可能相互使用
+    for (auto inst: deadInsts) {
+        inst->clearOperands();
+    }
+
+    // 指令的内存随函数统一释放，这里只从线性IR中移除
+    for (auto inst: deadInsts) {
+        code.getInsts().remove(inst);
+        inst->setParent(nullptr);
+    }
+
+    std::unordered_set<BasicBlock *> deadSet(deadBlocks.begin(), deadBlocks.end());
+    blocks.erase(std::remove_if(blocks.begin(),
+                                blocks.end(),
+                                [&deadSet](BasicBlock * bb) { return deadSet.count(bb) != 0; }),
+                 blocks.end());
+
+    for (auto bb: deadBlocks) {
+        delete bb;
+    }
+
+    buildCFG();
+}
+
+///
+/// @brief 获取函数的基本块列表，按布局顺序存放，第一个为入口基本块
+/// @return std::vector<BasicBlock *>& 基本块列表
+///
+std::vector<BasicBlock *> & Function::getBasicBlocks()
+{
+    return blocks;
+}
+
+///
+/// @brief 获取入口基本块
+/// @return BasicBlock* 入口基本块，没有划分基本块时为nullptr
+///
+BasicBlock * Function::getEntryBlock()
+{
+    return blocks.empty() ? nullptr : blocks.front();
+}
+
+///
+/// @brief 获取布局上紧跟在bb之后的基本块
+/// @param bb 基本块
+/// @return BasicBlock* 下一个基本块，bb为最后一个时返回nullptr
+///
+BasicBlock * Function::getNextBlock(BasicBlock * bb)
+{
+    int32_t next = bb->getIndex() + 1;
+    if (next <= 0 || next >= (int32_t) blocks.size()) {
+        return nullptr;
+    }
+
+    return blocks[next];
+}
+
+///
+/// @brief 释放所有的基本块，指令不释放
+///
+void Function::clearCFG()
+{
+    for (auto bb: blocks) {
+        for (auto inst: bb->getInsts()) {
+            inst->setParent(nullptr);
+        }
+        delete bb;
+    }
+
+    blocks.clear();
+
+    invalidateCFG();
+}
+
+///
+/// @brief 获取控制流图的版本。基本块的划分、布局或者边发生变化后版本递增，
+/// 依赖控制流图的分析结果通过比较版本判断是否失效
+/// @return uint64_t 版本
+///
+uint64_t Function::getCFGVersion()
+{
+    return cfgVersion;
+}
+
+///
+/// @brief 修改了基本块之间的边或布局后调用，使依赖控制流图的分析结果失效
+///
+void Function::invalidateCFG()
+{
+    cfgVersion++;
+}
+
+///
+/// @brief 获取支配树，控制流图变化后会自动重新计算
+/// @return DominatorTree* 支配树
+///
+DominatorTree * Function::getDominatorTree()
+{
+    if (!domTree) {
+        domTree = new DominatorTree(this);
+    } else if (domTree->getCFGVersion() != cfgVersion) {
+        domTree->recalculate();
+    }
+
+    return domTree;
+}
+
+///
+/// @brief 获取后支配树，控制流图变化后会自动重新计算
+/// @return DominatorTree* 后支配树
+///
+DominatorTree * Function::getPostDominatorTree()
+{
+    if (!postDomTree) {
+        postDomTree = new DominatorTree(this, true);
+    } else if (postDomTree->getCFGVersion() != cfgVersion) {
+        postDomTree->recalculate();
+    }
+
+    return postDomTree;
+}
+
+///
+/// @brief 获取循环信息，控制流图变化后会自动重新计算
+/// @return LoopInfo* 循环信息
+///
+LoopInfo * Function::getLoopInfo()
+{
+    if (!loopInfo) {
+        loopInfo = new LoopInfo(this);
+    } else if (loopInfo->getCFGVersion() != cfgVersion) {
+        loopInfo->recalculate();
+    }
+
+    return loopInfo;
+}
+
 /// @brief 判断该函数是否是内置函数
 /// @return true: 内置函数，false：用户自定义
 bool Function::isBuiltin()
@@ -117,7 +366,7 @@ void Function::toString(std::string & str)
 
     // 输出临时变量的declare形式
     // 遍历所有的线性IR指令，文本输出
-    for (auto & inst: code.getInsts()) {
+    for (auto inst: code.getInsts()) {
 
         if (inst->hasResultValue()) {
 
@@ -127,7 +376,7 @@ void Function::toString(std::string & str)
     }
 
     // 遍历所有的线性IR指令，文本输出
-    for (auto & inst: code.getInsts()) {
+    for (auto inst: code.getInsts()) {
 
         std::string instStr;
         inst->toString(instStr);
@@ -241,7 +490,8 @@ void Function::setExistFuncCall(bool exist)
 LocalVariable * Function::newLocalVarValue(Type * type, std::string name, int32_t scope_level)
 {
     // 创建变量并加入符号表
-    LocalVariable * varValue = new LocalVariable(type, name, scope_level);
+    void * mem = arena.allocate(sizeof(LocalVariable), alignof(LocalVariable));
+    LocalVariable * varValue = arena.track(new (mem) LocalVariable(type, name, scope_level));
 
     // varsVector表中可能存在变量重名的信息
     varsVector.push_back(varValue);
@@ -255,7 +505,8 @@ LocalVariable * Function::newLocalVarValue(Type * type, std::string name, int32_
 MemVariable * Function::newMemVariable(Type * type)
 {
     // 肯定唯一存在，直接插入即可
-    MemVariable * memValue = new MemVariable(type);
+    void * mem = arena.allocate(sizeof(MemVariable), alignof(MemVariable));
+    MemVariable * memValue = arena.track(new (mem) MemVariable(type));
 
     memVector.push_back(memValue);
 
@@ -265,19 +516,46 @@ MemVariable * Function::newMemVariable(Type * type)
 /// @brief 清理函数内申请的资源
 void Function::Delete()
 {
-    // 清理IR指令
-    code.Delete();
-
-    // 清理Value
-    for (auto & var: varsVector) {
-        delete var;
+    // 清理基本块
+    clearCFG();
+
+    delete domTree;
+    domTree = nullptr;
+    delete postDomTree;
+    postDomTree = nullptr;
+    delete loopInfo;
+    loopInfo = nullptr;
+
+    // 指令、Use以及变量都在内存池中，统一释放，函数内Value之间的def-use关系不需要逐个解除。
+    // 函数外的Value（全局变量、常量等）的use链表中有本函数的Use，释放前先从这些链表中摘除；
+    // 从指令序列中删除的指令已清除了操作数，只需处理序列中的指令
+    for (auto inst: code.getInsts()) {
+        for (auto use: inst->getOperands()) {
+            if (dynamic_cast<Constant *>(use->getUsee())) {
+                use->getUsee()->removeUse(use);
+            }
+        }
     }
 
+    code.Delete();
     varsVector.clear();
+    memVector.clear();
+
+    arena.release();
 }
 
 ///
-/// @brief 函数内的Value重命名
+/// @brief 获取函数的内存池，函数内的指令、Use与变量都在其中分配
+/// @return Arena& 内存池
+///
+Arena & Function::getArena()
+{
+    return arena;
+}
+
+///
+/// @brief 函数内的Value重命名。这里只分配IR编号，不产生字符串，
+/// IR名字在输出时由各Value的前缀与编号拼接得到
 ///
 void Function::renameIR()
 {
@@ -290,21 +568,19 @@ void Function::renameIR()
 
     // 形式参数重命名
     for (auto & param: this->params) {
-        param->setIRName(IR_TEMP_VARNAME_PREFIX + std::to_string(nameIndex++));
+        param->setIRNo(nameIndex++);
     }
 
     // 局部变量重命名
     for (auto & var: this->varsVector) {
 
-        var->setIRName(IR_LOCAL_VARNAME_PREFIX + std::to_string(nameIndex++));
+        var->setIRNo(nameIndex++);
     }
 
     // 遍历所有的指令进行命名
     for (auto inst: this->getInterCode().getInsts()) {
-        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-            inst->setIRName(IR_LABEL_PREFIX + std::to_string(nameIndex++));
-        } else if (inst->hasResultValue()) {
-            inst->setIRName(IR_TEMP_VARNAME_PREFIX + std::to_string(nameIndex++));
+        if ((inst->getOp() == IRInstOperator::IRINST_OP_LABEL) || inst->hasResultValue()) {
+            inst->setIRNo(nameIndex++);
         }
     }
 }
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "GlobalValue.h"
@@ -24,6 +25,11 @@
 #include "LocalVariable.h"
 #include "MemVariable.h"
 #include "IRCode.h"
+#include "BasicBlock.h"
+#include "Arena.h"
+
+class DominatorTree;
+class LoopInfo;
 
 ///
 /// @brief 描述函数信息的类，是全局静态存储，其Value的类型为FunctionType
@@ -55,6 +61,81 @@ public:
     /// @return IR指令代码
     InterCode & getInterCode();
 
+    ///
+    /// @brief 根据线性IR划分基本块，并建立前驱后继关系。可重复调用，每次都重新划分。
+    /// 划分时对线性IR做规范化：顺序执行进入下一个Label的基本块补充Goto指令，
+    /// 跳转指令后没有Label的指令序列补充新的Label指令，确保每个基本块都有首指令和结束指令。
+    /// 补充的指令直接插入线性IR中，基本块就是线性IR中连续的一段
+    ///
+    void buildCFG();
+
+    ///
+    /// @brief 按照基本块的布局顺序重新排列线性IR，用于基本块列表调整顺序或增删后同步线性IR。
+    /// 基本块内指令的增删已经直接反映在线性IR中，这里只需按布局把各基本块整段拼接到尾部
+    ///
+    void linearizeCFG();
+
+    ///
+    /// @brief 删除基本块：从线性IR中移除其所有指令并释放基本块，随后重新划分基本块。
+    /// 调用前需保证保留的指令不再使用被删除基本块中的值，Phi指令也不再有来自被删除基本块的来源
+    /// @param deadBlocks 要删除的基本块
+    ///
+    void removeBasicBlocks(const std::vector<BasicBlock *> & deadBlocks);
+
+    ///
+    /// @brief 获取函数的基本块列表，按布局顺序存放，第一个为入口基本块
+    /// @return std::vector<BasicBlock *>& 基本块列表
+    ///
+    std::vector<BasicBlock *> & getBasicBlocks();
+
+    ///
+    /// @brief 获取入口基本块
+    /// @return BasicBlock* 入口基本块，没有划分基本块时为nullptr
+    ///
+    BasicBlock * getEntryBlock();
+
+    ///
+    /// @brief 获取布局上紧跟在bb之后的基本块
+    /// @param bb 基本块
+    /// @return BasicBlock* 下一个基本块，bb为最后一个时返回nullptr
+    ///
+    BasicBlock * getNextBlock(BasicBlock * bb);
+
+    ///
+    /// @brief 释放所有的基本块，指令不释放
+    ///
+    void clearCFG();
+
+    ///
+    /// @brief 获取控制流图的版本。基本块的划分、布局或者边发生变化后版本递增，
+    /// 依赖控制流图的分析结果通过比较版本判断是否失效
+    /// @return uint64_t 版本
+    ///
+    uint64_t getCFGVersion();
+
+    ///
+    /// @brief 修改了基本块之间的边或布局后调用，使依赖控制流图的分析结果失效
+    ///
+    void invalidateCFG();
+
+    ///
+    /// @brief 获取支配树，控制流图变化后会自动重新计算
+    /// @return DominatorTree* 支配树
+    ///
+    DominatorTree * getDominatorTree();
+
+    ///
+    /// @brief 获取后支配树，控制流图变化后会自动重新计算
+    /// @return DominatorTree* 后支配树
+    ///
+    DominatorTree * getPostDominatorTree();
+
+    ///
+    /// @brief 获取循环信息，控制流图变化后会自动重新计算
+    /// @return LoopInfo* 循环信息
+    ///
+    LoopInfo * getLoopInfo();
+
     /// @brief 判断该函数是否是内置函数
     /// @return true: 内置函数，false：用户自定义
     bool isBuiltin();
@@ -146,11 +227,30 @@ public:
     /// \return 临时变量Value
     MemVariable * newMemVariable(Type * type);
 
+    ///
+    /// @brief 在函数的内存池中创建指令。指令随函数统一释放，不能delete，
+    /// 从指令序列中删除的指令清除操作数即可
+    /// @tparam T 指令类型
+    /// @param args 除所属函数之外的构造参数
+    /// @return T* 指令
+    ///
+    template <typename T, typename... Args>
+    T * newInst(Args &&... args)
+    {
+        return arena.create<T>(this, std::forward<Args>(args)...);
+    }
+
+    ///
+    /// @brief 获取函数的内存池，函数内的指令、Use与变量都在其中分配
+    /// @return Arena& 内存池
+    ///
+    Arena & getArena();
+
     /// @brief 清理函数内申请的资源
     void Delete();
 
     ///
-    /// @brief 函数内的Value重命名，用于IR指令的输出
+    /// @brief 函数内的Value重命名，用于IR指令的输出。只分配IR编号，名字在输出时按需拼接
     ///
     void renameIR();
 
@@ -186,11 +286,42 @@ private:
     ///
     bool builtIn = false;
 
+    ///
+    /// @brief 内存池，函数内的指令、Use与变量都在其中分配。
+    /// 释放时逐个调用指令与变量的析构函数，Use的析构函数平凡，不逐个处理
+    ///
+    Arena arena;
+
     ///
     /// @brief 线性IR指令块，可包含多条IR指令
     ///
     InterCode code;
 
+    ///
+    /// @brief 基本块列表，按布局顺序存放
+    ///
+    std::vector<BasicBlock *> blocks;
+
+    ///
+    /// @brief 控制流图版本
+    ///
+    uint64_t cfgVersion = 0;
+
+    ///
+    /// @brief 缓存的支配树
+    ///
+    DominatorTree * domTree = nullptr;
+
+    ///
+    /// @brief 缓存的后支配树
+    ///
+    DominatorTree * postDomTree = nullptr;
+
+    ///
+    /// @brief 缓存的循环信息
+    ///
+    LoopInfo * loopInfo = nullptr;
+
     ///
     /// @brief 函数内变量的向量表，可能重名，请注意
     ///
@@ -0,0 +1,212 @@
+///
+/// @file IRBuilder.cpp
+/// @brief 指令插入点构造器，翻译时指令直接插入到函数的指令序列中
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "IRBuilder.h"
+#include "ConstantFold.h"
+#include "Module.h"
+#include "BinaryInstruction.h"
+#include "GlobalVariable.h"
+
+/// @brief 构造函数
+/// @param _module 模块，折叠得到的常量在其中创建
+IRBuilder::IRBuilder(Module * _module) : module(_module)
+{}
+
+/// @brief 设置插入点为函数指令序列的尾部
+/// @param _func 函数
+void IRBuilder::setInsertPoint(Function * _func)
+{
+    setInsertPoint(_func, _func->getInterCode().getInsts().end());
+}
+
+/// @brief 设置插入点为函数指令序列中的指定位置，新指令插入到该位置之前
+/// @param _func 函数
+/// @param _pos 位置
+void IRBuilder::setInsertPoint(Function * _func, InstList::iterator _pos)
+{
+    func = _func;
+    pos = _pos;
+    available.clear();
+}
+
+/// @brief 清除插入点，离开函数时调用
+void IRBuilder::clearInsertPoint()
+{
+    func = nullptr;
+    pos = InstList::iterator();
+    available.clear();
+}
+
+/// @brief 获取插入点所在的函数
+/// @return 函数，没有插入点时为nullptr
+Function * IRBuilder::getFunction() const
+{
+    return func;
+}
+
+/// @brief 在插入点插入已创建的指令，如事先创建的标签指令
+/// @param inst 指令
+/// @return 插入的指令
+Instruction * IRBuilder::insert(Instruction * inst)
+{
+    // 插入到pos之前，pos保持不变，连续插入的指令保持产生的顺序
+    func->getInterCode().getInsts().insert(pos, inst);
+    updateAvailable(inst);
+    return inst;
+}
+
+/// @brief 创建二元运算。两个操作数都是常量时折叠为常量，满足x+0、x*1、x-x等恒等式时化简为已有的值，
+/// 本基本块内已有相同的运算时复用其结果，否则创建BinaryInstruction并插入到插入点
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @param type 运算结果的类型
+/// @return 运算的结果，可能是常量、已有的值或者新创建的指令
+Value * IRBuilder::createBinary(IRInstOperator op, Value * lhs, Value * rhs, Type * type)
+{
+    auto lhsConst = dynamic_cast<ConstInt *>(lhs);
+    auto rhsConst = dynamic_cast<ConstInt *>(rhs);
+
+    int32_t result;
+    if (lhsConst && rhsConst && constantFoldBinary(op, lhsConst->getVal(), rhsConst->getVal(), result)) {
+        return module->newConstInt(result);
+    }
+
+    Value * simplified = simplifyBinary(op, lhs, rhs);
+    if (simplified) {
+        return simplified;
+    }
+
+    // 可交换运算的操作数规范化后，a+b与b+a查到同一项
+    auto key = std::make_tuple(op, lhs, rhs);
+    if (isCommutative(op) && (std::less<Value *>()(rhs, lhs))) {
+        key = std::make_tuple(op, rhs, lhs);
+    }
+
+    auto iter = available.find(key);
+    if (iter != available.end()) {
+        return iter->second;
+    }
+
+    BinaryInstruction * inst = create<BinaryInstruction>(op, lhs, rhs, type);
+    available.emplace(key, inst);
+
+    return inst;
+}
+
+/// @brief 按代数恒等式化简二元运算
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @return 化简后的值，不能化简时为nullptr
+Value * IRBuilder::simplifyBinary(IRInstOperator op, Value * lhs, Value * rhs)
+{
+    auto lhsConst = dynamic_cast<ConstInt *>(lhs);
+    auto rhsConst = dynamic_cast<ConstInt *>(rhs);
+    bool lhsZero = lhsConst && lhsConst->getVal() == 0;
+    bool rhsZero = rhsConst && rhsConst->getVal() == 0;
+    bool lhsOne = lhsConst && lhsConst->getVal() == 1;
+    bool rhsOne = rhsConst && rhsConst->getVal() == 1;
+
+    // 化简为操作数本身的结果。全局变量是内存而不是值，其后的函数调用可能修改它，不能直接作为结果
+    Value * operand = nullptr;
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+            operand = rhsZero ? lhs : (lhsZero ? rhs : nullptr);
+            break;
+        case IRInstOperator::IRINST_OP_SUB_I:
+            if (lhs == rhs) {
+                return module->newConstInt(0);
+            }
+            operand = rhsZero ? lhs : nullptr;
+            break;
+        case IRInstOperator::IRINST_OP_MUL_I:
+            if (lhsZero || rhsZero) {
+                return module->newConstInt(0);
+            }
+            operand = rhsOne ? lhs : (lhsOne ? rhs : nullptr);
+            break;
+        case IRInstOperator::IRINST_OP_DIV_I:
+            operand = rhsOne ? lhs : nullptr;
+            break;
+        case IRInstOperator::IRINST_OP_MOD_I:
+            if (rhsOne) {
+                return module->newConstInt(0);
+            }
+            break;
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+            if (lhs == rhs) {
+                return module->newConstInt(1);
+            }
+            break;
+        case IRInstOperator::IRINST_OP_NEQ_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+            if (lhs == rhs) {
+                return module->newConstInt(0);
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (operand && !dynamic_cast<GlobalVariable *>(operand)) {
+        return operand;
+    }
+
+    return nullptr;
+}
+
+/// @brief 插入指令后维护可复用的运算：基本块边界处全部清除，
+/// 变量被赋值时清除使用该变量的运算，函数调用后清除使用全局变量的运算
+/// @param inst 插入的指令
+void IRBuilder::updateAvailable(Instruction * inst)
+{
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+        case IRInstOperator::IRINST_OP_EXIT:
+        case IRInstOperator::IRINST_OP_LABEL:
+        case IRInstOperator::IRINST_OP_GOTO:
+        case IRInstOperator::IRINST_OP_COND_BR:
+            available.clear();
+            break;
+        case IRInstOperator::IRINST_OP_ASSIGN: {
+            Value * dst = inst->getOperand(0);
+            for (auto iter = available.begin(); iter != available.end();) {
+                if (std::get<1>(iter->first) == dst || std::get<2>(iter->first) == dst) {
+                    iter = available.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+            break;
+        }
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+            for (auto iter = available.begin(); iter != available.end();) {
+                if (dynamic_cast<GlobalVariable *>(std::get<1>(iter->first)) ||
+                    dynamic_cast<GlobalVariable *>(std::get<2>(iter->first))) {
+                    iter = available.erase(iter);
+                } else {
+                    ++iter;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,104 @@
+///
+/// @file IRBuilder.h
+/// @brief 指令插入点构造器，翻译时指令直接插入到函数的指令序列中
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include "Function.h"
+#include "InstList.h"
+
+class Module;
+
+/// @brief 指令插入点构造器。插入点为函数指令序列中的一个位置，新指令插入到该位置之前，
+/// 插入点为序列尾部时即追加。AST遍历时各节点的指令按产生顺序直接进入函数，不需要每个节点的中间指令块。
+/// 二元运算经createBinary创建时在产生的同时化简：常量折叠、代数恒等式化简，
+/// 以及基本块内相同运算的复用（局部值编号），不依赖优化级别
+class IRBuilder {
+
+public:
+    /// @brief 构造函数
+    /// @param _module 模块，折叠得到的常量在其中创建
+    explicit IRBuilder(Module * _module);
+
+    /// @brief 设置插入点为函数指令序列的尾部
+    /// @param _func 函数
+    void setInsertPoint(Function * _func);
+
+    /// @brief 设置插入点为函数指令序列中的指定位置，新指令插入到该位置之前
+    /// @param _func 函数
+    /// @param _pos 位置
+    void setInsertPoint(Function * _func, InstList::iterator _pos);
+
+    /// @brief 清除插入点，离开函数时调用
+    void clearInsertPoint();
+
+    /// @brief 获取插入点所在的函数
+    /// @return 函数，没有插入点时为nullptr
+    Function * getFunction() const;
+
+    /// @brief 在插入点插入已创建的指令，如事先创建的标签指令
+    /// @param inst 指令
+    /// @return 插入的指令
+    Instruction * insert(Instruction * inst);
+
+    /// @brief 在函数的内存池中创建指令并插入到插入点
+    /// @tparam T 指令类型
+    /// @param args 除所属函数外的构造参数
+    /// @return 新创建的指令
+    template <typename T, typename... Args>
+    T * create(Args &&... args)
+    {
+        T * inst = func->newInst<T>(std::forward<Args>(args)...);
+        insert(inst);
+        return inst;
+    }
+
+    /// @brief 创建二元运算。两个操作数都是常量时折叠为常量，满足x+0、x*1、x-x等恒等式时化简为已有的值，
+    /// 本基本块内已有相同的运算时复用其结果，否则创建BinaryInstruction并插入到插入点
+    /// @param op 运算符
+    /// @param lhs 左操作数
+    /// @param rhs 右操作数
+    /// @param type 运算结果的类型
+    /// @return 运算的结果，可能是常量、已有的值或者新创建的指令
+    Value * createBinary(IRInstOperator op, Value * lhs, Value * rhs, Type * type);
+
+private:
+    /// @brief 按代数恒等式化简二元运算
+    /// @param op 运算符
+    /// @param lhs 左操作数
+    /// @param rhs 右操作数
+    /// @return 化简后的值，不能化简时为nullptr
+    Value * simplifyBinary(IRInstOperator op, Value * lhs, Value * rhs);
+
+    /// @brief 插入指令后维护可复用的运算：基本块边界处全部清除，
+    /// 变量被赋值时清除使用该变量的运算，函数调用后清除使用全局变量的运算
+    /// @param inst 插入的指令
+    void updateAvailable(Instruction * inst);
+
+    /// @brief 模块
+    Module * module;
+
+    /// @brief 插入点所在的函数
+    Function * func = nullptr;
+
+    /// @brief 插入点，新指令插入到该位置之前
+    InstList::iterator pos;
+
+    /// @brief 当前基本块内可复用的运算，键为(运算符, 左操作数, 右操作数)，可交换运算的操作数按地址排序
+    std::map<std::tuple<IRInstOperator, Value *, Value *>, Instruction *> available;
+};
@@ -39,7 +39,7 @@
 /// @brief 构造函数
 /// @param _root AST的根
 /// @param _module 符号表
-IRGenerator::IRGenerator(ast_node * _root, Module * _module) : root(_root), module(_module)
+IRGenerator::IRGenerator(ast_node * _root, Module * _module) : root(_root), module(_module), builder(_module)
 {
     /* 叶子节点 */
     ast2ir_handlers[ast_operator_type::AST_OP_LEAF_LITERAL_UINT] = &IRGenerator::ir_leaf_node_uint;
@@ -104,7 +104,7 @@ LabelInstruction * IRGenerator::create_new_label() {
     ss << "label" << labelCounter++;
     
     // 创建新的标签指令
-    LabelInstruction* label = new LabelInstruction(currentFunc);
+    LabelInstruction* label = currentFunc->newInst<LabelInstruction>();
     
     return label;
 }
@@ -220,16 +220,16 @@ bool IRGenerator::ir_function_define(ast_node * node)
     // 进入函数的作用域
     module->enterScope();
 
-    // 获取函数的IR代码列表，用于后面追加指令用，注意这里用的是引用传值
-    InterCode & irCode = newFunc->getInterCode();
+    // 插入点设置为函数指令序列的尾部，函数内各节点翻译的指令按产生顺序直接追加到函数中
+    builder.setInsertPoint(newFunc);
 
     // 这里也可增加一个函数入口Label指令，便于后续基本块划分
 
     // 创建并加入Entry入口指令
-    irCode.addInst(new EntryInstruction(newFunc));
+    builder.create<EntryInstruction>();
 
     // 创建出口指令并不加入出口指令，等函数内的指令处理完毕后加入出口指令
-    LabelInstruction * exitLabelInst = new LabelInstruction(newFunc);
+    LabelInstruction * exitLabelInst = newFunc->newInst<LabelInstruction>();
 
     // 函数出口指令保存到函数信息中，因为在语义分析函数体时return语句需要跳转到函数尾部，需要这个label指令
     newFunc->setExitLabel(exitLabelInst);
@@ -241,7 +241,6 @@ bool IRGenerator::ir_function_define(ast_node * node)
         // TODO 自行追加语义错误处理
         return false;
     }
-    node->blockInsts.addInst(param_node->blockInsts);
 
     // 新建一个Value，用于保存函数的返回值，如果没有返回值可不用申请
     LocalVariable * retValue = nullptr;
@@ -265,19 +264,19 @@ bool IRGenerator::ir_function_define(ast_node * node)
         return false;
     }
 
-    // IR指令追加到当前的节点中
-    node->blockInsts.addInst(block_node->blockInsts);
-
-    // 此时，所有指令都加入到当前函数中，也就是node->blockInsts
-
-    // node节点的指令移动到函数的IR指令列表中
-    irCode.addInst(node->blockInsts);
+    // 此时，函数体的所有指令都已加入到当前函数中
 
     // 添加函数出口Label指令，主要用于return语句跳转到这里进行函数的退出
-    irCode.addInst(exitLabelInst);
+    builder.insert(exitLabelInst);
 
     // 函数出口指令
-    irCode.addInst(new ExitInstruction(newFunc, retValue));
+    builder.create<ExitInstruction>(retValue);
+
+    // 函数的指令已全部产生，清除插入点
+    builder.clearInsertPoint();
+
+    // 函数的指令已全部产生，划分基本块并建立控制流图，供后续的优化与后端使用
+    newFunc->buildCFG();
 
     // 恢复成外部函数
     module->setCurrentFunction(nullptr);
@@ -355,7 +354,6 @@ bool IRGenerator::ir_function_call(ast_node * node)
             }
 
             realParams.push_back(temp->val);
-            node->blockInsts.addInst(temp->blockInsts);
         }
     }
 
@@ -369,10 +367,8 @@ bool IRGenerator::ir_function_call(ast_node * node)
     // 返回调用有返回值，则需要分配临时变量，用于保存函数调用的返回值
     Type * type = calledFunction->getReturnType();
 
-    FuncCallInstruction * funcCallInst = new FuncCallInstruction(currentFunc, calledFunction, realParams, type);
-
-    // 创建函数调用指令
-    node->blockInsts.addInst(funcCallInst);
+    // 创建函数调用指令，实参的指令在遍历时已插入
+    FuncCallInstruction * funcCallInst = builder.create<FuncCallInstruction>(calledFunction, realParams, type);
 
     // 函数调用结果Value保存到node中，可能为空，上层节点可利用这个值
     node->val = funcCallInst;
@@ -399,7 +395,6 @@ bool IRGenerator::ir_block(ast_node * node)
             return false;
         }
 
-        node->blockInsts.addInst(temp->blockInsts);
     }
 
     // 离开作用域
@@ -436,18 +431,8 @@ bool IRGenerator::ir_add(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * addInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_ADD_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(addInst);
-
-    node->val = addInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_ADD_I, left->val, right->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -478,18 +463,8 @@ bool IRGenerator::ir_sub(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * subInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_SUB_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(subInst);
-
-    node->val = subInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_SUB_I, left->val, right->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -521,12 +496,8 @@ bool IRGenerator::ir_assign(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(movInst);
+    // 右侧操作数的指令在遍历时已插入，赋值指令插入在其后
+    MoveInstruction * movInst = builder.create<MoveInstruction>(left->val, right->val);
 
     // 这里假定赋值的类型是一致的
     node->val = movInst;
@@ -558,14 +529,11 @@ bool IRGenerator::ir_return(ast_node * node)
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
     Function * currentFunc = module->getCurrentFunction();
 
-    // 返回值存在时则移动指令到node中
+    // 返回值存在时则产生赋值指令
     if (right) {
 
-        // 创建临时变量保存IR的值，以及线性IR指令
-        node->blockInsts.addInst(right->blockInsts);
-
         // 返回值赋值到函数返回值变量上，然后跳转到函数的尾部
-        node->blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), right->val));
+        builder.create<MoveInstruction>(currentFunc->getReturnValue(), right->val);
 
         node->val = right->val;
     } else {
@@ -574,7 +542,7 @@ bool IRGenerator::ir_return(ast_node * node)
     }
 
     // 跳转到函数的尾部出口指令上
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, currentFunc->getExitLabel()));
+    builder.create<GotoInstruction>(currentFunc->getExitLabel());
 
     return true;
 }
@@ -680,18 +648,8 @@ bool IRGenerator::ir_mul(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * mulInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_MUL_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(mulInst);
-
-    node->val = mulInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_MUL_I, left->val, right->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -722,18 +680,8 @@ bool IRGenerator::ir_div(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * divInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_DIV_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(divInst);
-
-    node->val = divInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_DIV_I, left->val, right->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -764,18 +712,8 @@ bool IRGenerator::ir_mod(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * modInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_MOD_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(modInst);
-
-    node->val = modInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_MOD_I, left->val, right->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -800,17 +738,7 @@ bool IRGenerator::ir_neg(ast_node * node)
     ConstInt * zero = module->newConstInt(0);
     
     // 使用0减去操作数实现求负操作
-    BinaryInstruction * negInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_SUB_I,
-                                                        zero,
-                                                        operand->val,
-                                                        IntegerType::getTypeInt());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(operand->blockInsts);
-    node->blockInsts.addInst(negInst);
-
-    node->val = negInst;
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_SUB_I, zero, operand->val, IntegerType::getTypeInt());
 
     return true;
 }
@@ -841,18 +769,8 @@ bool IRGenerator::ir_eq(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * eqInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                       IRInstOperator::IRINST_OP_EQ_I,
-                                                       left->val,
-                                                       right->val,
-                                                       IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(eqInst);
-
-    node->val = eqInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_EQ_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -883,18 +801,9 @@ bool IRGenerator::ir_neq(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * neqInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                        IRInstOperator::IRINST_OP_NEQ_I,
-                                                        left->val,
-                                                        right->val,
-                                                        IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(neqInst);
-
-    node->val = neqInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val =
+        builder.createBinary(IRInstOperator::IRINST_OP_NEQ_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -925,18 +834,8 @@ bool IRGenerator::ir_lt(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * ltInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                       IRInstOperator::IRINST_OP_LT_I,
-                                                       left->val,
-                                                       right->val,
-                                                       IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(ltInst);
-
-    node->val = ltInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_LT_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -967,18 +866,8 @@ bool IRGenerator::ir_le(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * leInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                       IRInstOperator::IRINST_OP_LE_I,
-                                                       left->val,
-                                                       right->val,
-                                                       IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(leInst);
-
-    node->val = leInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_LE_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -1009,18 +898,8 @@ bool IRGenerator::ir_gt(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * gtInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                       IRInstOperator::IRINST_OP_GT_I,
-                                                       left->val,
-                                                       right->val,
-                                                       IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(gtInst);
-
-    node->val = gtInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_GT_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -1051,18 +930,8 @@ bool IRGenerator::ir_ge(ast_node * node)
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
-    BinaryInstruction * geInst = new BinaryInstruction(module->getCurrentFunction(),
-                                                       IRInstOperator::IRINST_OP_GE_I,
-                                                       left->val,
-                                                       right->val,
-                                                       IntegerType::getTypeBool());
-
-    // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(geInst);
-
-    node->val = geInst;
+    // 左右操作数的指令在遍历时已插入，运算指令插入在其后
+    node->val = builder.createBinary(IRInstOperator::IRINST_OP_GE_I, left->val, right->val, IntegerType::getTypeBool());
 
     return true;
 }
@@ -1092,22 +961,16 @@ bool IRGenerator::ir_and(ast_node * node)
     // 根据左操作数的值进行条件跳转：
     // 如果左操作数为假(0)，直接跳转到falseLabel，结果为假
     // 如果左操作数为真(非0)，跳转到rightLabel，计算右操作数
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), left->val, rightLabel, falseLabel);
-
-    // 添加左侧计算指令和条件跳转
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(left->val, rightLabel, falseLabel);
     
     // 左操作数为假时，结果直接为假(0)
-    node->blockInsts.addInst(falseLabel);
+    builder.insert(falseLabel);
     ConstInt * zero = module->newConstInt(0);
-    MoveInstruction * setFalse = new MoveInstruction(module->getCurrentFunction(), resultVal, zero);
-    node->blockInsts.addInst(setFalse);
-    GotoInstruction * gotoEnd = new GotoInstruction(module->getCurrentFunction(), endLabel);
-    node->blockInsts.addInst(gotoEnd);
+    builder.create<MoveInstruction>(resultVal, zero);
+    builder.create<GotoInstruction>(endLabel);
     
     // 左操作数为真时，计算右操作数
-    node->blockInsts.addInst(rightLabel);
+    builder.insert(rightLabel);
     
     // 右操作数
     ast_node * right = ir_visit_ast_node(right_node);
@@ -1116,14 +979,10 @@ bool IRGenerator::ir_and(ast_node * node)
     }
     
     // 结果为右操作数的值，表示逻辑与的结果
-    MoveInstruction * moveRight = new MoveInstruction(module->getCurrentFunction(), resultVal, right->val);
-    
-    // 添加右侧计算指令和结果设置
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(moveRight);
+    builder.create<MoveInstruction>(resultVal, right->val);
     
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     // 设置节点的值为结果
     node->val = resultVal;
@@ -1156,22 +1015,16 @@ bool IRGenerator::ir_or(ast_node * node)
     // 根据左操作数的值进行条件跳转：
     // 如果左操作数为真(非0)，直接跳转到trueLabel，结果为真
     // 如果左操作数为假(0)，跳转到rightLabel，计算右操作数
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), left->val, trueLabel, rightLabel);
-
-    // 添加左侧计算指令和条件跳转
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(left->val, trueLabel, rightLabel);
     
     // 左操作数为真时，结果直接为真(1)
-    node->blockInsts.addInst(trueLabel);
+    builder.insert(trueLabel);
     ConstInt * one = module->newConstInt(1);
-    MoveInstruction * setTrue = new MoveInstruction(module->getCurrentFunction(), resultVal, one);
-    node->blockInsts.addInst(setTrue);
-    GotoInstruction * gotoEnd = new GotoInstruction(module->getCurrentFunction(), endLabel);
-    node->blockInsts.addInst(gotoEnd);
+    builder.create<MoveInstruction>(resultVal, one);
+    builder.create<GotoInstruction>(endLabel);
     
     // 左操作数为假时，计算右操作数
-    node->blockInsts.addInst(rightLabel);
+    builder.insert(rightLabel);
     
     // 右操作数
     ast_node * right = ir_visit_ast_node(right_node);
@@ -1180,14 +1033,10 @@ bool IRGenerator::ir_or(ast_node * node)
     }
     
     // 结果为右操作数的值，表示逻辑或的结果
-    MoveInstruction * moveRight = new MoveInstruction(module->getCurrentFunction(), resultVal, right->val);
-    
-    // 添加右侧计算指令和结果设置
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(moveRight);
+    builder.create<MoveInstruction>(resultVal, right->val);
     
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     // 设置节点的值为结果
     node->val = resultVal;
@@ -1217,28 +1066,21 @@ bool IRGenerator::ir_not(ast_node * node)
     LabelInstruction * endLabel = create_new_label();
     
     // 条件判断：如果操作数为0（假），则结果为1（真）；否则结果为0（假）
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), operand->val, falseLabel, trueLabel);
-
-    // 添加操作数计算指令和条件跳转
-    node->blockInsts.addInst(operand->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(operand->val, falseLabel, trueLabel);
     
     // 操作数为真时，结果为假(0)
-    node->blockInsts.addInst(falseLabel);
+    builder.insert(falseLabel);
     ConstInt * zero = module->newConstInt(0);
-    MoveInstruction * setFalse = new MoveInstruction(module->getCurrentFunction(), resultVal, zero);
-    node->blockInsts.addInst(setFalse);
-    GotoInstruction * gotoEnd = new GotoInstruction(module->getCurrentFunction(), endLabel);
-    node->blockInsts.addInst(gotoEnd);
+    builder.create<MoveInstruction>(resultVal, zero);
+    builder.create<GotoInstruction>(endLabel);
     
     // 操作数为假时，结果为真(1)
-    node->blockInsts.addInst(trueLabel);
+    builder.insert(trueLabel);
     ConstInt * one = module->newConstInt(1);
-    MoveInstruction * setTrue = new MoveInstruction(module->getCurrentFunction(), resultVal, one);
-    node->blockInsts.addInst(setTrue);
+    builder.create<MoveInstruction>(resultVal, one);
     
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     // 设置节点的值为结果
     node->val = resultVal;
@@ -1266,14 +1108,10 @@ bool IRGenerator::ir_if(ast_node * node)
     LabelInstruction * endLabel = create_new_label();
     
     // 生成条件跳转指令
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), cond->val, thenLabel, endLabel);
-    
-    // 添加条件计算和分支指令
-    node->blockInsts.addInst(cond->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(cond->val, thenLabel, endLabel);
     
     // 添加真分支标签
-    node->blockInsts.addInst(thenLabel);
+    builder.insert(thenLabel);
     
     // 生成真分支语句
     ast_node * then_stmt = ir_visit_ast_node(then_node);
@@ -1281,11 +1119,8 @@ bool IRGenerator::ir_if(ast_node * node)
         return false;
     }
     
-    // 添加真分支语句
-    node->blockInsts.addInst(then_stmt->blockInsts);
-    
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     return true;
 }
@@ -1312,14 +1147,10 @@ bool IRGenerator::ir_if_else(ast_node * node)
     LabelInstruction * endLabel = create_new_label();
     
     // 生成条件跳转指令
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), cond->val, thenLabel, elseLabel);
-    
-    // 添加条件计算和分支指令
-    node->blockInsts.addInst(cond->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(cond->val, thenLabel, elseLabel);
     
     // 添加真分支标签
-    node->blockInsts.addInst(thenLabel);
+    builder.insert(thenLabel);
     
     // 生成真分支语句
     ast_node * then_stmt = ir_visit_ast_node(then_node);
@@ -1327,13 +1158,11 @@ bool IRGenerator::ir_if_else(ast_node * node)
         return false;
     }
     
-    // 添加真分支语句和跳转到结束指令
-    node->blockInsts.addInst(then_stmt->blockInsts);
-    GotoInstruction * gotoEnd = new GotoInstruction(module->getCurrentFunction(), endLabel);
-    node->blockInsts.addInst(gotoEnd);
+    // 真分支结束后跳转到结束标签
+    builder.create<GotoInstruction>(endLabel);
     
     // 添加假分支标签
-    node->blockInsts.addInst(elseLabel);
+    builder.insert(elseLabel);
     
     // 生成假分支语句
     ast_node * else_stmt = ir_visit_ast_node(else_node);
@@ -1341,11 +1170,8 @@ bool IRGenerator::ir_if_else(ast_node * node)
         return false;
     }
     
-    // 添加假分支语句
-    node->blockInsts.addInst(else_stmt->blockInsts);
-    
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     return true;
 }
@@ -1369,11 +1195,10 @@ bool IRGenerator::ir_while(ast_node * node)
     loopExitLabels.push(endLabel);
     
     // 首先跳转到条件标签
-    GotoInstruction * gotoCondition = new GotoInstruction(module->getCurrentFunction(), condLabel);
-    node->blockInsts.addInst(gotoCondition);
+    builder.create<GotoInstruction>(condLabel);
     
     // 添加条件标签
-    node->blockInsts.addInst(condLabel);
+    builder.insert(condLabel);
     
     // 生成条件表达式
     ast_node * cond = ir_visit_ast_node(cond_node);
@@ -1385,14 +1210,10 @@ bool IRGenerator::ir_while(ast_node * node)
     }
     
     // 生成条件跳转指令
-    CondBrInstruction * condBr = new CondBrInstruction(module->getCurrentFunction(), cond->val, bodyLabel, endLabel);
-    
-    // 添加条件计算和分支指令
-    node->blockInsts.addInst(cond->blockInsts);
-    node->blockInsts.addInst(condBr);
+    builder.create<CondBrInstruction>(cond->val, bodyLabel, endLabel);
     
     // 添加循环体标签
-    node->blockInsts.addInst(bodyLabel);
+    builder.insert(bodyLabel);
     
     // 生成循环体语句
     ast_node * body_stmt = ir_visit_ast_node(body_node);
@@ -1403,13 +1224,11 @@ bool IRGenerator::ir_while(ast_node * node)
         return false;
     }
     
-    // 添加循环体语句和跳转回条件判断
-    node->blockInsts.addInst(body_stmt->blockInsts);
-    GotoInstruction * gotoCondition2 = new GotoInstruction(module->getCurrentFunction(), condLabel);
-    node->blockInsts.addInst(gotoCondition2);
+    // 循环体结束后跳转回条件判断
+    builder.create<GotoInstruction>(condLabel);
     
     // 添加结束标签
-    node->blockInsts.addInst(endLabel);
+    builder.insert(endLabel);
     
     // 处理完循环后，弹出标签栈
     loopEntryLabels.pop();
@@ -1433,8 +1252,7 @@ bool IRGenerator::ir_break(ast_node * node)
     LabelInstruction * exitLabel = loopExitLabels.top();
     
     // 生成跳转指令
-    GotoInstruction * gotoExit = new GotoInstruction(module->getCurrentFunction(), exitLabel);
-    node->blockInsts.addInst(gotoExit);
+    builder.create<GotoInstruction>(exitLabel);
     
     return true;
 }
@@ -1454,8 +1272,7 @@ bool IRGenerator::ir_continue(ast_node * node)
     LabelInstruction * entryLabel = loopEntryLabels.top();
     
     // 生成跳转指令
-    GotoInstruction * gotoEntry = new GotoInstruction(module->getCurrentFunction(), entryLabel);
-    node->blockInsts.addInst(gotoEntry);
+    builder.create<GotoInstruction>(entryLabel);
 
     return true;
 }
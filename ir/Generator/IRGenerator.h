@@ -20,6 +20,7 @@
 #include <stack>
 
 #include "AST.h"
+#include "IRBuilder.h"
 #include "Module.h"
 #include "LabelInstruction.h"
 
@@ -230,6 +231,9 @@ private:
 
     /// @brief 符号表:模块
     Module * module;
+
+    /// @brief 指令插入点构造器，翻译产生的指令直接插入到当前函数中
+    IRBuilder builder;
     
     /// @brief 当前循环的出口标签栈，用于break语句
     std::stack<LabelInstruction *> loopExitLabels;
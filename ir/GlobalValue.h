@@ -65,15 +65,14 @@ public:
     ///
     GlobalValue(Type * _type, std::string _name) : Constant(_type)
     {
-        this->name = _name;
-        this->IRName = IR_GLOBAL_VARNAME_PREFIX + this->name;
+        setName(_name);
     }
 
-    /// @brief 获取名字
+    /// @brief 获取名字，全局符号的IR名字由名字加前缀得到
     /// @return 变量名
     [[nodiscard]] std::string getIRName() const override
     {
-        return IRName;
+        return IR_GLOBAL_VARNAME_PREFIX + getName();
     }
 
     ///
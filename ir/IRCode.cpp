@@ -25,13 +25,8 @@ InterCode::~InterCode()
 /// @param block 指令块，请注意加入后会自动清空block的指令
 void InterCode::addInst(InterCode & block)
 {
-    std::vector<Instruction *> & insert = block.getInsts();
-
-    code.insert(code.end(), insert.begin(), insert.end());
-
-    // InterCode析构会清理资源，因此移动指令到code中后必须清理，否则会释放多次导致程序例外
-    // 当然，这里也可不清理，但InterCode的析构函数不能清理，需专门的函数清理即可。
-    insert.clear();
+    // 指令直接从block的链表中摘下拼接到尾部，block随之变为空
+    code.splice(code.end(), block.getInsts());
 }
 
 /// @brief 添加一条中间指令
@@ -43,7 +38,7 @@ void InterCode::addInst(Instruction * inst)
 
 /// @brief 获取指令序列
 /// @return 指令序列
-std::vector<Instruction *> & InterCode::getInsts()
+InstList & InterCode::getInsts()
 {
     return code;
 }
@@ -51,15 +46,6 @@ std::vector<Instruction *> & InterCode::getInsts()
 /// @brief 删除所有指令
 void InterCode::Delete()
 {
-    // 不能直接删除指令，需要先清除操作数
-    for (auto inst: code) {
-        inst->clearOperands();
-    }
-
-    // 资源清理
-    for (auto inst: code) {
-        delete inst;
-    }
-
+    // 指令在所属函数的内存池中，随函数统一释放，这里只清除序列
     code.clear();
 }
@@ -16,16 +16,14 @@
 
 #pragma once
 
-#include <vector>
-
-#include "Instruction.h"
+#include "InstList.h"
 
 /// @brief 中间IR指令序列管理类
 class InterCode {
 
 protected:
-    /// @brief 指令块的指令序列
-    std::vector<Instruction *> code;
+    /// @brief 指令块的指令序列，侵入式链表，拼接指令块时不需要复制
+    InstList code;
 
 public:
     /// @brief 构造函数
@@ -44,7 +42,7 @@ public:
 
     /// @brief 获取指令序列
     /// @return 指令序列
-    std::vector<Instruction *> & getInsts();
+    InstList & getInsts();
 
     /// @brief 删除所有指令
     void Delete();
@@ -0,0 +1,188 @@
+///
+/// @file InstList.cpp
+/// @brief 侵入式的IR指令双向链表
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "InstList.h"
+
+///
+/// @brief 在尾部追加指令
+/// @param inst 不在任何链表中的指令
+///
+void InstList::push_back(Instruction * inst)
+{
+    insert(end(), inst);
+}
+
+///
+/// @brief 在头部插入指令
+/// @param inst 不在任何链表中的指令
+///
+void InstList::push_front(Instruction * inst)
+{
+    insert(begin(), inst);
+}
+
+///
+/// @brief 在pos之前插入指令
+/// @param pos 插入位置，end()表示追加到尾部
+/// @param inst 不在任何链表中的指令
+/// @return iterator 指向插入指令的迭代器
+///
+InstList::iterator InstList::insert(iterator pos, Instruction * inst)
+{
+    link(pos, inst, inst);
+    count++;
+
+    return iterator(inst, this);
+}
+
+///
+/// @brief 从链表中移除pos所指的指令，指令本身不释放
+/// @param pos 要移除的指令
+/// @return iterator 被移除指令的下一个位置
+///
+InstList::iterator InstList::erase(iterator pos)
+{
+    Instruction * inst = *pos;
+    Instruction * next = inst->nextInst;
+
+    remove(inst);
+
+    return iterator(next, this);
+}
+
+///
+/// @brief 从链表中移除指令，指令本身不释放
+/// @param inst 链表中的指令
+///
+void InstList::remove(Instruction * inst)
+{
+    unlink(inst, inst);
+    count--;
+}
+
+///
+/// @brief 把other的所有指令移动到pos之前，other变为空
+/// @param pos 插入位置
+/// @param other 另一个链表
+///
+void InstList::splice(iterator pos, InstList & other)
+{
+    if (&other == this || other.empty()) {
+        return;
+    }
+
+    Instruction * first = other.head;
+    Instruction * lastInst = other.tail;
+    size_t num = other.count;
+
+    other.clear();
+
+    link(pos, first, lastInst);
+    count += num;
+}
+
+///
+/// @brief 把other中[first, last)范围的指令移动到pos之前，other可以就是本链表，
+/// 此时pos不能在[first, last)之内。同一链表内移动为O(1)，跨链表移动需要统计移动的个数
+/// @param pos 插入位置
+/// @param other 指令所在的链表
+/// @param first 范围的开始
+/// @param last 范围的结束，不含
+///
+void InstList::splice(iterator pos, InstList & other, iterator first, iterator last)
+{
+    if (first == last || pos == last) {
+        // 空范围，或者范围已经紧挨在pos之前
+        return;
+    }
+
+    Instruction * firstInst = *first;
+    Instruction * lastInst = *last ? (*last)->prevInst : other.tail;
+
+    if (&other != this) {
+        size_t num = 0;
+        for (auto iter = first; iter != last; ++iter) {
+            num++;
+        }
+        other.count -= num;
+        count += num;
+    }
+
+    other.unlink(firstInst, lastInst);
+    link(pos, firstInst, lastInst);
+}
+
+///
+/// @brief 清空链表，指令本身不释放
+///
+void InstList::clear()
+{
+    head = nullptr;
+    tail = nullptr;
+    count = 0;
+}
+
+///
+/// @brief 把[first, lastInst]的指令段链接到pos之前
+/// @param pos 插入位置
+/// @param first 指令段的第一条指令
+/// @param lastInst 指令段的最后一条指令
+///
+void InstList::link(iterator pos, Instruction * first, Instruction * lastInst)
+{
+    Instruction * next = *pos;
+    Instruction * prev = next ? next->prevInst : tail;
+
+    first->prevInst = prev;
+    lastInst->nextInst = next;
+
+    if (prev) {
+        prev->nextInst = first;
+    } else {
+        head = first;
+    }
+
+    if (next) {
+        next->prevInst = lastInst;
+    } else {
+        tail = lastInst;
+    }
+}
+
+///
+/// @brief 把[first, lastInst]的指令段从链表中断开
+/// @param first 指令段的第一条指令
+/// @param lastInst 指令段的最后一条指令
+///
+void InstList::unlink(Instruction * first, Instruction * lastInst)
+{
+    Instruction * prev = first->prevInst;
+    Instruction * next = lastInst->nextInst;
+
+    if (prev) {
+        prev->nextInst = next;
+    } else {
+        head = next;
+    }
+
+    if (next) {
+        next->prevInst = prev;
+    } else {
+        tail = prev;
+    }
+
+    first->prevInst = nullptr;
+    lastInst->nextInst = nullptr;
+}
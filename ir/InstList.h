@@ -0,0 +1,287 @@
+///
+/// @file InstList.h
+/// @brief 侵入式的IR指令双向链表
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "Instruction.h"
+
+///
+/// @brief 侵入式的指令双向链表，链接指针就在指令对象中，因此一条指令同一时刻只能在一个链表中。
+/// 插入、删除与拼接都是O(1)，插入或删除其它指令不会使指向某条指令的迭代器失效。
+///
+class InstList {
+
+public:
+    ///
+    /// @brief 双向迭代器，解引用得到指令
+    ///
+    class iterator {
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Instruction *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Instruction **;
+        using reference = Instruction *;
+
+        iterator() = default;
+
+        ///
+        /// @brief 构造函数
+        /// @param _node 指向的指令，nullptr表示链表尾部
+        /// @param _list 所在链表，从尾部回退时使用
+        ///
+        iterator(Instruction * _node, InstList * _list) : node(_node), list(_list)
+        {}
+
+        Instruction * operator*() const
+        {
+            return node;
+        }
+
+        iterator & operator++()
+        {
+            node = node->nextInst;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator old = *this;
+            node = node->nextInst;
+            return old;
+        }
+
+        iterator & operator--()
+        {
+            node = node ? node->prevInst : list->tail;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const iterator & other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const iterator & other) const
+        {
+            return node != other.node;
+        }
+
+    private:
+        ///
+        /// @brief 指向的指令，nullptr表示链表尾部
+        ///
+        Instruction * node = nullptr;
+
+        ///
+        /// @brief 所在链表
+        ///
+        InstList * list = nullptr;
+    };
+
+    InstList() = default;
+
+    InstList(const InstList &) = delete;
+    InstList & operator=(const InstList &) = delete;
+
+    iterator begin()
+    {
+        return iterator(head, this);
+    }
+
+    iterator end()
+    {
+        return iterator(nullptr, this);
+    }
+
+    ///
+    /// @brief 获取指向链表中指定指令的迭代器
+    /// @param inst 链表中的指令
+    /// @return iterator 迭代器
+    ///
+    iterator getIterator(Instruction * inst)
+    {
+        return iterator(inst, this);
+    }
+
+    ///
+    /// @brief 链表是否为空
+    /// @return true 为空
+    ///
+    bool empty() const
+    {
+        return head == nullptr;
+    }
+
+    ///
+    /// @brief 获取指令个数
+    /// @return size_t 指令个数
+    ///
+    size_t size() const
+    {
+        return count;
+    }
+
+    ///
+    /// @brief 获取第一条指令
+    /// @return Instruction* 指令，为空时返回nullptr
+    ///
+    Instruction * front()
+    {
+        return head;
+    }
+
+    ///
+    /// @brief 获取最后一条指令
+    /// @return Instruction* 指令，为空时返回nullptr
+    ///
+    Instruction * back()
+    {
+        return tail;
+    }
+
+    ///
+    /// @brief 在尾部追加指令
+    /// @param inst 不在任何链表中的指令
+    ///
+    void push_back(Instruction * inst);
+
+    ///
+    /// @brief 在头部插入指令
+    /// @param inst 不在任何链表中的指令
+    ///
+    void push_front(Instruction * inst);
+
+    ///
+    /// @brief 在pos之前插入指令
+    /// @param pos 插入位置，end()表示追加到尾部
+    /// @param inst 不在任何链表中的指令
+    /// @return iterator 指向插入指令的迭代器
+    ///
+    iterator insert(iterator pos, Instruction * inst);
+
+    ///
+    /// @brief 从链表中移除pos所指的指令，指令本身不释放
+    /// @param pos 要移除的指令
+    /// @return iterator 被移除指令的下一个位置
+    ///
+    iterator erase(iterator pos);
+
+    ///
+    /// @brief 从链表中移除指令，指令本身不释放
+    /// @param inst 链表中的指令
+    ///
+    void remove(Instruction * inst);
+
+    ///
+    /// @brief 把other的所有指令移动到pos之前，other变为空
+    /// @param pos 插入位置
+    /// @param other 另一个链表
+    ///
+    void splice(iterator pos, InstList & other);
+
+    ///
+    /// @brief 把other中[first, last)范围的指令移动到pos之前，other可以就是本链表，
+    /// 此时pos不能在[first, last)之内。同一链表内移动为O(1)，跨链表移动需要统计移动的个数
+    /// @param pos 插入位置
+    /// @param other 指令所在的链表
+    /// @param first 范围的开始
+    /// @param last 范围的结束，不含
+    ///
+    void splice(iterator pos, InstList & other, iterator first, iterator last);
+
+    ///
+    /// @brief 清空链表，指令本身不释放
+    ///
+    void clear();
+
+private:
+    ///
+    /// @brief 把[first, lastInst]的指令段链接到pos之前
+    /// @param pos 插入位置
+    /// @param first 指令段的第一条指令
+    /// @param lastInst 指令段的最后一条指令
+    ///
+    void link(iterator pos, Instruction * first, Instruction * lastInst);
+
+    ///
+    /// @brief 把[first, lastInst]的指令段从链表中断开
+    /// @param first 指令段的第一条指令
+    /// @param lastInst 指令段的最后一条指令
+    ///
+    void unlink(Instruction * first, Instruction * lastInst);
+
+    ///
+    /// @brief 第一条指令
+    ///
+    Instruction * head = nullptr;
+
+    ///
+    /// @brief 最后一条指令
+    ///
+    Instruction * tail = nullptr;
+
+    ///
+    /// @brief 指令个数
+    ///
+    size_t count = 0;
+};
+
+///
+/// @brief 链表中一段连续的指令，用于基本块的遍历
+///
+class InstRange {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _first 范围的开始
+    /// @param _last 范围的结束，不含
+    ///
+    InstRange(InstList::iterator _first, InstList::iterator _last) : first(_first), last(_last)
+    {}
+
+    InstList::iterator begin() const
+    {
+        return first;
+    }
+
+    InstList::iterator end() const
+    {
+        return last;
+    }
+
+private:
+    ///
+    /// @brief 范围的开始
+    ///
+    InstList::iterator first;
+
+    ///
+    /// @brief 范围的结束，不含
+    ///
+    InstList::iterator last;
+};
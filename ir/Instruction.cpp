@@ -63,6 +63,24 @@ Function * Instruction::getFunction()
     return func;
 }
 
+///
+/// @brief 获取当前指令所在的基本块
+/// @return BasicBlock* 基本块，未划分基本块时为nullptr
+///
+BasicBlock * Instruction::getParent()
+{
+    return parent;
+}
+
+///
+/// @brief 设置当前指令所在的基本块
+/// @param _parent 基本块
+///
+void Instruction::setParent(BasicBlock * _parent)
+{
+    parent = _parent;
+}
+
 ///
 /// @brief 检查指令是否有值
 /// @return true
@@ -71,4 +89,31 @@ Function * Instruction::getFunction()
 bool Instruction::hasResultValue()
 {
     return !type->isVoidType();
-}
\ No newline at end of file
+}
+
+///
+/// @brief 获取所在指令链表中的前一条指令
+/// @return Instruction* 前一条指令，没有时为nullptr
+///
+Instruction * Instruction::getPrevInst()
+{
+    return prevInst;
+}
+
+///
+/// @brief 获取所在指令链表中的后一条指令
+/// @return Instruction* 后一条指令，没有时为nullptr
+///
+Instruction * Instruction::getNextInst()
+{
+    return nextInst;
+}
+
+///
+/// @brief 操作数的Use在所属函数的内存池中创建
+/// @return Arena* 所属函数的内存池
+///
+Arena * Instruction::getUseArena()
+{
+    return func ? &func->getArena() : nullptr;
+}
@@ -18,6 +18,7 @@
 #include "User.h"
 
 class Function;
+class BasicBlock;
 
 /// @brief IR指令操作码
 enum class IRInstOperator : std::int8_t {
@@ -52,7 +53,7 @@ enum class IRInstOperator : std::int8_t {
     /// @brief 整数的求余指令，二元运算
     IRINST_OP_MOD_I,
 
-    /// @brief 整数的求负指令，一元运算
+    /// @brief 整数的求负指令，一元运算，第一个操作数为常量0，第二个操作数为求负的值
     IRINST_OP_NEG_I,
     
     /// @brief 整数的等于比较指令，二元运算
@@ -73,6 +74,27 @@ enum class IRInstOperator : std::int8_t {
     /// @brief 整数的大于等于比较指令，二元运算
     IRINST_OP_GE_I,
 
+    /// @brief 整数的左移指令，二元运算
+    IRINST_OP_SHL_I,
+
+    /// @brief 整数的算术右移指令，二元运算
+    IRINST_OP_ASHR_I,
+
+    /// @brief 整数的逻辑右移指令，二元运算
+    IRINST_OP_LSHR_I,
+
+    /// @brief 整数的最小值指令，二元运算
+    IRINST_OP_MIN_I,
+
+    /// @brief 整数的最大值指令，二元运算
+    IRINST_OP_MAX_I,
+
+    /// @brief 整数的绝对值指令，一元运算，与求负指令一样第一个操作数为常量0
+    IRINST_OP_ABS_I,
+
+    /// @brief 整数的乘法取高32位指令，二元运算，即64位乘积算术右移32位
+    IRINST_OP_MULH_I,
+
     /// @brief 赋值指令，一元运算
     IRINST_OP_ASSIGN,
 
@@ -82,6 +104,12 @@ enum class IRInstOperator : std::int8_t {
     /// @brief 实参ARG指令，单目运算
     IRINST_OP_ARG,
 
+    /// @brief SSA形式的Phi指令，根据进入基本块的前驱选择值，多目运算
+    IRINST_OP_PHI,
+
+    /// @brief 读取全局变量的值，一元运算
+    IRINST_OP_LOAD,
+
     /* 后续可追加其他的IR指令 */
 
     /// @brief 最大指令码，也是无效指令
@@ -93,6 +121,9 @@ enum class IRInstOperator : std::int8_t {
 ///
 class Instruction : public User {
 
+    /// 链表通过指令中的指针链接
+    friend class InstList;
+
 public:
     /// @brief 构造函数
     /// @param op
@@ -125,6 +156,30 @@ public:
     ///
     Function * getFunction();
 
+    ///
+    /// @brief 获取当前指令所在的基本块
+    /// @return BasicBlock* 基本块，未划分基本块时为nullptr
+    ///
+    BasicBlock * getParent();
+
+    ///
+    /// @brief 设置当前指令所在的基本块
+    /// @param _parent 基本块
+    ///
+    void setParent(BasicBlock * _parent);
+
+    ///
+    /// @brief 获取所在指令链表中的前一条指令
+    /// @return Instruction* 前一条指令，没有时为nullptr
+    ///
+    Instruction * getPrevInst();
+
+    ///
+    /// @brief 获取所在指令链表中的后一条指令
+    /// @return Instruction* 后一条指令，没有时为nullptr
+    ///
+    Instruction * getNextInst();
+
     ///
     /// @brief 检查指令是否有值
     /// @return true
@@ -141,6 +196,15 @@ public:
         return regId;
     }
 
+    ///
+    /// @brief 设置寄存器编号
+    /// @param _regId 寄存器编号
+    ///
+    void setRegId(int32_t _regId) override
+    {
+        this->regId = _regId;
+    }
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
@@ -200,6 +264,12 @@ public:
     }
 
 protected:
+    ///
+    /// @brief 操作数的Use在所属函数的内存池中创建
+    /// @return Arena* 所属函数的内存池
+    ///
+    Arena * getUseArena() override;
+
     ///
     /// @brief IR指令操作码
     ///
@@ -215,6 +285,21 @@ protected:
     ///
     Function * func = nullptr;
 
+    ///
+    /// @brief 指令所在的基本块
+    ///
+    BasicBlock * parent = nullptr;
+
+    ///
+    /// @brief 所在指令链表中的前一条指令
+    ///
+    Instruction * prevInst = nullptr;
+
+    ///
+    /// @brief 所在指令链表中的后一条指令
+    ///
+    Instruction * nextInst = nullptr;
+
     ///
     /// @brief 寄存器编号，-1表示没有分配寄存器，大于等于0代表是寄存器型Value
     ///
@@ -65,6 +65,54 @@ void BinaryInstruction::toString(std::string & str)
             // 求余指令，二元运算
             str = getIRName() + " = mod " + src1->getIRName() + "," + src2->getIRName();
             break;
+
+        case IRInstOperator::IRINST_OP_NEG_I:
+
+            // 求负指令，一元运算，第一个操作数为常量0
+            str = getIRName() + " = neg " + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_ABS_I:
+
+            // 绝对值指令，一元运算，第一个操作数为常量0
+            str = getIRName() + " = abs " + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_SHL_I:
+
+            // 左移指令，二元运算
+            str = getIRName() + " = shl " + src1->getIRName() + "," + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_ASHR_I:
+
+            // 算术右移指令，二元运算
+            str = getIRName() + " = ashr " + src1->getIRName() + "," + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_LSHR_I:
+
+            // 逻辑右移指令，二元运算
+            str = getIRName() + " = lshr " + src1->getIRName() + "," + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_MIN_I:
+
+            // 最小值指令，二元运算
+            str = getIRName() + " = min " + src1->getIRName() + "," + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_MAX_I:
+
+            // 最大值指令，二元运算
+            str = getIRName() + " = max " + src1->getIRName() + "," + src2->getIRName();
+            break;
+
+        case IRInstOperator::IRINST_OP_MULH_I:
+
+            // 乘法取高32位指令，二元运算
+            str = getIRName() + " = mulh " + src1->getIRName() + "," + src2->getIRName();
+            break;
             
         case IRInstOperator::IRINST_OP_EQ_I:
             // 等于比较指令，二元运算
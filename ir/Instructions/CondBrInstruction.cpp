@@ -28,7 +28,6 @@
 CondBrInstruction::CondBrInstruction(Function * _func, Value * _cond, LabelInstruction * _trueTarget, LabelInstruction * _falseTarget)
     : Instruction(_func, IRInstOperator::IRINST_OP_COND_BR, VoidType::getType())
 {
-    condition = _cond;
     trueTarget = _trueTarget;
     falseTarget = _falseTarget;
     
@@ -39,16 +38,17 @@ CondBrInstruction::CondBrInstruction(Function * _func, Value * _cond, LabelInstr
 /// @brief 转换成IR指令文本
 void CondBrInstruction::toString(std::string & str)
 {
-    str = "bc " + condition->getIRName() + ", label " + trueTarget->getIRName() + ", label " + falseTarget->getIRName();
+    str = "bc " + getCondition()->getIRName() + ", label " + trueTarget->getIRName() + ", label " + falseTarget->getIRName();
 }
 
 ///
 /// @brief 获取条件值
 /// @return 条件值
 ///
-Value * CondBrInstruction::getCondition() const
+Value * CondBrInstruction::getCondition()
 {
-    return condition;
+    // 条件值保存在操作数中，优化时替换操作数即可更新条件
+    return getOperand(0);
 }
 
 ///
@@ -67,4 +67,22 @@ LabelInstruction * CondBrInstruction::getTrueTarget() const
 LabelInstruction * CondBrInstruction::getFalseTarget() const
 {
     return falseTarget;
-} 
\ No newline at end of file
+} 
+
+///
+/// @brief 修改条件为真时的跳转目标，用于控制流边的拆分等
+/// @param target 真分支目标
+///
+void CondBrInstruction::setTrueTarget(LabelInstruction * target)
+{
+    trueTarget = target;
+}
+
+///
+/// @brief 修改条件为假时的跳转目标，用于控制流边的拆分等
+/// @param target 假分支目标
+///
+void CondBrInstruction::setFalseTarget(LabelInstruction * target)
+{
+    falseTarget = target;
+}
@@ -44,7 +44,7 @@ public:
     /// @brief 获取条件值
     /// @return 条件值
     ///
-    [[nodiscard]] Value * getCondition() const;
+    [[nodiscard]] Value * getCondition();
 
     ///
     /// @brief 获取条件为真时的跳转目标
@@ -58,12 +58,19 @@ public:
     ///
     [[nodiscard]] LabelInstruction * getFalseTarget() const;
 
-private:
     ///
-    /// @brief 条件值
+    /// @brief 修改条件为真时的跳转目标，用于控制流边的拆分等
+    /// @param target 真分支目标
     ///
-    Value * condition;
+    void setTrueTarget(LabelInstruction * target);
 
+    ///
+    /// @brief 修改条件为假时的跳转目标，用于控制流边的拆分等
+    /// @param target 假分支目标
+    ///
+    void setFalseTarget(LabelInstruction * target);
+
+private:
     ///
     /// @brief 条件为真时跳转目标
     ///
@@ -27,8 +27,6 @@ FuncCallInstruction::FuncCallInstruction(Function * _func,
                                          Type * _type)
     : Instruction(_func, IRInstOperator::IRINST_OP_FUNC_CALL, _type), calledFunction(calledFunc)
 {
-    name = calledFunc->getName();
-
     // 实参拷贝
     for (auto & val: _srcVal) {
         addOperand(val);
@@ -92,3 +90,12 @@ std::string FuncCallInstruction::getCalledName() const
 {
     return calledFunction->getName();
 }
+
+///
+/// @brief 获取名字，即被调用函数的名字，不在指令中另存一份
+/// @return 被调用函数名字
+///
+const std::string & FuncCallInstruction::getName() const
+{
+    return calledFunction->getName();
+}
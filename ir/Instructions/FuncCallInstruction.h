@@ -51,4 +51,10 @@ public:
     /// @return std::string 被调用函数名字
     ///
     [[nodiscard]] std::string getCalledName() const;
+
+    ///
+    /// @brief 获取名字，即被调用函数的名字，不在指令中另存一份
+    /// @return 被调用函数名字
+    ///
+    [[nodiscard]] const std::string & getName() const override;
 };
@@ -44,3 +44,12 @@ LabelInstruction * GotoInstruction::getTarget() const
 {
     return target;
 }
+
+///
+/// @brief 修改跳转目标，用于插入循环的前置基本块等
+/// @param _target 跳转目标
+///
+void GotoInstruction::setTarget(LabelInstruction * _target)
+{
+    target = _target;
+}
@@ -43,6 +43,12 @@ public:
     ///
     [[nodiscard]] LabelInstruction * getTarget() const;
 
+    ///
+    /// @brief 修改跳转目标，用于插入循环的前置基本块等
+    /// @param _target 跳转目标
+    ///
+    void setTarget(LabelInstruction * _target);
+
 private:
     ///
     /// @brief 跳转到的目标Label指令
@@ -13,6 +13,7 @@
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
 /// </table>
 ///
+#include "IRConstant.h"
 #include "VoidType.h"
 
 #include "LabelInstruction.h"
@@ -29,5 +30,14 @@ LabelInstruction::LabelInstruction(Function * _func)
 /// @param str 返回指令字符串
 void LabelInstruction::toString(std::string & str)
 {
-    str = IRName + ":";
+    str = getIRName() + ":";
+}
+
+///
+/// @brief 获取IR名字的前缀
+/// @return const char* 前缀
+///
+const char * LabelInstruction::getIRNamePrefix() const
+{
+    return IR_LABEL_PREFIX;
 }
@@ -39,4 +39,10 @@ public:
     /// @param str 返回指令字符串
     ///
     void toString(std::string & str) override;
+
+    ///
+    /// @brief 获取IR名字的前缀
+    /// @return const char* 前缀
+    ///
+    [[nodiscard]] const char * getIRNamePrefix() const override;
 };
@@ -0,0 +1,35 @@
+///
+/// @file LoadInstruction.cpp
+/// @brief 读取全局变量的指令
+///
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "LoadInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 所属的函数
+/// @param _var 读取的全局变量
+///
+LoadInstruction::LoadInstruction(Function * _func, Value * _var)
+    : Instruction(_func, IRInstOperator::IRINST_OP_LOAD, _var->getType())
+{
+    addOperand(_var);
+}
+
+/// @brief 转换成字符串显示
+/// @param str 转换后的字符串
+void LoadInstruction::toString(std::string & str)
+{
+    str = getIRName() + " = " + getOperand(0)->getIRName();
+}
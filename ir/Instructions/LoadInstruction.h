@@ -0,0 +1,41 @@
+///
+/// @file LoadInstruction.h
+/// @brief 读取全局变量的指令
+///
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+
+#include "Instruction.h"
+
+class Function;
+
+///
+/// @brief 读取全局变量的指令，结果为执行时全局变量的值。
+/// 全局变量不是SSA值，需要在某一时刻取其值的地方（如提升的局部变量从全局变量赋值）使用本指令
+///
+class LoadInstruction : public Instruction {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 所属的函数
+    /// @param _var 读取的全局变量
+    ///
+    LoadInstruction(Function * _func, Value * _var);
+
+    /// @brief 转换成字符串
+    void toString(std::string & str) override;
+};
@@ -0,0 +1,136 @@
+///
+/// @file PhiInstruction.cpp
+/// @brief SSA形式的Phi指令
+///
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "BasicBlock.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _func 所属的函数
+/// @param _type 值的类型
+///
+PhiInstruction::PhiInstruction(Function * _func, Type * _type)
+    : Instruction(_func, IRInstOperator::IRINST_OP_PHI, _type)
+{}
+
+///
+/// @brief 增加一个来源
+/// @param val 来源的值
+/// @param bb 来源基本块
+///
+void PhiInstruction::addIncoming(Value * val, BasicBlock * bb)
+{
+    addOperand(val);
+    incomingLabels.push_back(bb->getLabel());
+}
+
+///
+/// @brief 按首指令增加一个来源，用于来源基本块尚未划分的情况，如复制出的指令
+/// @param val 来源的值
+/// @param label 来源基本块的首指令
+///
+void PhiInstruction::addIncoming(Value * val, Instruction * label)
+{
+    addOperand(val);
+    incomingLabels.push_back(label);
+}
+
+///
+/// @brief 获取来源的个数
+/// @return int32_t 个数
+///
+int32_t PhiInstruction::getIncomingNum()
+{
+    return (int32_t) incomingLabels.size();
+}
+
+///
+/// @brief 获取第k个来源的值
+/// @param k 序号
+/// @return Value* 值
+///
+Value * PhiInstruction::getIncomingValue(int32_t k)
+{
+    return getOperand(k);
+}
+
+///
+/// @brief 获取第k个来源基本块
+/// @param k 序号
+/// @return BasicBlock* 基本块
+///
+BasicBlock * PhiInstruction::getIncomingBlock(int32_t k)
+{
+    return incomingLabels[k]->getParent();
+}
+
+///
+/// @brief 获取第k个来源基本块的首指令
+/// @param k 序号
+/// @return Instruction* 首指令
+///
+Instruction * PhiInstruction::getIncomingLabel(int32_t k)
+{
+    return incomingLabels[k];
+}
+
+///
+/// @brief 修改第k个来源基本块，用于控制流边的拆分等
+/// @param k 序号
+/// @param bb 基本块
+///
+void PhiInstruction::setIncomingBlock(int32_t k, BasicBlock * bb)
+{
+    incomingLabels[k] = bb->getLabel();
+}
+
+///
+/// @brief 获取从指定基本块进入时的值
+/// @param bb 来源基本块
+/// @return Value* 值，不存在时返回nullptr
+///
+Value * PhiInstruction::getIncomingValueForBlock(BasicBlock * bb)
+{
+    for (int32_t k = 0; k < (int32_t) incomingLabels.size(); ++k) {
+        if (incomingLabels[k] == bb->getLabel()) {
+            return getOperand(k);
+        }
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 删除第k个来源
+/// @param k 序号
+///
+void PhiInstruction::removeIncoming(int32_t k)
+{
+    removeOperand(k);
+    incomingLabels.erase(incomingLabels.begin() + k);
+}
+
+/// @brief 转换成字符串
+/// @param str 转换后的字符串
+void PhiInstruction::toString(std::string & str)
+{
+    str = getIRName() + " = phi " + getType()->toString();
+
+    for (int32_t k = 0; k < (int32_t) incomingLabels.size(); ++k) {
+        str += (k == 0) ? " [" : ", [";
+        str += getOperand(k)->getIRName() + ", " + getIncomingBlock(k)->getIRName() + "]";
+    }
+}
@@ -0,0 +1,111 @@
+///
+/// @file PhiInstruction.h
+/// @brief SSA形式的Phi指令
+///
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Instruction.h"
+
+class Function;
+class BasicBlock;
+
+///
+/// @brief Phi指令，位于基本块的Label之后、其它指令之前。
+/// 第k个操作数为从第k个来源基本块进入时的取值。来源基本块通过其首指令（Label或Entry指令）记录，
+/// 这样重新划分基本块后仍然有效
+///
+class PhiInstruction : public Instruction {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _func 所属的函数
+    /// @param _type 值的类型
+    ///
+    PhiInstruction(Function * _func, Type * _type);
+
+    ///
+    /// @brief 增加一个来源
+    /// @param val 来源的值
+    /// @param bb 来源基本块
+    ///
+    void addIncoming(Value * val, BasicBlock * bb);
+
+    ///
+    /// @brief 按首指令增加一个来源，用于来源基本块尚未划分的情况，如复制出的指令
+    /// @param val 来源的值
+    /// @param label 来源基本块的首指令
+    ///
+    void addIncoming(Value * val, Instruction * label);
+
+    ///
+    /// @brief 获取来源的个数
+    /// @return int32_t 个数
+    ///
+    int32_t getIncomingNum();
+
+    ///
+    /// @brief 获取第k个来源的值
+    /// @param k 序号
+    /// @return Value* 值
+    ///
+    Value * getIncomingValue(int32_t k);
+
+    ///
+    /// @brief 获取第k个来源基本块
+    /// @param k 序号
+    /// @return BasicBlock* 基本块
+    ///
+    BasicBlock * getIncomingBlock(int32_t k);
+
+    ///
+    /// @brief 获取第k个来源基本块的首指令
+    /// @param k 序号
+    /// @return Instruction* 首指令
+    ///
+    Instruction * getIncomingLabel(int32_t k);
+
+    ///
+    /// @brief 修改第k个来源基本块，用于控制流边的拆分等
+    /// @param k 序号
+    /// @param bb 基本块
+    ///
+    void setIncomingBlock(int32_t k, BasicBlock * bb);
+
+    ///
+    /// @brief 获取从指定基本块进入时的值
+    /// @param bb 来源基本块
+    /// @return Value* 值，不存在时返回nullptr
+    ///
+    Value * getIncomingValueForBlock(BasicBlock * bb);
+
+    ///
+    /// @brief 删除第k个来源
+    /// @param k 序号
+    ///
+    void removeIncoming(int32_t k);
+
+    /// @brief 转换成字符串
+    void toString(std::string & str) override;
+
+private:
+    ///
+    /// @brief 来源基本块的首指令，与操作数一一对应
+    ///
+    std::vector<Instruction *> incomingLabels;
+};
@@ -17,15 +17,43 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 
 #include "Type.h"
 
 class FunctionType final : public Type {
+
+    friend class TypeContext;
+
+    ///
+    /// @brief Hash用结构体，由返回类型与形参类型的指针计算Hash值
+    ///
+    struct FunctionTypeHasher final {
+        size_t operator()(const FunctionType & type) const noexcept
+        {
+            size_t hash = std::hash<const Type *>{}(type.getReturnType());
+            for (Type * argType: type.getArgTypes()) {
+                hash = hash * 31 + std::hash<const Type *>{}(argType);
+            }
+            return hash;
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，返回类型与各形参类型都相同即相等
+    ///
+    struct FunctionTypeEqual final {
+        bool operator()(const FunctionType & lhs, const FunctionType & rhs) const noexcept
+        {
+            return lhs.getReturnType() == rhs.getReturnType() && lhs.getArgTypes() == rhs.getArgTypes();
+        }
+    };
+
 public:
     ///
-    /// @brief 函数类型
+    /// @brief 函数类型，只供TypeContext唯一化时使用，其它地方请通过TypeContext获取类型
     /// @param retType 函数返回值类型
     /// @param argTypes 函数形参类型
     ///
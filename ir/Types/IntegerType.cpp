@@ -16,36 +16,22 @@
 ///
 
 #include "IntegerType.h"
+#include "TypeContext.h"
 
 ///
-/// @brief 唯一的VOID类型实例
-///
-IntegerType * IntegerType::oneInstanceBool;
-IntegerType * IntegerType::oneInstanceInt;
-
-///
-/// @brief 获取类型bool
-/// @return VoidType*
+/// @brief 获取bool类型，即共享类型上下文中的i1
+/// @return IntegerType*
 ///
 IntegerType * IntegerType::getTypeBool()
 {
-    // 只维持一份
-    if (!oneInstanceBool) {
-        oneInstanceBool = new IntegerType(1);
-    }
-    return oneInstanceBool;
+    return TypeContext::getContext().getInt1Type();
 }
 
 ///
-/// @brief 获取类型int
-/// @return VoidType*
+/// @brief 获取int类型，即共享类型上下文中的i32
+/// @return IntegerType*
 ///
 IntegerType * IntegerType::getTypeInt()
 {
-    // 只维持一份
-    if (!oneInstanceInt) {
-        oneInstanceInt = new IntegerType(32);
-    }
-
-    return oneInstanceInt;
+    return TypeContext::getContext().getInt32Type();
 }
@@ -18,21 +18,51 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 
 #include "Type.h"
 
 class IntegerType final : public Type {
 
+    friend class TypeContext;
+
+    ///
+    /// @brief Hash用结构体，按位宽计算Hash值
+    ///
+    struct IntegerTypeHasher final {
+        size_t operator()(const IntegerType & type) const noexcept
+        {
+            return std::hash<int32_t>{}(type.getBitWidth());
+        }
+    };
+
+    ///
+    /// @brief 判断两者相等的结构体，位宽相同即相等
+    ///
+    struct IntegerTypeEqual final {
+        bool operator()(const IntegerType & lhs, const IntegerType & rhs) const noexcept
+        {
+            return lhs.getBitWidth() == rhs.getBitWidth();
+        }
+    };
+
 public:
     ///
-    /// @brief 获取类型，全局只有一份
-    /// @return VoidType*
+    /// @brief 构造函数，只供TypeContext唯一化时使用，其它地方请通过TypeContext获取类型
+    /// @param _bitWidth 位宽
+    ///
+    explicit IntegerType(int32_t _bitWidth) : Type(Type::IntegerTyID), bitWidth(_bitWidth)
+    {}
+
+    ///
+    /// @brief 获取bool类型，即共享类型上下文中的i1
+    /// @return IntegerType*
     ///
     static IntegerType * getTypeBool();
 
     ///
-    /// @brief 获取类型，全局只有一份
-    /// @return VoidType*
+    /// @brief 获取int类型，即共享类型上下文中的i32
+    /// @return IntegerType*
     ///
     static IntegerType * getTypeInt();
 
@@ -84,22 +114,6 @@ public:
     }
 
 private:
-    ///
-    /// @brief 构造函数
-    ///
-    explicit IntegerType(int32_t _bitWidth) : Type(Type::IntegerTyID), bitWidth(_bitWidth)
-    {}
-
-    ///
-    /// @brief 唯一的VOID类型实例
-    ///
-    static IntegerType * oneInstanceBool;
-
-    ///
-    /// @brief 唯一的VOID类型实例
-    ///
-    static IntegerType * oneInstanceInt;
-
     ///
     /// @brief 位宽
     ///
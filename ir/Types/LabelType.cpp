@@ -16,17 +16,13 @@
 ///
 
 #include "LabelType.h"
+#include "TypeContext.h"
 
 ///
-/// @brief 唯一的VOID类型实例
-///
-LabelType * LabelType::oneInstance = new LabelType();
-
-///
-/// @brief 获取类型
-/// @return VoidType*
+/// @brief 获取类型，即共享类型上下文中唯一的label类型
+/// @return LabelType*
 ///
 LabelType * LabelType::getType()
 {
-    return oneInstance;
-}
\ No newline at end of file
+    return TypeContext::getContext().getLabelType();
+}
@@ -24,10 +24,12 @@
 ///
 class LabelType final : public Type {
 
+    friend class TypeContext;
+
 public:
     ///
-    /// @brief 获取类型，全局只有一份
-    /// @return VoidType*
+    /// @brief 获取类型，即共享类型上下文中唯一的label类型
+    /// @return LabelType*
     ///
     static LabelType * getType();
 
@@ -46,9 +48,4 @@ private:
     ///
     explicit LabelType() : Type(Type::LabelTyID)
     {}
-
-    ///
-    /// @brief 唯一的VOID类型实例
-    ///
-    static LabelType * oneInstance;
 };
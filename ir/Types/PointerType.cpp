@@ -0,0 +1,27 @@
+///
+/// @file PointerType.cpp
+/// @brief 指针类型描述类
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "PointerType.h"
+#include "TypeContext.h"
+
+///
+/// @brief 获取指针类型，即共享类型上下文中唯一化的指针类型
+/// @param pointee
+/// @return const PointerType*
+///
+const PointerType * PointerType::get(Type * pointee)
+{
+    return TypeContext::getContext().getPointerType(pointee);
+}
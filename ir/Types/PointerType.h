@@ -15,14 +15,18 @@
 ///
 #pragma once
 
+#include <cstdint>
+#include <functional>
+
 #include "Type.h"
-#include "StorageSet.h"
 
 ///
 /// @brief 指针类型
 ///
 class PointerType : public Type {
 
+    friend class TypeContext;
+
     ///
     /// @brief Hash用结构体，提供Hash函数
     ///
@@ -106,15 +110,11 @@ public:
     }
 
     ///
-    /// @brief 获取指针类型
+    /// @brief 获取指针类型，即共享类型上下文中唯一化的指针类型
     /// @param pointee
     /// @return const PointerType*
     ///
-    static const PointerType * get(Type * pointee)
-    {
-        static StorageSet<PointerType, PointerTypeHasher, PointerTypeEqual> storageSet;
-        return storageSet.get(pointee);
-    }
+    static const PointerType * get(Type * pointee);
 
     ///
     /// @brief 获取类型的IR标识符
@@ -0,0 +1,111 @@
+///
+/// @file TypeContext.cpp
+/// @brief 类型上下文，负责所有类型的唯一化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "TypeContext.h"
+
+///
+/// @brief 构造函数
+///
+TypeContext::TypeContext()
+{
+    int1Type = getIntegerType(1);
+    int32Type = getIntegerType(32);
+}
+
+///
+/// @brief 获取共享的类型上下文，模块以及IntegerType::getTypeInt()等快捷函数都使用它
+/// @return TypeContext& 类型上下文
+///
+TypeContext & TypeContext::getContext()
+{
+    // 局部静态变量的初始化是线程安全的，也不受全局变量初始化顺序的影响。
+    // 类型在程序运行期间一直被引用，因此不释放
+    static TypeContext * context = new TypeContext();
+    return *context;
+}
+
+///
+/// @brief 获取void类型
+/// @return VoidType* 类型
+///
+VoidType * TypeContext::getVoidType()
+{
+    return &voidType;
+}
+
+///
+/// @brief 获取label类型
+/// @return LabelType* 类型
+///
+LabelType * TypeContext::getLabelType()
+{
+    return &labelType;
+}
+
+///
+/// @brief 获取指定位宽的整数类型
+/// @param bitWidth 位宽
+/// @return IntegerType* 类型
+///
+IntegerType * TypeContext::getIntegerType(int32_t bitWidth)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // 类型创建后不再修改，集合中的元素为const，对外以非const指针使用
+    return const_cast<IntegerType *>(integerTypes.get(bitWidth));
+}
+
+///
+/// @brief 获取bool类型，即1位整数类型
+/// @return IntegerType* 类型
+///
+IntegerType * TypeContext::getInt1Type()
+{
+    return int1Type;
+}
+
+///
+/// @brief 获取int类型，即32位整数类型
+/// @return IntegerType* 类型
+///
+IntegerType * TypeContext::getInt32Type()
+{
+    return int32Type;
+}
+
+///
+/// @brief 获取指针类型
+/// @param pointee 指向的类型
+/// @return const PointerType* 类型
+///
+const PointerType * TypeContext::getPointerType(const Type * pointee)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return pointerTypes.get(pointee);
+}
+
+///
+/// @brief 获取函数类型
+/// @param retType 返回值类型
+/// @param argTypes 形参类型
+/// @return FunctionType* 类型
+///
+FunctionType * TypeContext::getFunctionType(Type * retType, const std::vector<Type *> & argTypes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return const_cast<FunctionType *>(functionTypes.get(retType, argTypes));
+}
@@ -0,0 +1,143 @@
+///
+/// @file TypeContext.h
+/// @brief 类型上下文，负责所有类型的唯一化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "FunctionType.h"
+#include "IntegerType.h"
+#include "LabelType.h"
+#include "PointerType.h"
+#include "StorageSet.h"
+#include "VoidType.h"
+
+///
+/// @brief 类型上下文。所有类型都经由上下文创建，同样的类型只有一份实例，
+/// 因此类型的比较只需比较指针。整数、指针与函数类型保存在StorageSet中，
+/// 创建时加锁，多个模块在不同线程中并发编译时可共享同一个上下文。
+/// 常用的void、label、i1与i32类型在构造时创建并缓存，获取时不需要加锁
+///
+class TypeContext {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    TypeContext();
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~TypeContext() = default;
+
+    TypeContext(const TypeContext &) = delete;
+    TypeContext & operator=(const TypeContext &) = delete;
+
+    ///
+    /// @brief 获取共享的类型上下文，模块以及IntegerType::getTypeInt()等快捷函数都使用它
+    /// @return TypeContext& 类型上下文
+    ///
+    static TypeContext & getContext();
+
+    ///
+    /// @brief 获取void类型
+    /// @return VoidType* 类型
+    ///
+    VoidType * getVoidType();
+
+    ///
+    /// @brief 获取label类型
+    /// @return LabelType* 类型
+    ///
+    LabelType * getLabelType();
+
+    ///
+    /// @brief 获取指定位宽的整数类型
+    /// @param bitWidth 位宽
+    /// @return IntegerType* 类型
+    ///
+    IntegerType * getIntegerType(int32_t bitWidth);
+
+    ///
+    /// @brief 获取bool类型，即1位整数类型
+    /// @return IntegerType* 类型
+    ///
+    IntegerType * getInt1Type();
+
+    ///
+    /// @brief 获取int类型，即32位整数类型
+    /// @return IntegerType* 类型
+    ///
+    IntegerType * getInt32Type();
+
+    ///
+    /// @brief 获取指针类型
+    /// @param pointee 指向的类型
+    /// @return const PointerType* 类型
+    ///
+    const PointerType * getPointerType(const Type * pointee);
+
+    ///
+    /// @brief 获取函数类型
+    /// @param retType 返回值类型
+    /// @param argTypes 形参类型
+    /// @return FunctionType* 类型
+    ///
+    FunctionType * getFunctionType(Type * retType, const std::vector<Type *> & argTypes);
+
+private:
+    ///
+    /// @brief 保护各个类型集合的互斥锁
+    ///
+    std::mutex mutex;
+
+    ///
+    /// @brief 整数类型集合
+    ///
+    StorageSet<IntegerType, IntegerType::IntegerTypeHasher, IntegerType::IntegerTypeEqual> integerTypes;
+
+    ///
+    /// @brief 指针类型集合
+    ///
+    StorageSet<PointerType, PointerType::PointerTypeHasher, PointerType::PointerTypeEqual> pointerTypes;
+
+    ///
+    /// @brief 函数类型集合
+    ///
+    StorageSet<FunctionType, FunctionType::FunctionTypeHasher, FunctionType::FunctionTypeEqual> functionTypes;
+
+    ///
+    /// @brief 唯一的void类型
+    ///
+    VoidType voidType;
+
+    ///
+    /// @brief 唯一的label类型
+    ///
+    LabelType labelType;
+
+    ///
+    /// @brief 缓存的bool类型
+    ///
+    IntegerType * int1Type = nullptr;
+
+    ///
+    /// @brief 缓存的int类型
+    ///
+    IntegerType * int32Type = nullptr;
+};
@@ -16,17 +16,13 @@
 ///
 
 #include "VoidType.h"
+#include "TypeContext.h"
 
 ///
-/// @brief 唯一的VOID类型实例
-///
-VoidType * VoidType::oneInstance = new VoidType();
-
-///
-/// @brief 获取类型
+/// @brief 获取类型，即共享类型上下文中唯一的void类型
 /// @return VoidType*
 ///
 VoidType * VoidType::getType()
 {
-    return oneInstance;
-}
\ No newline at end of file
+    return TypeContext::getContext().getVoidType();
+}
@@ -20,9 +20,11 @@
 
 class VoidType : public Type {
 
+    friend class TypeContext;
+
 public:
     ///
-    /// @brief 获取类型，全局只有一份
+    /// @brief 获取类型，即共享类型上下文中唯一的void类型
     /// @return VoidType*
     ///
     static VoidType * getType();
@@ -42,9 +44,4 @@ private:
     ///
     explicit VoidType() : Type(Type::VoidTyID)
     {}
-
-    ///
-    /// @brief 唯一的VOID类型实例
-    ///
-    static VoidType * oneInstance;
 };
@@ -16,7 +16,9 @@
 ///
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <vector>
 
 class User;
@@ -32,8 +34,13 @@ class Value;
 /// User持有一个Use链表(成员uses)，每个Use指向一个Value
 /// Value持有一个User链表(成员uses)，每个User指向一个使用该Value的User对象
 ///
+/// Value的use链表是侵入式的双向链表，链接指针就在Use中，增删一条边都是O(1)
+///
 class Use {
 
+    /// Value通过Use中的指针维护use链表
+    friend class Value;
+
 protected:
     ///
     /// @brief 指向要使用的value
@@ -45,6 +52,16 @@ protected:
     ///
     User * user = nullptr;
 
+    ///
+    /// @brief usee的use链表中的前一条边
+    ///
+    Use * prevUse = nullptr;
+
+    ///
+    /// @brief usee的use链表中的后一条边
+    ///
+    Use * nextUse = nullptr;
+
 public:
     /**
      * 构建函数，构建一条define-use的边
@@ -94,4 +111,99 @@ public:
     /// @brief def-use边取消，但不会删除该Use
     ///
     void remove();
+
+    ///
+    /// @brief 获取usee的use链表中的下一条边
+    /// @return Use* 下一条边，没有时为nullptr
+    ///
+    [[nodiscard]] Use * getNextUse() const
+    {
+        return nextUse;
+    }
+};
+
+///
+/// @brief Value的use链表的前向迭代器，解引用得到Use。
+/// 遍历时不能修改当前Use的usee，需要修改时先取得下一条边
+///
+class UseIterator {
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Use *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Use **;
+    using reference = Use *;
+
+    explicit UseIterator(Use * _use) : use(_use)
+    {}
+
+    Use * operator*() const
+    {
+        return use;
+    }
+
+    UseIterator & operator++()
+    {
+        use = use->getNextUse();
+        return *this;
+    }
+
+    UseIterator operator++(int)
+    {
+        UseIterator old = *this;
+        use = use->getNextUse();
+        return old;
+    }
+
+    bool operator==(const UseIterator & other) const
+    {
+        return use == other.use;
+    }
+
+    bool operator!=(const UseIterator & other) const
+    {
+        return use != other.use;
+    }
+
+private:
+    ///
+    /// @brief 当前的边，nullptr表示结束
+    ///
+    Use * use;
+};
+
+///
+/// @brief Value的use链表，用于遍历使用该Value的所有边
+///
+class UseRange {
+
+public:
+    explicit UseRange(Use * _first) : first(_first)
+    {}
+
+    UseIterator begin() const
+    {
+        return UseIterator(first);
+    }
+
+    UseIterator end() const
+    {
+        return UseIterator(nullptr);
+    }
+
+    ///
+    /// @brief 是否没有边
+    /// @return true 没有被使用
+    ///
+    [[nodiscard]] bool empty() const
+    {
+        return first == nullptr;
+    }
+
+private:
+    ///
+    /// @brief 第一条边
+    ///
+    Use * first;
 };
\ No newline at end of file
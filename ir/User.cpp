@@ -18,6 +18,7 @@
 #include <algorithm>
 
 #include "User.h"
+#include "Arena.h"
 
 ///
 /// @brief 构造函数
@@ -46,7 +47,8 @@ void User::setOperand(int32_t pos, Value * val)
 void User::addOperand(Value * val)
 {
     // If not, add the given Value as a new use.
-    auto use = new Use(val, this);
+    Arena * arena = getUseArena();
+    auto use = arena ? arena->create<Use>(val, this) : new Use(val, this);
 
     // 增加到操作数中
     operands.push_back(use);
@@ -65,7 +67,7 @@ void User::removeOperand(Value * val)
         if (use->getUsee() == val) {
             // 找到了就删除这个Use
             use->remove();
-            delete use;
+            freeUse(use);
             break;
         }
     }
@@ -80,11 +82,11 @@ void User::removeOperand(int pos)
     // 检索并清除边，使得边的两头都会自动减少
     if (pos < (int32_t) operands.size()) {
 
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
+        // 按位置直接删除，不需要在操作数中查找
         Use * use = operands[pos];
-        use->remove();
-        delete use;
+        use->getUsee()->removeUse(use);
+        operands.erase(operands.begin() + pos);
+        freeUse(use);
     }
 }
 
@@ -117,15 +119,13 @@ void User::removeUse(Use * use)
 ///
 void User::clearOperands()
 {
-    for (int32_t pos = 0; pos < (int32_t) operands.size();) {
-
-        // 必须先暂存后释放，不能直接delete uses[pos]
-        // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-
-        Use * use = operands[pos];
-        use->remove();
-        delete use;
+    // 每条边从被使用者的use链表中摘除是O(1)的，操作数列表最后一次性清空
+    for (auto use: operands) {
+        use->getUsee()->removeUse(use);
+        freeUse(use);
     }
+
+    operands.clear();
 }
 ///
 /// @brief Get the Operands object
@@ -171,3 +171,23 @@ Value * User::getOperand(int32_t pos)
 
     return nullptr;
 }
+
+///
+/// @brief 获取创建Use所用的内存池
+/// @return Arena* 内存池，为空时Use单独new与delete
+///
+Arena * User::getUseArena()
+{
+    return nullptr;
+}
+
+///
+/// @brief 释放不再使用的Use，内存池中的Use随内存池统一释放
+/// @param use 已经解除了两头关联的Use
+///
+void User::freeUse(Use * use)
+{
+    if (!getUseArena()) {
+        delete use;
+    }
+}
@@ -22,6 +22,8 @@
 #include "Value.h"
 #include "Use.h"
 
+class Arena;
+
 ///
 /// @brief 本身代表一个Value，这个Value可通过其中的操作数计算得到
 ///
@@ -111,4 +113,17 @@ public:
     /// @brief 清除所有的操作数
     ///
     void clearOperands();
+
+protected:
+    ///
+    /// @brief 获取创建Use所用的内存池
+    /// @return Arena* 内存池，为空时Use单独new与delete
+    ///
+    virtual Arena * getUseArena();
+
+    ///
+    /// @brief 释放不再使用的Use，内存池中的Use随内存池统一释放
+    /// @param use 已经解除了两头关联的Use
+    ///
+    void freeUse(Use * use);
 };
\ No newline at end of file
@@ -15,10 +15,10 @@
 /// </table>
 ///
 
-#include <algorithm>
-
 #include "Value.h"
 #include "Use.h"
+#include "IRConstant.h"
+#include "StringPool.h"
 
 /// @brief 构造函数
 /// @param _type
@@ -34,35 +34,57 @@ Value::~Value()
 }
 
 /// @brief 获取名字
-/// @return 变量名
-std::string Value::getName() const
+/// @return 变量名，没有名字时为空串
+const std::string & Value::getName() const
 {
-    return name;
+    return name ? *name : StringPool::empty();
 }
 
 ///
-/// @brief 设置名字
+/// @brief 设置名字，名字驻留在字符串池中
 /// @param _name 名字
 ///
-void Value::setName(std::string _name)
+void Value::setName(const std::string & _name)
 {
-    this->name = _name;
+    this->name = StringPool::intern(_name);
 }
 
-/// @brief 获取名字
-/// @return 变量名
+/// @brief 获取IR名字，按需由前缀与IR编号拼接
+/// @return IR名字，没有编号时为空串
 std::string Value::getIRName() const
 {
-    return IRName;
+    if (irNo < 0) {
+        return "";
+    }
+
+    return getIRNamePrefix() + std::to_string(irNo);
 }
 
 ///
-/// @brief 设置名字
-/// @param _name 名字
+/// @brief 设置IR编号
+/// @param no 编号，-1表示清除编号
 ///
-void Value::setIRName(std::string _name)
+void Value::setIRNo(int32_t no)
 {
-    this->IRName = _name;
+    this->irNo = no;
+}
+
+///
+/// @brief 获取IR编号
+/// @return int32_t 编号，-1表示没有编号
+///
+int32_t Value::getIRNo() const
+{
+    return irNo;
+}
+
+///
+/// @brief 获取IR名字的前缀，临时变量为%t，局部变量、标签等由子类重写
+/// @return const char* 前缀
+///
+const char * Value::getIRNamePrefix() const
+{
+    return IR_TEMP_VARNAME_PREFIX;
 }
 
 /// @brief 获取类型
@@ -78,7 +100,16 @@ Type * Value::getType()
 ///
 void Value::addUse(Use * use)
 {
-    uses.push_back(use);
+    use->prevUse = lastUse;
+    use->nextUse = nullptr;
+
+    if (lastUse) {
+        lastUse->nextUse = use;
+    } else {
+        firstUse = use;
+    }
+
+    lastUse = use;
 }
 
 ///
@@ -87,9 +118,44 @@ void Value::addUse(Use * use)
 ///
 void Value::removeUse(Use * use)
 {
-    auto pIter = std::find(uses.begin(), uses.end(), use);
-    if (pIter != uses.end()) {
-        uses.erase(pIter);
+    if (use->prevUse) {
+        use->prevUse->nextUse = use->nextUse;
+    } else {
+        firstUse = use->nextUse;
+    }
+
+    if (use->nextUse) {
+        use->nextUse->prevUse = use->prevUse;
+    } else {
+        lastUse = use->prevUse;
+    }
+
+    use->prevUse = nullptr;
+    use->nextUse = nullptr;
+}
+
+///
+/// @brief 获取使用该Value的所有边
+/// @return UseRange 边的链表
+///
+UseRange Value::getUses()
+{
+    return UseRange(firstUse);
+}
+
+///
+/// @brief 把所有使用该Value的地方替换为newVal，所有的边转移到newVal上
+/// @param newVal 新的值
+///
+void Value::replaceAllUsesWith(Value * newVal)
+{
+    if (newVal == this) {
+        return;
+    }
+
+    // 每条边从链表头部摘下后追加到newVal的链表尾部，总计O(边数)
+    while (firstUse) {
+        firstUse->setUsee(newVal);
     }
 }
 
@@ -111,6 +177,15 @@ int32_t Value::getRegId()
     return -1;
 }
 
+///
+/// @brief 设置分配的寄存器编号，只有可分配寄存器的Value才有效
+/// @param regId 寄存器编号，-1表示不分配寄存器
+///
+void Value::setRegId(int32_t regId)
+{
+    (void) regId;
+}
+
 ///
 /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
 /// @param regId 寄存器编号
@@ -24,7 +24,7 @@
 
 ///
 /// @brief 值类，每个值都要有一个类型，全局变量和局部变量可以有名字，
-/// 但通过运算得到的指令类值没有名字，只有在需要输出时给定名字即可
+/// 但通过运算得到的指令类值没有名字，只有在需要输出时给定编号，输出时由编号得到IR名字
 ///
 /// Value表示所有可计算的值的基类，例如常量、指令、参数等。
 /// 每个Value都有一个类型(Type)和一个名字(Name)。Value是IR中所有可计算实体的抽象。
@@ -32,21 +32,26 @@
 class Value {
 
 protected:
-    /// @brief 变量名，函数名等原始的名字，可能为空串
-    std::string name;
+    /// @brief 变量名，函数名等原始的名字，驻留在字符串池中，没有名字时为nullptr
+    const std::string * name = nullptr;
 
     ///
-    /// @brief IR名字，用于文本IR的输出
+    /// @brief IR编号，输出文本IR时由前缀与编号拼接得到IR名字，-1表示没有编号
     ///
-    std::string IRName;
+    int32_t irNo = -1;
 
     /// @brief 类型
     Type * type;
 
     ///
-    /// @brief define-use链，这个定值被使用的所有边，即所有的User
+    /// @brief define-use链的第一条边，链表通过Use中的指针连接，即所有的User
     ///
-    std::vector<Use *> uses;
+    Use * firstUse = nullptr;
+
+    ///
+    /// @brief define-use链的最后一条边，新边追加到尾部，保持加入的次序
+    ///
+    Use * lastUse = nullptr;
 
 public:
     /// @brief 构造函数
@@ -57,24 +62,36 @@ public:
     virtual ~Value();
 
     /// @brief 获取名字
-    /// @return 变量名
-    [[nodiscard]] virtual std::string getName() const;
+    /// @return 变量名，没有名字时为空串
+    [[nodiscard]] virtual const std::string & getName() const;
 
     ///
-    /// @brief 设置名字
+    /// @brief 设置名字，名字驻留在字符串池中
     /// @param _name 名字
     ///
-    void setName(std::string _name);
+    void setName(const std::string & _name);
 
-    /// @brief 获取名字
-    /// @return 变量名
+    /// @brief 获取IR名字，按需由前缀与IR编号拼接
+    /// @return IR名字，没有编号时为空串
     [[nodiscard]] virtual std::string getIRName() const;
 
     ///
-    /// @brief 设置名字
-    /// @param _name 名字
+    /// @brief 设置IR编号
+    /// @param no 编号，-1表示清除编号
+    ///
+    void setIRNo(int32_t no);
+
+    ///
+    /// @brief 获取IR编号
+    /// @return int32_t 编号，-1表示没有编号
+    ///
+    int32_t getIRNo() const;
+
+    ///
+    /// @brief 获取IR名字的前缀，临时变量为%t，局部变量、标签等由子类重写
+    /// @return const char* 前缀
     ///
-    void setIRName(std::string _name);
+    [[nodiscard]] virtual const char * getIRNamePrefix() const;
 
     /// @brief 获取类型
     /// @return 变量名
@@ -92,6 +109,18 @@ public:
     ///
     void removeUse(Use * use);
 
+    ///
+    /// @brief 获取使用该Value的所有边
+    /// @return UseRange 边的链表
+    ///
+    UseRange getUses();
+
+    ///
+    /// @brief 把所有使用该Value的地方替换为newVal，所有的边转移到newVal上
+    /// @param newVal 新的值
+    ///
+    void replaceAllUsesWith(Value * newVal);
+
     ///
     /// @brief 取得变量所在的作用域层级
     /// @return int32_t 层级
@@ -104,6 +133,12 @@ public:
     ///
     virtual int32_t getRegId();
 
+    ///
+    /// @brief 设置分配的寄存器编号，只有可分配寄存器的Value才有效
+    /// @param regId 寄存器编号，-1表示不分配寄存器
+    ///
+    virtual void setRegId(int32_t regId);
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
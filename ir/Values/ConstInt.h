@@ -32,15 +32,14 @@ public:
     /// \param val
     explicit ConstInt(int32_t val) : Constant(IntegerType::getTypeInt())
     {
-        name = std::to_string(val);
         intVal = val;
     }
 
-    /// @brief 获取名字
+    /// @brief 获取名字，常量的IR名字就是其值
     /// @return 变量名
     [[nodiscard]] std::string getIRName() const override
     {
-        return name;
+        return std::to_string(intVal);
     }
 
     ///
@@ -28,7 +28,7 @@ public:
     /// @param _type 基本类型
     FormalParam(Type * _type, std::string _name) : Value(_type)
     {
-        this->name = _name;
+        setName(_name);
     };
 
     // /// @brief 输出字符串
@@ -103,7 +103,7 @@ public:
     /// @brief 设置寄存器编号
     /// @param _regId 寄存器编号
     ///
-    void setRegId(int32_t _regId)
+    void setRegId(int32_t _regId) override
     {
         this->regId = _regId;
     }
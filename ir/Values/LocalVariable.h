@@ -36,7 +36,7 @@ private:
     explicit LocalVariable(Type * _type, std::string _name, int32_t _scope_level)
         : Value(_type), scope_level(_scope_level)
     {
-        this->name = _name;
+        setName(_name);
     }
 
 public:
@@ -49,6 +49,15 @@ public:
         return scope_level;
     }
 
+    ///
+    /// @brief 获取IR名字的前缀
+    /// @return const char* 前缀
+    ///
+    [[nodiscard]] const char * getIRNamePrefix() const override
+    {
+        return IR_LOCAL_VARNAME_PREFIX;
+    }
+
     ///
     /// @brief 获得分配的寄存器编号或ID
     /// @return int32_t 寄存器编号
@@ -58,6 +67,15 @@ public:
         return regId;
     }
 
+    ///
+    /// @brief 设置寄存器编号
+    /// @param _regId 寄存器编号
+    ///
+    void setRegId(int32_t _regId) override
+    {
+        this->regId = _regId;
+    }
+
     ///
     /// @brief @brief 如是内存变量型Value，则获取基址寄存器和偏移
     /// @param regId 寄存器编号
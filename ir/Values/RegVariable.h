@@ -26,7 +26,7 @@ public:
     /// \param val
     explicit RegVariable(Type * _type, std::string _name, int32_t _reg_no) : Value(_type)
     {
-        this->name = _name;
+        setName(_name);
         regId = _reg_no;
     }
 
@@ -43,7 +43,7 @@ public:
     /// @return 变量名
     [[nodiscard]] std::string getIRName() const override
     {
-        return name;
+        return getName();
     }
 
 private:
@@ -9,6 +9,7 @@
  *
  */
 
+#include <cctype>
 #include <iostream>
 #include <string>
 #include <getopt.h>
@@ -28,6 +29,7 @@
 #include "IRGenerator.h"
 #include "RecursiveDescentExecutor.h"
 #include "Module.h"
+#include "PassManager.h"
 
 ///
 /// @brief 是否显示帮助信息
@@ -77,6 +79,37 @@ static bool gAsmAlsoShowIR = false;
 /// @brief 优化的级别，即-O后面的数字，默认为0
 static int gOptLevel = 0;
 
+/// @brief 是否以代码大小优先，即-Os
+static bool gOptForSize = false;
+
+/// @brief 指定执行的优化遍序列，逗号分隔，指定时代替-O对应的标准序列
+static std::string gPasses;
+
+/// @brief 是否输出每个优化遍的执行时间
+static bool gTimePasses = false;
+
+/// @brief 在哪些优化遍执行后输出IR，逗号分隔，all表示所有的遍
+static std::string gPrintAfter;
+
+/// @brief 是否输出优化遍的统计信息，如改写规则的命中次数
+static bool gStats = false;
+
+/// @brief 循环部分展开的因子，0表示按循环大小自动选择
+static int gUnrollCount = 0;
+
+/// @brief 是否对界限不是常量的循环做部分展开
+static bool gUnrollRuntime = false;
+
+/// @brief 只有长选项的选项标识，取值避开短选项的字符
+enum LongOnlyOption {
+    OPT_PASSES = 256,
+    OPT_TIME_PASSES,
+    OPT_PRINT_AFTER,
+    OPT_STATS,
+    OPT_UNROLL_COUNT,
+    OPT_UNROLL_RUNTIME,
+};
+
 /// @brief 指定CPU目标架构，这里默认为ARM32
 static std::string gCPUTarget = "ARM32";
 
@@ -97,6 +130,12 @@ static struct option long_options[] = {
     {"optimize", required_argument, 0, 'O'},
     {"target", required_argument, 0, 't'},
     {"asmir", no_argument, 0, 'c'},
+    {"passes", required_argument, 0, OPT_PASSES},
+    {"time-passes", no_argument, 0, OPT_TIME_PASSES},
+    {"print-after", required_argument, 0, OPT_PRINT_AFTER},
+    {"stats", no_argument, 0, OPT_STATS},
+    {"unroll-count", required_argument, 0, OPT_UNROLL_COUNT},
+    {"unroll-runtime", no_argument, 0, OPT_UNROLL_RUNTIME},
     {0, 0, 0, 0}
 };
 
@@ -113,7 +152,14 @@ static void showHelp(const std::string & exeName)
     std::cout << "  -I, --ir                   Output intermediate representation\n";
     std::cout << "  -A, --antlr4               Use Antlr4 for lexical and syntax analysis\n";
     std::cout << "  -D, --recursive-descent    Use recursive descent parsing\n";
-    std::cout << "  -O, --optimize=LEVEL       Set optimization level\n";
+    std::cout << "  -O, --optimize=LEVEL       Set optimization level: 0, 1, 2 or s\n";
+    std::cout << "      --passes=P1,P2,...     Run the given passes instead of the -O pipeline\n";
+    std::cout << "                             (" + PassManager::getPassNames() + ")\n";
+    std::cout << "      --time-passes          Report the execution time of each pass\n";
+    std::cout << "      --print-after=P1,...   Print IR after the given passes, or all\n";
+    std::cout << "      --stats                Report pass statistics such as rule hit counts\n";
+    std::cout << "      --unroll-count=N       Partially unroll loops by N, 0 chooses by loop size\n";
+    std::cout << "      --unroll-runtime       Also partially unroll loops whose bound is not a constant\n";
     std::cout << "  -t, --target=CPU           Specify target CPU architecture\n";
     std::cout << "  -c, --asmir                Show IR instructions as comments in assembly output\n";
 }
@@ -172,8 +218,37 @@ lb_check:
                 gFrontEndRecursiveDescentParsing = true;
                 break;
             case 'O':
-                // 优化级别分析，暂时没有用，如开启优化时请使用
-                gOptLevel = std::stoi(optarg);
+                // 优化级别分析，-Os按-O2的序列但不做增大代码的优化
+                if (std::string(optarg) == "s") {
+                    gOptLevel = 2;
+                    gOptForSize = true;
+                } else if (isdigit((unsigned char) optarg[0])) {
+                    gOptLevel = std::stoi(optarg);
+                    gOptForSize = false;
+                } else {
+                    return -1;
+                }
+                break;
+            case OPT_PASSES:
+                gPasses = optarg;
+                break;
+            case OPT_TIME_PASSES:
+                gTimePasses = true;
+                break;
+            case OPT_PRINT_AFTER:
+                gPrintAfter = optarg;
+                break;
+            case OPT_STATS:
+                gStats = true;
+                break;
+            case OPT_UNROLL_COUNT:
+                if (!isdigit((unsigned char) optarg[0])) {
+                    return -1;
+                }
+                gUnrollCount = std::stoi(optarg);
+                break;
+            case OPT_UNROLL_RUNTIME:
+                gUnrollRuntime = true;
                 break;
             case 't':
                 gCPUTarget = optarg;
@@ -266,7 +341,7 @@ static int compile(std::string inputFile, std::string outputFile)
         // 编译过程主要包括：
         // 1）词法语法分析生成AST
         // 2) 遍历AST生成线性IR
-        // 3) 对线性IR进行优化：目前不支持
+        // 3) 对线性IR进行优化：按-O的级别或--passes指定的遍执行
         // 4) 把线性IR转换成汇编
 
         // 创建词法语法分析器
@@ -333,6 +408,23 @@ static int compile(std::string inputFile, std::string outputFile)
         // 清理抽象语法树
         free_ast(astRoot);
 
+        // 中间代码优化，体系结果无关的优化等，新增的优化遍在PassManager中登记
+        PassManager passManager(module);
+        passManager.setUnrollCount(gUnrollCount);
+        passManager.setForSize(gOptForSize);
+        passManager.setUnrollRuntime(gUnrollRuntime);
+        if (!gPasses.empty()) {
+            if (!passManager.addPipeline(gPasses)) {
+                break;
+            }
+        } else {
+            passManager.addPipeline(gOptLevel, gOptForSize);
+        }
+        passManager.setTimePasses(gTimePasses);
+        passManager.setPrintAfter(gPrintAfter);
+        passManager.setStats(gStats);
+        passManager.run();
+
         if (gShowLineIR) {
 
             // 对IR的名字重命名
@@ -353,8 +445,6 @@ static int compile(std::string inputFile, std::string outputFile)
             module->renameIR();
         }
 
-        // 这里可追加中间代码优化，体系结果无关的优化等
-
         // 后端处理，体系结果相关的操作
         // 这里提供一种面向ARM32的汇编产生器CodeGeneratorArm32作为参考
         // 需要时可根据需要修改或追加新的目标体系架构
@@ -0,0 +1,210 @@
+///
+/// @file CopyPropagation.cpp
+/// @brief 复写传播，减少Move指令
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "CopyPropagation.h"
+#include "DataFlow.h"
+#include "DominatorTree.h"
+#include "GlobalVariable.h"
+
+///
+/// @brief 构造函数
+///
+CopyPropagation::CopyPropagation() : FunctionPass("copyprop")
+{}
+
+///
+/// @brief 对函数执行复写传播
+/// @param _func 要处理的函数
+/// @param module 模块
+/// @return true 函数被修改
+///
+bool CopyPropagation::runOnFunction(Function * _func, Module * module)
+{
+    (void) module;
+
+    func = _func;
+
+    if (func->getBasicBlocks().empty()) {
+        return false;
+    }
+
+    // 传播后复写的源操作数可能改变，失效的条件随之改变，因此每轮重新收集复写
+    bool changed = false;
+    while (propagate()) {
+        changed = true;
+    }
+
+    return changed;
+}
+
+///
+/// @brief 收集函数内的复写并编号
+///
+void CopyPropagation::collectCopies()
+{
+    copies.clear();
+    copyNos.clear();
+    copiesByDst.clear();
+    copiesByVar.clear();
+    globalCopies.clear();
+
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (inst->getOp() != IRInstOperator::IRINST_OP_ASSIGN) {
+            continue;
+        }
+
+        Value * dst = inst->getOperand(0);
+        Value * src = inst->getOperand(1);
+
+        if (!dynamic_cast<LocalVariable *>(dst) || dst == src) {
+            continue;
+        }
+
+        bool srcIsGlobal = dynamic_cast<GlobalVariable *>(src) != nullptr;
+        if (!srcIsGlobal && !dynamic_cast<LocalVariable *>(src) && !dynamic_cast<ConstInt *>(src) &&
+            !dynamic_cast<Instruction *>(src)) {
+            continue;
+        }
+
+        int32_t no = (int32_t) copies.size();
+        copies.push_back(inst);
+        copyNos[inst] = no;
+        copiesByDst[dst].push_back(no);
+        copiesByVar[dst].push_back(no);
+
+        // 常量与指令的结果不会被赋值
+        if (srcIsGlobal || dynamic_cast<LocalVariable *>(src)) {
+            copiesByVar[src].push_back(no);
+        }
+        if (srcIsGlobal) {
+            globalCopies.push_back(no);
+        }
+    }
+}
+
+///
+/// @brief 按指令更新可用的复写
+/// @param inst 指令
+/// @param avail 可用的复写
+/// @param killed 不为空时记录失效的复写
+///
+void CopyPropagation::transfer(Instruction * inst, BitVector & avail, BitVector * killed)
+{
+    auto kill = [&](const std::vector<int32_t> & nos) {
+        for (auto no: nos) {
+            avail.reset(no);
+            if (killed) {
+                killed->set(no);
+            }
+        }
+    };
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+
+        auto iter = copiesByVar.find(inst->getOperand(0));
+        if (iter != copiesByVar.end()) {
+            kill(iter->second);
+        }
+
+        auto copyIter = copyNos.find(inst);
+        if (copyIter != copyNos.end()) {
+            avail.set(copyIter->second);
+        }
+    } else if (inst->getOp() == IRInstOperator::IRINST_OP_FUNC_CALL) {
+        // 被调用的函数可能修改全局变量
+        kill(globalCopies);
+    }
+}
+
+///
+/// @brief 进行一轮复写传播
+/// @return true 函数被修改
+///
+bool CopyPropagation::propagate()
+{
+    collectCopies();
+
+    if (copies.empty()) {
+        return false;
+    }
+
+    int32_t copyNum = (int32_t) copies.size();
+    DataFlowAnalysis dataflow(func, DataFlowDirection::FORWARD, DataFlowMeet::INTERSECT, copyNum);
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        BitVector & gen = dataflow.getGen(bb);
+        BitVector & kill = dataflow.getKill(bb);
+
+        for (auto inst: bb->getInsts()) {
+            transfer(inst, gen, &kill);
+        }
+    }
+
+    dataflow.solve();
+
+    DominatorTree * domTree = func->getDominatorTree();
+    std::vector<Instruction *> selfMoves;
+    bool changed = false;
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        // 不可达的基本块保持全集的初值，不能据此改写
+        if (!domTree->isReachable(bb)) {
+            continue;
+        }
+
+        BitVector avail = dataflow.getIn(bb);
+
+        for (auto inst: bb->getInsts()) {
+
+            // Phi指令的来源在前驱的出口处使用，这里不处理
+            if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+
+                int32_t first = inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN ? 1 : 0;
+                for (int32_t k = first; k < inst->getOperandsNum(); ++k) {
+
+                    auto iter = copiesByDst.find(inst->getOperand(k));
+                    if (iter == copiesByDst.end()) {
+                        continue;
+                    }
+
+                    // 对变量的赋值使以其为目的的复写全部失效，同一时刻最多有一个可用
+                    for (auto no: iter->second) {
+                        if (avail.test(no)) {
+                            inst->setOperand(k, copies[no]->getOperand(1));
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN && inst->getOperand(0) == inst->getOperand(1)) {
+                    selfMoves.push_back(inst);
+                }
+            }
+
+            transfer(inst, avail, nullptr);
+        }
+    }
+
+    for (auto inst: selfMoves) {
+        inst->getParent()->erase(inst);
+        inst->clearOperands();
+    }
+
+    return changed || !selfMoves.empty();
+}
@@ -0,0 +1,107 @@
+///
+/// @file CopyPropagation.h
+/// @brief 复写传播，减少Move指令
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "BitVector.h"
+#include "Pass.h"
+
+///
+/// @brief 全局复写传播。复写指目的操作数为局部变量、源操作数为局部变量、全局变量、常量或指令结果的Move指令。
+/// 按可用复写的前向数据流分析（交集）求出每个基本块入口处可用的复写：
+/// 对变量x的赋值使所有涉及x的复写失效，函数调用使源操作数为全局变量的复写失效。
+/// 可用复写x=y处对x的使用改为使用y，x=y; z=x的链经多轮传播后z直接取y，
+/// 自身赋值的Move指令删除，不再活跃的赋值由死代码删除负责删除
+///
+class CopyPropagation final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    CopyPropagation();
+
+    ///
+    /// @brief 对函数执行复写传播
+    /// @param _func 要处理的函数
+    /// @param module 模块
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * module) override;
+
+    ///
+    /// @brief 只修改操作数和删除Move指令，不改变控制流图
+    /// @return true
+    ///
+    [[nodiscard]] bool preservesCFG() const override
+    {
+        return true;
+    }
+
+protected:
+    ///
+    /// @brief 收集函数内的复写并编号
+    ///
+    void collectCopies();
+
+    ///
+    /// @brief 进行一轮复写传播
+    /// @return true 函数被修改
+    ///
+    bool propagate();
+
+    ///
+    /// @brief 按指令更新可用的复写
+    /// @param inst 指令
+    /// @param avail 可用的复写
+    /// @param killed 不为空时记录失效的复写
+    ///
+    void transfer(Instruction * inst, BitVector & avail, BitVector * killed);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 按编号排列的复写
+    ///
+    std::vector<Instruction *> copies;
+
+    ///
+    /// @brief 复写到编号的映射
+    ///
+    std::unordered_map<Instruction *, int32_t> copyNos;
+
+    ///
+    /// @brief 以变量为目的操作数的复写
+    ///
+    std::unordered_map<Value *, std::vector<int32_t>> copiesByDst;
+
+    ///
+    /// @brief 涉及变量的复写，即以变量为目的或源操作数的复写，变量被赋值时失效
+    ///
+    std::unordered_map<Value *, std::vector<int32_t>> copiesByVar;
+
+    ///
+    /// @brief 源操作数为全局变量的复写，函数调用时失效
+    ///
+    std::vector<int32_t> globalCopies;
+};
@@ -0,0 +1,275 @@
+///
+/// @file DCE.cpp
+/// @brief 死代码删除，包括不可达基本块的删除
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <vector>
+
+#include "DCE.h"
+#include "DominatorTree.h"
+#include "Liveness.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+///
+DCE::DCE() : FunctionPass("dce")
+{}
+
+///
+/// @brief 对函数删除死代码
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool DCE::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    if (func->getBasicBlocks().empty()) {
+        return false;
+    }
+
+    bool changed = removeUnreachableBlocks();
+
+    while (removeDeadInsts()) {
+        changed = true;
+    }
+
+    changed = removeUnusedVars() || changed;
+
+    return changed;
+}
+
+///
+/// @brief 删除从入口不可达的基本块，出口基本块保留
+/// @return true 删除了基本块
+///
+bool DCE::removeUnreachableBlocks()
+{
+    DominatorTree * domTree = func->getDominatorTree();
+
+    // 出口基本块即使不可达也要保留，后端生成函数的epilogue需要
+    BasicBlock * exitBlock = func->getExitLabel()->getParent();
+
+    std::vector<BasicBlock *> deadBlocks;
+    for (auto bb: func->getBasicBlocks()) {
+        if (!domTree->isReachable(bb) && bb != exitBlock) {
+            deadBlocks.push_back(bb);
+        }
+    }
+
+    if (deadBlocks.empty()) {
+        return false;
+    }
+
+    // 保留的基本块中的Phi指令删除来自不可达前驱的来源，只剩一个来源时直接使用该来源
+    for (auto bb: func->getBasicBlocks()) {
+
+        if (!domTree->isReachable(bb) && bb != exitBlock) {
+            continue;
+        }
+
+        std::vector<PhiInstruction *> trivialPhis;
+        for (auto inst: bb->getInsts()) {
+
+            if (inst == bb->getLabel()) {
+                continue;
+            }
+            if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                break;
+            }
+
+            auto phi = static_cast<PhiInstruction *>(inst);
+            for (int32_t k = phi->getIncomingNum() - 1; k >= 0; --k) {
+                if (!domTree->isReachable(phi->getIncomingBlock(k))) {
+                    phi->removeIncoming(k);
+                }
+            }
+
+            if (phi->getIncomingNum() <= 1) {
+                trivialPhis.push_back(phi);
+            }
+        }
+
+        // 出口基本块不可达时Phi指令没有来源，其值不会被用到
+        for (auto phi: trivialPhis) {
+            phi->replaceAllUsesWith(phi->getIncomingNum() ? phi->getIncomingValue(0) : module->newConstInt(0));
+            bb->erase(phi);
+            phi->clearOperands();
+        }
+    }
+
+    // 不可达基本块中的值只可能被其它不可达的基本块或者不可达的出口基本块使用
+    for (auto bb: deadBlocks) {
+        for (auto inst: bb->getInsts()) {
+            if (inst->hasResultValue()) {
+                inst->replaceAllUsesWith(module->newConstInt(0));
+            }
+        }
+    }
+
+    func->removeBasicBlocks(deadBlocks);
+
+    return true;
+}
+
+///
+/// @brief 标记并删除一遍死指令
+/// @return true 删除了指令
+///
+bool DCE::removeDeadInsts()
+{
+    Liveness liveness(func, true);
+    liveness.run();
+
+    // 必须保留的指令，从这里出发标记用到的指令
+    std::vector<Instruction *> worklist;
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        std::vector<Instruction *> insts;
+        for (auto inst: bb->getInsts()) {
+            insts.push_back(inst);
+        }
+
+        // 逆序遍历基本块，live为当前指令之后活跃的值
+        BitVector live = liveness.getLiveOut(bb);
+
+        for (auto iter = insts.rbegin(); iter != insts.rend(); ++iter) {
+
+            Instruction * inst = *iter;
+            IRInstOperator op = inst->getOp();
+
+            bool dead = false;
+            switch (op) {
+                case IRInstOperator::IRINST_OP_ADD_I:
+                case IRInstOperator::IRINST_OP_SUB_I:
+                case IRInstOperator::IRINST_OP_MUL_I:
+                case IRInstOperator::IRINST_OP_DIV_I:
+                case IRInstOperator::IRINST_OP_MOD_I:
+                case IRInstOperator::IRINST_OP_NEG_I:
+                case IRInstOperator::IRINST_OP_EQ_I:
+                case IRInstOperator::IRINST_OP_NEQ_I:
+                case IRInstOperator::IRINST_OP_LT_I:
+                case IRInstOperator::IRINST_OP_LE_I:
+                case IRInstOperator::IRINST_OP_GT_I:
+                case IRInstOperator::IRINST_OP_GE_I:
+                case IRInstOperator::IRINST_OP_SHL_I:
+                case IRInstOperator::IRINST_OP_ASHR_I:
+                case IRInstOperator::IRINST_OP_LSHR_I:
+                case IRInstOperator::IRINST_OP_MIN_I:
+                case IRInstOperator::IRINST_OP_MAX_I:
+                case IRInstOperator::IRINST_OP_ABS_I:
+                case IRInstOperator::IRINST_OP_MULH_I:
+                case IRInstOperator::IRINST_OP_PHI:
+                case IRInstOperator::IRINST_OP_LOAD:
+                    // 没有副作用，只有被用到时才保留
+                    dead = true;
+                    break;
+                case IRInstOperator::IRINST_OP_ASSIGN: {
+                    // 对局部变量的赋值之后变量不再活跃，即死存储；全局变量不跟踪，总是保留
+                    int32_t no = liveness.getValueNo(inst->getOperand(0));
+                    dead = no != -1 && !live.test(no);
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            inst->setDead(dead);
+            if (!dead) {
+                worklist.push_back(inst);
+            }
+
+            // 计算本指令之前活跃的值：去掉定值，加入使用。
+            // Phi指令的来源在前驱的出口处使用，已在前驱的出口活跃集合中
+            int32_t defNo = -1;
+            if (inst->hasResultValue()) {
+                defNo = liveness.getValueNo(inst);
+            } else if (op == IRInstOperator::IRINST_OP_ASSIGN) {
+                defNo = liveness.getValueNo(inst->getOperand(0));
+            }
+            if (defNo != -1) {
+                live.reset(defNo);
+            }
+
+            if (op == IRInstOperator::IRINST_OP_PHI) {
+                continue;
+            }
+
+            for (int32_t k = (op == IRInstOperator::IRINST_OP_ASSIGN) ? 1 : 0; k < inst->getOperandsNum(); ++k) {
+                int32_t no = liveness.getValueNo(inst->getOperand(k));
+                if (no != -1) {
+                    live.set(no);
+                }
+            }
+        }
+    }
+
+    // 必须保留的指令用到的指令也要保留
+    while (!worklist.empty()) {
+
+        Instruction * inst = worklist.back();
+        worklist.pop_back();
+
+        for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+            auto operand = dynamic_cast<Instruction *>(inst->getOperand(k));
+            if (operand && operand->isDead()) {
+                operand->setDead(false);
+                worklist.push_back(operand);
+            }
+        }
+    }
+
+    std::vector<Instruction *> deadInsts;
+    for (auto bb: func->getBasicBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            if (inst->isDead()) {
+                deadInsts.push_back(inst);
+            }
+        }
+    }
+
+    // 死指令只被其它死指令使用，先全部解除使用再移除；指令的内存随函数统一释放
+    for (auto inst: deadInsts) {
+        inst->clearOperands();
+    }
+
+    for (auto inst: deadInsts) {
+        inst->getParent()->erase(inst);
+    }
+
+    return !deadInsts.empty();
+}
+
+///
+/// @brief 删除不再使用的局部变量
+/// @return true 删除了变量
+///
+bool DCE::removeUnusedVars()
+{
+    std::vector<LocalVariable *> & varValues = func->getVarValues();
+    size_t oldSize = varValues.size();
+
+    varValues.erase(std::remove_if(varValues.begin(),
+                                   varValues.end(),
+                                   [this](LocalVariable * var) {
+                                       return var->getUses().empty() && var != func->getReturnValue();
+                                   }),
+                    varValues.end());
+
+    return varValues.size() != oldSize;
+}
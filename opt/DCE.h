@@ -0,0 +1,72 @@
+///
+/// @file DCE.h
+/// @brief 死代码删除，包括不可达基本块的删除
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include "Pass.h"
+
+///
+/// @brief 死代码删除。先删除从入口不可达的基本块（如return、break之后的语句），
+/// 再按标记-清除删除指令：运算与Phi指令以及赋值后不再活跃的局部变量的Move指令先标记为Dead，
+/// 从函数调用、跳转、出口、对全局变量或者仍活跃的局部变量的赋值等必须保留的指令出发，
+/// 沿操作数把用到的指令重新标记为非Dead，最后仍为Dead的指令从线性IR中删除。
+/// 删除赋值后其源操作数可能变为不再使用，因此反复进行直到没有变化，最后删除不再使用的局部变量
+///
+class DCE final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    DCE();
+
+    ///
+    /// @brief 对函数删除死代码
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+protected:
+    ///
+    /// @brief 删除从入口不可达的基本块，出口基本块保留
+    /// @return true 删除了基本块
+    ///
+    bool removeUnreachableBlocks();
+
+    ///
+    /// @brief 标记并删除一遍死指令
+    /// @return true 删除了指令
+    ///
+    bool removeDeadInsts();
+
+    ///
+    /// @brief 删除不再使用的局部变量
+    /// @return true 删除了变量
+    ///
+    bool removeUnusedVars();
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+};
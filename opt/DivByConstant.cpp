@@ -0,0 +1,258 @@
+///
+/// @file DivByConstant.cpp
+/// @brief 除以常量的除法与求余改为乘法取高位与移位
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <limits>
+#include <vector>
+
+#include "DivByConstant.h"
+#include "BinaryInstruction.h"
+
+///
+/// @brief 获取2的幂的指数
+/// @param val 无符号值
+/// @return int32_t 指数，不是2的幂时返回-1
+///
+static int32_t log2Exact(uint32_t val)
+{
+    if (val == 0 || (val & (val - 1)) != 0) {
+        return -1;
+    }
+
+    int32_t k = 0;
+    while ((1u << k) != val) {
+        k++;
+    }
+
+    return k;
+}
+
+///
+/// @brief 构造函数
+///
+DivByConstant::DivByConstant() : FunctionPass("divconst")
+{}
+
+///
+/// @brief 对函数改写除以常量的除法与求余
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool DivByConstant::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    std::vector<Instruction *> insts;
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_DIV_I || inst->getOp() == IRInstOperator::IRINST_OP_MOD_I) {
+            insts.push_back(inst);
+        }
+    }
+
+    bool changed = false;
+
+    for (auto inst: insts) {
+
+        // 被除数为常量时由常量折叠负责
+        auto divisorConst = dynamic_cast<ConstInt *>(inst->getOperand(1));
+        if (!divisorConst || dynamic_cast<ConstInt *>(inst->getOperand(0))) {
+            continue;
+        }
+
+        // 除以0保留到运行时；除以1的商就是被除数，被除数为变量时不能直接代替
+        int32_t divisor = divisorConst->getVal();
+        if (divisor == 0 || (divisor == 1 && inst->getOp() == IRInstOperator::IRINST_OP_DIV_I)) {
+            continue;
+        }
+
+        Value * result;
+        if (inst->getOp() == IRInstOperator::IRINST_OP_DIV_I) {
+            result = emitDiv(inst, inst->getOperand(0), divisor);
+        } else if (divisor == 1 || divisor == -1) {
+            result = module->newConstInt(0);
+        } else {
+            result = emitMod(inst, inst->getOperand(0), divisor);
+        }
+
+        inst->replaceAllUsesWith(result);
+        inst->getParent()->erase(inst);
+        inst->clearOperands();
+        changed = true;
+    }
+
+    return changed;
+}
+
+///
+/// @brief 计算有符号除法的魔数与移位位数，使x/d = mulh(x, magic) >> shift，
+/// 再按魔数与除数的符号加减x、商为负数时加1修正。
+/// 取最小的p≥32，使2^p除以|d|向上取整后的误差不超过2^p/nc，nc为不大于2^31的最大的|d|的余数为|d|-1的数，
+/// 魔数为(2^p+|d|-2^p%|d|)/|d|，移位位数为p-32
+/// @param divisor 除数，绝对值至少为2且不是INT32_MIN
+/// @param magic 魔数
+/// @param shift 移位位数
+///
+void DivByConstant::computeMagic(int32_t divisor, int32_t & magic, int32_t & shift)
+{
+    const uint32_t two31 = 0x80000000u;
+
+    uint32_t ad = divisor < 0 ? 0u - (uint32_t) divisor : (uint32_t) divisor;
+    uint32_t t = two31 + ((uint32_t) divisor >> 31);
+    uint32_t anc = t - 1 - t % ad;
+
+    // q1、r1为2^p除以anc的商与余数，q2、r2为2^p除以|d|的商与余数，p从31开始递增
+    int32_t p = 31;
+    uint32_t q1 = two31 / anc;
+    uint32_t r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / ad;
+    uint32_t r2 = two31 - q2 * ad;
+    uint32_t delta;
+
+    do {
+        p++;
+
+        q1 = 2 * q1;
+        r1 = 2 * r1;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+
+        q2 = 2 * q2;
+        r2 = 2 * r2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    magic = (int32_t) (q2 + 1);
+    if (divisor < 0) {
+        magic = (int32_t) (0u - (uint32_t) magic);
+    }
+
+    shift = p - 32;
+}
+
+///
+/// @brief 在pos之前插入求x/d的指令序列
+/// @param pos 插入位置
+/// @param val 被除数
+/// @param divisor 除数，不为0和1
+/// @return Value* 商
+///
+Value * DivByConstant::emitDiv(Instruction * pos, Value * val, int32_t divisor)
+{
+    // INT32_MIN/-1溢出，目标机器的结果与求负相同
+    if (divisor == -1) {
+        return insertBinary(pos, IRInstOperator::IRINST_OP_NEG_I, module->newConstInt(0), val);
+    }
+
+    // 只有被除数也为INT32_MIN时商为1，其余为0
+    if (divisor == std::numeric_limits<int32_t>::min()) {
+        return insertBinary(pos, IRInstOperator::IRINST_OP_EQ_I, val, module->newConstInt(divisor));
+    }
+
+    uint32_t ad = divisor < 0 ? 0u - (uint32_t) divisor : (uint32_t) divisor;
+
+    int32_t k = log2Exact(ad);
+    if (k != -1) {
+
+        // 被除数为负数时加上2^k-1，使算术右移向0取整
+        Value * bias;
+        if (k == 1) {
+            bias = insertBinary(pos, IRInstOperator::IRINST_OP_LSHR_I, val, module->newConstInt(31));
+        } else {
+            Value * sign = insertBinary(pos, IRInstOperator::IRINST_OP_ASHR_I, val, module->newConstInt(31));
+            bias = insertBinary(pos, IRInstOperator::IRINST_OP_LSHR_I, sign, module->newConstInt(32 - k));
+        }
+
+        Value * sum = insertBinary(pos, IRInstOperator::IRINST_OP_ADD_I, val, bias);
+        Value * quotient = insertBinary(pos, IRInstOperator::IRINST_OP_ASHR_I, sum, module->newConstInt(k));
+
+        if (divisor < 0) {
+            quotient = insertBinary(pos, IRInstOperator::IRINST_OP_NEG_I, module->newConstInt(0), quotient);
+        }
+
+        return quotient;
+    }
+
+    int32_t magic, shift;
+    computeMagic(divisor, magic, shift);
+
+    Value * quotient = insertBinary(pos, IRInstOperator::IRINST_OP_MULH_I, val, module->newConstInt(magic));
+
+    // 魔数超出int32的范围时取的是减去2^32后的值，需要补回被除数
+    if (divisor > 0 && magic < 0) {
+        quotient = insertBinary(pos, IRInstOperator::IRINST_OP_ADD_I, quotient, val);
+    } else if (divisor < 0 && magic > 0) {
+        quotient = insertBinary(pos, IRInstOperator::IRINST_OP_SUB_I, quotient, val);
+    }
+
+    if (shift > 0) {
+        quotient = insertBinary(pos, IRInstOperator::IRINST_OP_ASHR_I, quotient, module->newConstInt(shift));
+    }
+
+    // 此时的商向负无穷取整，为负数时加1改为向0取整
+    Value * sign = insertBinary(pos, IRInstOperator::IRINST_OP_LSHR_I, quotient, module->newConstInt(31));
+
+    return insertBinary(pos, IRInstOperator::IRINST_OP_ADD_I, quotient, sign);
+}
+
+///
+/// @brief 在pos之前插入求x%d的指令序列
+/// @param pos 插入位置
+/// @param val 被除数
+/// @param divisor 除数，不为0、1与-1
+/// @return Value* 余数
+///
+Value * DivByConstant::emitMod(Instruction * pos, Value * val, int32_t divisor)
+{
+    // 余数的符号与被除数相同，与除数的符号无关。INT32_MIN的绝对值按无符号数为2^31
+    uint32_t ad = divisor < 0 ? 0u - (uint32_t) divisor : (uint32_t) divisor;
+
+    Value * quotient = emitDiv(pos, val, (int32_t) ad);
+
+    Value * product;
+    int32_t k = log2Exact(ad);
+    if (k != -1) {
+        product = insertBinary(pos, IRInstOperator::IRINST_OP_SHL_I, quotient, module->newConstInt(k));
+    } else {
+        product = insertBinary(pos, IRInstOperator::IRINST_OP_MUL_I, quotient, module->newConstInt((int32_t) ad));
+    }
+
+    return insertBinary(pos, IRInstOperator::IRINST_OP_SUB_I, val, product);
+}
+
+///
+/// @brief 在pos之前插入二元运算，结果类型与pos相同
+/// @param pos 插入位置
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @return Instruction* 新指令
+///
+Instruction * DivByConstant::insertBinary(Instruction * pos, IRInstOperator op, Value * lhs, Value * rhs)
+{
+    Instruction * inst = func->newInst<BinaryInstruction>(op, lhs, rhs, pos->getType());
+
+    BasicBlock * bb = pos->getParent();
+    bb->insert(bb->getIterator(pos), inst);
+
+    return inst;
+}
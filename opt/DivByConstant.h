@@ -0,0 +1,106 @@
+///
+/// @file DivByConstant.h
+/// @brief 除以常量的除法与求余改为乘法取高位与移位
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+#include "Pass.h"
+
+///
+/// @brief 除以常量的有符号除法与求余的强度削弱。硬件除法指令很慢，按Granlund-Montgomery的方法
+/// 用魔数乘法取高32位再移位得到向0取整的商，商为负数时加1修正：
+/// (1) 除数为2的幂时，加上偏置后算术右移；
+/// (2) 其它除数用魔数乘法取高位，魔数符号与除数不同时加上或减去被除数，再移位、修正；
+/// (3) 除数为负数时，2的幂的商求负，其它除数直接使用负的魔数；
+/// (4) 除数为INT32_MIN时商只可能为0或1，改为与INT32_MIN的比较，除数为-1时改为求负；
+/// (5) 求余由x-(x/d)*d得到，x%d与x%(-d)相同，按除数的绝对值计算。
+/// 除数为0的运算保留到运行时，除数为1的运算由常量折叠负责。
+/// 改写后的指令序列比一条除法指令长，以代码大小优先时不执行本遍
+///
+class DivByConstant final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    DivByConstant();
+
+    ///
+    /// @brief 对函数改写除以常量的除法与求余
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 只在基本块内改写指令，不改变控制流图
+    /// @return true
+    ///
+    [[nodiscard]] bool preservesCFG() const override
+    {
+        return true;
+    }
+
+    ///
+    /// @brief 计算有符号除法的魔数与移位位数，使x/d = mulh(x, magic) >> shift，
+    /// 再按魔数与除数的符号加减x、商为负数时加1修正
+    /// @param divisor 除数，绝对值至少为2且不是INT32_MIN
+    /// @param magic 魔数
+    /// @param shift 移位位数
+    ///
+    static void computeMagic(int32_t divisor, int32_t & magic, int32_t & shift);
+
+protected:
+    ///
+    /// @brief 在pos之前插入求x/d的指令序列
+    /// @param pos 插入位置
+    /// @param val 被除数
+    /// @param divisor 除数，不为0和1
+    /// @return Value* 商
+    ///
+    Value * emitDiv(Instruction * pos, Value * val, int32_t divisor);
+
+    ///
+    /// @brief 在pos之前插入求x%d的指令序列
+    /// @param pos 插入位置
+    /// @param val 被除数
+    /// @param divisor 除数，不为0、1与-1
+    /// @return Value* 余数
+    ///
+    Value * emitMod(Instruction * pos, Value * val, int32_t divisor);
+
+    ///
+    /// @brief 在pos之前插入二元运算
+    /// @param pos 插入位置
+    /// @param op 运算符
+    /// @param lhs 左操作数
+    /// @param rhs 右操作数
+    /// @return Instruction* 新指令
+    ///
+    Instruction * insertBinary(Instruction * pos, IRInstOperator op, Value * lhs, Value * rhs);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+};
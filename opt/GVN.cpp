@@ -0,0 +1,168 @@
+///
+/// @file GVN.cpp
+/// @brief 基于支配树的全局值编号，删除冗余的运算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <functional>
+#include <vector>
+
+#include "GVN.h"
+#include "ConstantFold.h"
+#include "DominatorTree.h"
+
+///
+/// @brief 构造函数
+///
+GVN::GVN() : FunctionPass("gvn")
+{}
+
+///
+/// @brief 获取二元运算规范化后的键
+/// @param inst 二元运算指令
+/// @param key 键
+/// @return true 可以编号，false 不是二元运算或者操作数不是SSA值
+///
+bool GVN::getKey(Instruction * inst, ExprKey & key)
+{
+    IRInstOperator op = inst->getOp();
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_NEG_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NEQ_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_SHL_I:
+        case IRInstOperator::IRINST_OP_ASHR_I:
+        case IRInstOperator::IRINST_OP_LSHR_I:
+        case IRInstOperator::IRINST_OP_MIN_I:
+        case IRInstOperator::IRINST_OP_MAX_I:
+        case IRInstOperator::IRINST_OP_ABS_I:
+        case IRInstOperator::IRINST_OP_MULH_I:
+            break;
+        default:
+            return false;
+    }
+
+    Value * lhs = inst->getOperand(0);
+    Value * rhs = inst->getOperand(1);
+
+    // 指令的结果与常量不会改变，变量则可能在两次运算之间被赋值
+    for (auto val: {lhs, rhs}) {
+        if (!dynamic_cast<Instruction *>(val) && !dynamic_cast<ConstInt *>(val)) {
+            return false;
+        }
+    }
+
+    if (op == IRInstOperator::IRINST_OP_GT_I) {
+        op = IRInstOperator::IRINST_OP_LT_I;
+        std::swap(lhs, rhs);
+    } else if (op == IRInstOperator::IRINST_OP_GE_I) {
+        op = IRInstOperator::IRINST_OP_LE_I;
+        std::swap(lhs, rhs);
+    } else if (isCommutative(op) && std::less<Value *>()(rhs, lhs)) {
+        std::swap(lhs, rhs);
+    }
+
+    key = std::make_tuple(op, lhs, rhs);
+    return true;
+}
+
+///
+/// @brief 对函数删除冗余的运算
+/// @param func 要处理的函数
+/// @param module 模块
+/// @return true 函数被修改
+///
+bool GVN::runOnFunction(Function * func, Module * module)
+{
+    (void) module;
+
+    available.clear();
+
+    if (func->getBasicBlocks().empty()) {
+        return false;
+    }
+
+    DominatorTree * domTree = func->getDominatorTree();
+    bool changed = false;
+
+    // 非递归遍历支配树，每层记录本基本块加入的运算，离开时从表中删除
+    struct Frame {
+        BasicBlock * bb;
+        size_t next;
+        std::vector<ExprKey> added;
+    };
+
+    std::vector<Frame> stack;
+    stack.push_back({func->getEntryBlock(), 0, {}});
+
+    bool enter = true;
+
+    while (!stack.empty()) {
+
+        Frame & frame = stack.back();
+
+        if (enter) {
+
+            BasicBlock * bb = frame.bb;
+            for (auto iter = bb->begin(); iter != bb->end();) {
+
+                Instruction * inst = *iter;
+
+                ExprKey key;
+                if (!getKey(inst, key)) {
+                    ++iter;
+                    continue;
+                }
+
+                auto found = available.find(key);
+                if (found == available.end()) {
+                    available.emplace(key, inst);
+                    frame.added.push_back(key);
+                    ++iter;
+                    continue;
+                }
+
+                // 已有支配本指令的相同运算，本指令是冗余的
+                inst->replaceAllUsesWith(found->second);
+                iter = bb->erase(iter);
+                inst->clearOperands();
+                changed = true;
+            }
+        }
+
+        const std::vector<BasicBlock *> & children = domTree->getChildren(frame.bb);
+        if (frame.next < children.size()) {
+            BasicBlock * child = children[frame.next++];
+            stack.push_back({child, 0, {}});
+            enter = true;
+            continue;
+        }
+
+        for (auto & key: frame.added) {
+            available.erase(key);
+        }
+        stack.pop_back();
+        enter = false;
+    }
+
+    return changed;
+}
@@ -0,0 +1,74 @@
+///
+/// @file GVN.h
+/// @brief 基于支配树的全局值编号，删除冗余的运算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <map>
+#include <tuple>
+
+#include "Pass.h"
+
+///
+/// @brief 基于支配树的全局值编号（Dominator-based Value Numbering）。
+/// 沿支配树先序遍历，用随作用域进出的表记录支配当前位置的二元运算，
+/// 遇到运算符与操作数都相同的运算时，其使用改为支配它的已有运算，并删除该运算。
+/// 可交换运算的操作数排序，a>b与a>=b分别规范为b<a与b<=a，使等价的写法得到相同的编号。
+/// 只处理操作数都是SSA值或常量的运算，局部变量与全局变量在两次运算之间可能被修改
+///
+class GVN final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    GVN();
+
+    ///
+    /// @brief 对函数删除冗余的运算
+    /// @param func 要处理的函数
+    /// @param module 模块
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * func, Module * module) override;
+
+    ///
+    /// @brief 只删除基本块内的指令，不改变控制流图
+    /// @return true
+    ///
+    [[nodiscard]] bool preservesCFG() const override
+    {
+        return true;
+    }
+
+protected:
+    ///
+    /// @brief 运算的键：(运算符, 左操作数, 右操作数)
+    ///
+    using ExprKey = std::tuple<IRInstOperator, Value *, Value *>;
+
+    ///
+    /// @brief 获取二元运算规范化后的键
+    /// @param inst 二元运算指令
+    /// @param key 键
+    /// @return true 可以编号，false 不是二元运算或者操作数不是SSA值
+    ///
+    static bool getKey(Instruction * inst, ExprKey & key);
+
+private:
+    ///
+    /// @brief 支配当前位置的运算
+    ///
+    std::map<ExprKey, Instruction *> available;
+};
@@ -0,0 +1,405 @@
+///
+/// @file IndVarSimplify.cpp
+/// @brief 归纳变量的强度削弱、线性函数测试替换与出口值替换
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "IndVarSimplify.h"
+#include "InductionVariable.h"
+#include "LoopInfo.h"
+#include "LoopUtils.h"
+#include "BinaryInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 判断64位的值是否在int32的范围内
+/// @param val 值
+/// @return true 在范围内
+///
+static bool fitsInt32(int64_t val)
+{
+    return val >= std::numeric_limits<int32_t>::min() && val <= std::numeric_limits<int32_t>::max();
+}
+
+///
+/// @brief 按32位补码回绕计算a + b * c
+/// @param a 加数
+/// @param b 乘数
+/// @param c 乘数
+/// @return int32_t 结果
+///
+static int32_t wrapMulAdd(int64_t a, int64_t b, int64_t c)
+{
+    return (int32_t) (uint32_t) ((uint64_t) a + (uint64_t) b * (uint64_t) c);
+}
+
+///
+/// @brief 构造函数
+///
+IndVarSimplify::IndVarSimplify() : FunctionPass("indvars")
+{}
+
+///
+/// @brief 对函数执行归纳变量化简
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool IndVarSimplify::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    if (func->getBasicBlocks().empty() || func->getLoopInfo()->getLoops().empty()) {
+        return false;
+    }
+
+    bool changed = insertPreheaders(func) > 0;
+
+    // 内层循环在前；变换只在基本块内增删指令，循环信息一直有效
+    for (auto loop: func->getLoopInfo()->getLoops()) {
+
+        InductionVariableInfo info(loop);
+        if (info.getInductionVariables().empty()) {
+            continue;
+        }
+
+        if (info.hasTripCount()) {
+            tripCountHits++;
+        }
+
+        std::vector<ReducedVariable> reduced;
+        changed |= strengthReduce(info, reduced);
+
+        // 出口值替换后，循环外不再使用归纳变量，出口比较才可能被替换
+        changed |= replaceExitValues(info);
+        changed |= replaceExitTest(info, reduced);
+    }
+
+    return changed;
+}
+
+///
+/// @brief 输出各项变换的次数
+/// @param fp 输出的文件
+///
+void IndVarSimplify::printStatistics(FILE * fp) const
+{
+    fprintf(fp, "%s:\n", getName().c_str());
+    fprintf(fp, "%12lld  trip-counts\n", (long long) tripCountHits);
+    fprintf(fp, "%12lld  strength-reduced\n", (long long) reducedHits);
+    fprintf(fp, "%12lld  reduce-skipped-unprofitable\n", (long long) unprofitableSkips);
+    fprintf(fp, "%12lld  reduce-skipped-pressure\n", (long long) pressureSkips);
+    fprintf(fp, "%12lld  exit-tests-replaced\n", (long long) exitTestHits);
+    fprintf(fp, "%12lld  exit-values-replaced\n", (long long) exitValueHits);
+}
+
+///
+/// @brief 把循环内归纳变量与循环不变量的乘法改为新的归纳变量。
+/// ARM32的mul与add一样是一条指令，一个乘法改为递推的加法并不减少指令，还多占用一个贯穿循环的寄存器，
+/// 因此只在新的归纳变量替代多个相同的乘法，或者接管出口比较使原来的归纳变量成为死代码时才做；
+/// 后者不增加同时活跃的值，前者在循环的寄存器压力已达上限时不做
+/// @param info 循环的归纳变量信息
+/// @param reduced 新建的归纳变量
+/// @return true 有乘法被替换
+///
+bool IndVarSimplify::strengthReduce(const InductionVariableInfo & info, std::vector<ReducedVariable> & reduced)
+{
+    // 按(基本归纳变量, 乘数)分组收集候选的乘法
+    struct Candidate {
+        const InductionVariable * base;
+        Value * factor;
+        std::vector<Instruction *> muls;
+    };
+    std::vector<Candidate> candidates;
+
+    for (auto bb: info.getLoop()->getBlocks()) {
+        for (auto inst: bb->getInsts()) {
+
+            if (inst->getOp() != IRInstOperator::IRINST_OP_MUL_I) {
+                continue;
+            }
+
+            for (int32_t side = 0; side < 2; ++side) {
+
+                const InductionVariable * iv = info.getInductionVariable(inst->getOperand(side));
+                Value * factor = inst->getOperand(1 - side);
+                if (!iv || inst->getOperand(side) != iv->phi || !info.isInvariant(factor)) {
+                    continue;
+                }
+
+                auto iter = candidates.begin();
+                while (iter != candidates.end() && (iter->base != iv || iter->factor != factor)) {
+                    ++iter;
+                }
+                if (iter == candidates.end()) {
+                    candidates.push_back({iv, factor, {}});
+                    iter = std::prev(candidates.end());
+                }
+                iter->muls.push_back(inst);
+                break;
+            }
+        }
+    }
+
+    if (candidates.empty()) {
+        return false;
+    }
+
+    int32_t pressure = getMaxLiveValues(func, info.getLoop());
+    bool changed = false;
+
+    for (auto & candidate: candidates) {
+
+        bool takesOverExit = takesOverExitTest(info, candidate.base, candidate.factor, candidate.muls);
+        if (!takesOverExit && candidate.muls.size() < 2) {
+            unprofitableSkips++;
+            continue;
+        }
+
+        // 新的Phi指令贯穿整个循环；接管出口比较时原来的归纳变量随之死去，压力不变
+        if (!takesOverExit) {
+            if (pressure >= loopRegisterLimit) {
+                pressureSkips++;
+                continue;
+            }
+            pressure++;
+        }
+
+        reduced.push_back(createReduced(info, candidate.base, candidate.factor));
+        PhiInstruction * phi = reduced.back().phi;
+
+        for (auto inst: candidate.muls) {
+            inst->replaceAllUsesWith(phi);
+            inst->getParent()->erase(inst);
+            inst->clearOperands();
+            reducedHits++;
+        }
+        changed = true;
+    }
+
+    return changed;
+}
+
+///
+/// @brief 判断base * factor的归纳变量能否接管出口比较，即替换出口比较后base只剩下自身的递推。
+/// 此时强度削弱与线性函数测试替换合起来把乘法和base的递推换成一个递推，总是有利的
+/// @param info 循环的归纳变量信息
+/// @param base 基本归纳变量
+/// @param factor 乘数
+/// @param muls 要替换的base * factor的乘法
+/// @return true 能够接管
+///
+bool IndVarSimplify::takesOverExitTest(const InductionVariableInfo & info,
+                                       const InductionVariable * base,
+                                       Value * factor,
+                                       const std::vector<Instruction *> & muls)
+{
+    Instruction * cmp = info.getExitCompare();
+    if (!cmp || !info.hasTripCount() || base != info.getExitVariable() || !exitTestFits(info, factor)) {
+        return false;
+    }
+
+    // 循环外的使用由出口值替换改为常量，循环内除了递推与出口比较只能用于要替换的乘法
+    Loop * loop = info.getLoop();
+    for (auto val: {static_cast<Instruction *>(base->phi), base->next}) {
+        for (auto use: val->getUses()) {
+            auto user = static_cast<Instruction *>(use->getUser());
+            if (user != base->phi && user != base->next && user != cmp && loop->contains(user->getParent()) &&
+                std::find(muls.begin(), muls.end(), user) == muls.end()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 判断出口比较的两边乘以factor后是否与原比较等价：factor为正的常量，且参与比较的值乘以它后不超出int32
+/// @param info 循环的归纳变量信息，必须已求出迭代次数
+/// @param factor 乘数
+/// @return true 等价
+///
+bool IndVarSimplify::exitTestFits(const InductionVariableInfo & info, Value * factor)
+{
+    auto factorConst = dynamic_cast<ConstInt *>(factor);
+    if (!factorConst || factorConst->getVal() <= 0) {
+        return false;
+    }
+
+    const InductionVariable * iv = info.getExitVariable();
+    int64_t bound = static_cast<ConstInt *>(info.getExitBound())->getVal();
+
+    // 参与比较的值从first到last单调变化，last为第一个使比较不成立的值
+    int64_t count = info.getTripCount() - (info.isExitAtLatch() ? 1 : 0);
+    int64_t first = (int64_t) static_cast<ConstInt *>(iv->init)->getVal() + (info.isExitOnNext() ? iv->step : 0);
+    int64_t last = first + count * iv->step;
+
+    // 乘以正数保持大小关系，不溢出时两边的比较等价
+    int64_t k = factorConst->getVal();
+    return fitsInt32(first * k) && fitsInt32(last * k) && fitsInt32(bound * k);
+}
+
+///
+/// @brief 新建base * factor的归纳变量
+/// @param info 循环的归纳变量信息
+/// @param base 基本归纳变量
+/// @param factor 乘数
+/// @return ReducedVariable 新的归纳变量
+///
+IndVarSimplify::ReducedVariable
+IndVarSimplify::createReduced(const InductionVariableInfo & info, const InductionVariable * base, Value * factor)
+{
+    Loop * loop = info.getLoop();
+    BasicBlock * preheader = loop->getPreheader();
+    Instruction * branch = preheader->getTerminator();
+    Type * type = base->phi->getType();
+
+    auto initConst = dynamic_cast<ConstInt *>(base->init);
+    auto factorConst = dynamic_cast<ConstInt *>(factor);
+
+    // 初值init * k与增量s * k在前置基本块中计算，常量时直接折叠
+    Value * start;
+    if (initConst && (factorConst || initConst->getVal() == 0)) {
+        start = module->newConstInt(factorConst ? wrapMulAdd(0, initConst->getVal(), factorConst->getVal()) : 0);
+    } else {
+        start = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_MUL_I, base->init, factor, type);
+        preheader->insert(preheader->getIterator(branch), static_cast<Instruction *>(start));
+    }
+
+    Value * stride;
+    if (factorConst) {
+        stride = module->newConstInt(wrapMulAdd(0, base->step, factorConst->getVal()));
+    } else if (base->step == 1) {
+        stride = factor;
+    } else {
+        stride = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_MUL_I,
+                                                  factor,
+                                                  module->newConstInt(base->step),
+                                                  type);
+        preheader->insert(preheader->getIterator(branch), static_cast<Instruction *>(stride));
+    }
+
+    ReducedVariable var;
+    var.base = base;
+    var.factor = factor;
+
+    // Phi指令放在基本归纳变量的Phi指令之前，仍在循环头的开始处
+    BasicBlock * header = loop->getHeader();
+    var.phi = func->newInst<PhiInstruction>(type);
+    header->insert(header->getIterator(base->phi), var.phi);
+
+    // 紧跟在基本归纳变量的next之后递推，出口比较使用next时也能改用它
+    BasicBlock * nextBlock = base->next->getParent();
+    var.next = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_ADD_I, var.phi, stride, type);
+    nextBlock->insert(std::next(nextBlock->getIterator(base->next)), var.next);
+
+    var.phi->addIncoming(start, preheader);
+    var.phi->addIncoming(var.next, loop->getLatch());
+
+    return var;
+}
+
+///
+/// @brief 线性函数测试替换，出口比较改用强度削弱得到的归纳变量
+/// @param info 循环的归纳变量信息
+/// @param reduced 强度削弱得到的归纳变量
+/// @return true 替换了出口比较
+///
+bool IndVarSimplify::replaceExitTest(const InductionVariableInfo & info, const std::vector<ReducedVariable> & reduced)
+{
+    Instruction * cmp = info.getExitCompare();
+    const InductionVariable * iv = info.getExitVariable();
+    if (!cmp || !info.hasTripCount()) {
+        return false;
+    }
+
+    // 基本归纳变量除了自身的递推只用于出口比较时，替换后才能删除
+    for (auto use: iv->phi->getUses()) {
+        if (use->getUser() != iv->next && use->getUser() != cmp) {
+            return false;
+        }
+    }
+    for (auto use: iv->next->getUses()) {
+        if (use->getUser() != iv->phi && use->getUser() != cmp) {
+            return false;
+        }
+    }
+
+    int32_t ivSide = (cmp->getOperand(0) == iv->phi || cmp->getOperand(0) == iv->next) ? 0 : 1;
+    int64_t bound = static_cast<ConstInt *>(info.getExitBound())->getVal();
+
+    for (auto & var: reduced) {
+
+        if (var.base != iv || !exitTestFits(info, var.factor)) {
+            continue;
+        }
+
+        int64_t factor = static_cast<ConstInt *>(var.factor)->getVal();
+        cmp->setOperand(ivSide, info.isExitOnNext() ? var.next : static_cast<Instruction *>(var.phi));
+        cmp->setOperand(1 - ivSide, module->newConstInt((int32_t) (bound * factor)));
+        exitTestHits++;
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 循环外使用的归纳变量替换为出口处的常量
+/// @param info 循环的归纳变量信息
+/// @return true 有使用被替换
+///
+bool IndVarSimplify::replaceExitValues(const InductionVariableInfo & info)
+{
+    if (!info.hasTripCount()) {
+        return false;
+    }
+
+    bool changed = false;
+    int64_t tripCount = info.getTripCount();
+
+    for (auto & iv: info.getInductionVariables()) {
+
+        auto initConst = dynamic_cast<ConstInt *>(iv.init);
+        if (!initConst) {
+            continue;
+        }
+
+        bool replaced;
+        if (info.isExitAtLatch()) {
+
+            // 最后一次迭代执行完循环体后离开，Phi指令为第tripCount-1次迭代的值，next再加一次step
+            Value * phiExit = module->newConstInt(wrapMulAdd(initConst->getVal(), tripCount - 1, iv.step));
+            Value * nextExit = module->newConstInt(wrapMulAdd(initConst->getVal(), tripCount, iv.step));
+            replaced = replaceUsesOutside(info.getLoop(), iv.phi, phiExit);
+            replaced |= replaceUsesOutside(info.getLoop(), iv.next, nextExit);
+        } else {
+
+            // 在循环头离开，Phi指令已经递推了tripCount次；next在循环体中计算，不会在循环外使用
+            Value * phiExit = module->newConstInt(wrapMulAdd(initConst->getVal(), tripCount, iv.step));
+            replaced = replaceUsesOutside(info.getLoop(), iv.phi, phiExit);
+        }
+
+        if (replaced) {
+            exitValueHits++;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
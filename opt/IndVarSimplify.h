@@ -0,0 +1,172 @@
+///
+/// @file IndVarSimplify.h
+/// @brief 归纳变量的强度削弱、线性函数测试替换与出口值替换
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Pass.h"
+
+class Loop;
+class PhiInstruction;
+class InductionVariableInfo;
+struct InductionVariable;
+
+///
+/// @brief 归纳变量化简。先为每个循环插入前置基本块，再由内向外处理各层循环：
+/// (1) 强度削弱：基本归纳变量i={init, +, s}与循环不变量k的乘积i*k改为新的归纳变量{init*k, +, s*k}，
+/// 每次迭代的乘法变为加法，补码运算回绕时结果也相同。mul只是一条指令，只在替代多个相同的乘法
+/// （且寄存器压力未达上限），或者新的归纳变量接管出口比较时才做；
+/// (2) 线性函数测试替换：出口条件i op n中的i只用于自身递推时，改为比较强度削弱得到的i*k与n*k，
+/// 要求k为正的常量且迭代次数已知，参与比较的值乘以k后都不超出int32的范围，原来的i随之成为死代码；
+/// (3) 出口值替换：迭代次数已知且初值为常量时，循环外使用的归纳变量改为其出口处的常量。
+/// 死去的归纳变量由死代码删除负责删除
+///
+class IndVarSimplify final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    IndVarSimplify();
+
+    ///
+    /// @brief 对函数执行归纳变量化简
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 输出各项变换的次数
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp) const override;
+
+protected:
+    ///
+    /// @brief 强度削弱得到的归纳变量，值为base * factor
+    ///
+    struct ReducedVariable {
+
+        /// @brief 基本归纳变量
+        const InductionVariable * base;
+
+        /// @brief 乘数，循环不变量
+        Value * factor;
+
+        /// @brief 循环头的Phi指令
+        PhiInstruction * phi;
+
+        /// @brief 下一次迭代的值，紧跟在基本归纳变量的next之后计算
+        Instruction * next;
+    };
+
+    ///
+    /// @brief 把循环内归纳变量与循环不变量的乘法改为新的归纳变量
+    /// @param info 循环的归纳变量信息
+    /// @param reduced 新建的归纳变量
+    /// @return true 有乘法被替换
+    ///
+    bool strengthReduce(const InductionVariableInfo & info, std::vector<ReducedVariable> & reduced);
+
+    ///
+    /// @brief 新建base * factor的归纳变量
+    /// @param info 循环的归纳变量信息
+    /// @param base 基本归纳变量
+    /// @param factor 乘数
+    /// @return ReducedVariable 新的归纳变量
+    ///
+    ReducedVariable createReduced(const InductionVariableInfo & info, const InductionVariable * base, Value * factor);
+
+    ///
+    /// @brief 判断base * factor的归纳变量能否接管出口比较，即替换出口比较后base只剩下自身的递推
+    /// @param info 循环的归纳变量信息
+    /// @param base 基本归纳变量
+    /// @param factor 乘数
+    /// @param muls 要替换的base * factor的乘法
+    /// @return true 能够接管
+    ///
+    bool takesOverExitTest(const InductionVariableInfo & info,
+                           const InductionVariable * base,
+                           Value * factor,
+                           const std::vector<Instruction *> & muls);
+
+    ///
+    /// @brief 判断出口比较的两边乘以factor后是否与原比较等价
+    /// @param info 循环的归纳变量信息，必须已求出迭代次数
+    /// @param factor 乘数
+    /// @return true 等价
+    ///
+    bool exitTestFits(const InductionVariableInfo & info, Value * factor);
+
+    ///
+    /// @brief 线性函数测试替换，出口比较改用强度削弱得到的归纳变量
+    /// @param info 循环的归纳变量信息
+    /// @param reduced 强度削弱得到的归纳变量
+    /// @return true 替换了出口比较
+    ///
+    bool replaceExitTest(const InductionVariableInfo & info, const std::vector<ReducedVariable> & reduced);
+
+    ///
+    /// @brief 循环外使用的归纳变量替换为出口处的常量
+    /// @param info 循环的归纳变量信息
+    /// @return true 有使用被替换
+    ///
+    bool replaceExitValues(const InductionVariableInfo & info);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+
+    ///
+    /// @brief 求出迭代次数的循环个数，所有函数累计
+    ///
+    int64_t tripCountHits = 0;
+
+    ///
+    /// @brief 强度削弱的乘法个数，所有函数累计
+    ///
+    int64_t reducedHits = 0;
+
+    ///
+    /// @brief 不减少指令而没有强度削弱的乘法分组个数，所有函数累计
+    ///
+    int64_t unprofitableSkips = 0;
+
+    ///
+    /// @brief 寄存器压力已达上限而没有强度削弱的乘法分组个数，所有函数累计
+    ///
+    int64_t pressureSkips = 0;
+
+    ///
+    /// @brief 线性函数测试替换的次数，所有函数累计
+    ///
+    int64_t exitTestHits = 0;
+
+    ///
+    /// @brief 出口值替换的归纳变量个数，所有函数累计
+    ///
+    int64_t exitValueHits = 0;
+};
@@ -0,0 +1,804 @@
+///
+/// @file InstCombine.cpp
+/// @brief 指令合并，按规则表对IR进行代数化简与规范化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include "InstCombine.h"
+#include "BinaryInstruction.h"
+#include "CondBrInstruction.h"
+#include "ConstantFold.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 指令改写规则表，按顺序尝试。常量规范到右边的规则在前，后面的规则只需识别常量在右边的形式
+///
+const InstCombine::Rule InstCombine::rules[] = {
+    {"commute-constant-right", &InstCombine::commuteConstantRight},
+    {"sub-zero-to-neg", &InstCombine::subZeroToNeg},
+    {"double-neg", &InstCombine::doubleNeg},
+    {"neg-of-sub", &InstCombine::negOfSub},
+    {"sub-of-neg", &InstCombine::subOfNeg},
+    {"add-of-neg", &InstCombine::addOfNeg},
+    {"compare-of-compare", &InstCombine::compareOfCompare},
+    {"branch-on-compare-zero", &InstCombine::branchOnCompareZero},
+    {"mul-power-of-two", &InstCombine::mulPowerOfTwo},
+    {"div-power-of-two", &InstCombine::divPowerOfTwo},
+    {"select-diamond", &InstCombine::selectDiamond},
+};
+
+///
+/// @brief 二选一识别规则表，按顺序尝试
+///
+const InstCombine::SelectRule InstCombine::selectRules[] = {
+    {"select-min-max", &InstCombine::matchMinMax},
+    {"select-abs", &InstCombine::matchAbs},
+    {"select-bool", &InstCombine::matchBool},
+};
+
+///
+/// @brief 判断值是否在定值后不再改变，即指令的结果或常量，这样的值可以移到别处使用
+/// @param val 值
+/// @return true 不再改变
+///
+static bool isStable(Value * val)
+{
+    return dynamic_cast<Instruction *>(val) || dynamic_cast<ConstInt *>(val);
+}
+
+///
+/// @brief 判断值是否为指定的整数常量
+/// @param val 值
+/// @param expected 常量值
+/// @return true 是
+///
+static bool isConstant(Value * val, int32_t expected)
+{
+    auto constVal = dynamic_cast<ConstInt *>(val);
+    return constVal && constVal->getVal() == expected;
+}
+
+///
+/// @brief 获取求负的操作数，求负指令以及0-x都是求负
+/// @param val 值
+/// @return Value* 被求负的值，不是求负时为nullptr
+///
+static Value * getNegated(Value * val)
+{
+    auto inst = dynamic_cast<Instruction *>(val);
+    if (!inst) {
+        return nullptr;
+    }
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_NEG_I ||
+        (inst->getOp() == IRInstOperator::IRINST_OP_SUB_I && isConstant(inst->getOperand(0), 0))) {
+        return inst->getOperand(1);
+    }
+
+    return nullptr;
+}
+
+///
+/// @brief 获取2的幂的指数
+/// @param val 值
+/// @return int32_t 指数，不是2的幂的正整数常量时返回-1
+///
+static int32_t getPowerOfTwo(Value * val)
+{
+    auto constVal = dynamic_cast<ConstInt *>(val);
+    if (!constVal || constVal->getVal() <= 0 || (constVal->getVal() & (constVal->getVal() - 1)) != 0) {
+        return -1;
+    }
+
+    int32_t k = 0;
+    while ((1 << k) != constVal->getVal()) {
+        k++;
+    }
+
+    return k;
+}
+
+///
+/// @brief 构造函数
+///
+InstCombine::InstCombine()
+    : FunctionPass("instcombine"), ruleHits(std::size(rules), 0), selectHits(std::size(selectRules), 0)
+{}
+
+///
+/// @brief 对函数执行指令合并
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool InstCombine::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    if (func->getBasicBlocks().empty()) {
+        return false;
+    }
+
+    // 改写产生的新指令在下一遍中继续尝试，每条规则都使指令变少或者变得更规范，不会往复
+    bool changed = false;
+    while (combine()) {
+        changed = true;
+    }
+
+    return changed;
+}
+
+///
+/// @brief 输出每条规则的命中次数
+/// @param fp 输出的文件
+///
+void InstCombine::printStatistics(FILE * fp) const
+{
+    fprintf(fp, "%s:\n", getName().c_str());
+
+    for (size_t k = 0; k < ruleHits.size(); ++k) {
+        fprintf(fp, "%12lld  %s\n", (long long) ruleHits[k], rules[k].name);
+    }
+
+    for (size_t k = 0; k < selectHits.size(); ++k) {
+        fprintf(fp, "%12lld  %s\n", (long long) selectHits[k], selectRules[k].name);
+    }
+}
+
+///
+/// @brief 对所有指令尝试一遍规则
+/// @return true 函数被修改
+///
+bool InstCombine::combine()
+{
+    // 规则会插入和删除指令，甚至删除基本块，因此先取指令的快照
+    std::vector<Instruction *> insts;
+    for (auto bb: func->getBasicBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            insts.push_back(inst);
+        }
+    }
+
+    bool changed = false;
+
+    for (auto inst: insts) {
+
+        // 已被前面的规则删除
+        if (!inst->getParent()) {
+            continue;
+        }
+
+        for (size_t k = 0; k < std::size(rules); ++k) {
+            if ((this->*rules[k].apply)(inst)) {
+                ruleHits[k]++;
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    return changed;
+}
+
+///
+/// @brief 常量操作数规范到右边：可交换运算交换操作数，比较运算交换操作数并改用对称的比较
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::commuteConstantRight(Instruction * inst)
+{
+    IRInstOperator op = inst->getOp();
+    if (!isCommutative(op) && !isComparison(op)) {
+        return false;
+    }
+
+    Value * lhs = inst->getOperand(0);
+    Value * rhs = inst->getOperand(1);
+    if (!dynamic_cast<ConstInt *>(lhs) || dynamic_cast<ConstInt *>(rhs)) {
+        return false;
+    }
+
+    if (isCommutative(op)) {
+        inst->setOperand(0, rhs);
+        inst->setOperand(1, lhs);
+    } else {
+        replaceInst(inst, insertBinary(inst, swapComparison(op), rhs, lhs, inst->getType()));
+    }
+
+    return true;
+}
+
+///
+/// @brief 0-x改为求负
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::subZeroToNeg(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_SUB_I || !isConstant(inst->getOperand(0), 0) ||
+        dynamic_cast<ConstInt *>(inst->getOperand(1))) {
+        return false;
+    }
+
+    Value * neg = insertBinary(inst,
+                               IRInstOperator::IRINST_OP_NEG_I,
+                               inst->getOperand(0),
+                               inst->getOperand(1),
+                               inst->getType());
+    replaceInst(inst, neg);
+
+    return true;
+}
+
+///
+/// @brief 双重求负：-(-x)改为x
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::doubleNeg(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_NEG_I) {
+        return false;
+    }
+
+    Value * val = getNegated(inst->getOperand(1));
+    if (!val || !isStable(val)) {
+        return false;
+    }
+
+    replaceInst(inst, val);
+
+    return true;
+}
+
+///
+/// @brief 差的求负：-(a-b)改为b-a
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::negOfSub(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_NEG_I) {
+        return false;
+    }
+
+    auto sub = dynamic_cast<Instruction *>(inst->getOperand(1));
+    if (!sub || sub->getOp() != IRInstOperator::IRINST_OP_SUB_I) {
+        return false;
+    }
+
+    Value * lhs = sub->getOperand(0);
+    Value * rhs = sub->getOperand(1);
+    if (!isStable(lhs) || !isStable(rhs)) {
+        return false;
+    }
+
+    replaceInst(inst, insertBinary(inst, IRInstOperator::IRINST_OP_SUB_I, rhs, lhs, inst->getType()));
+
+    return true;
+}
+
+///
+/// @brief 减去负数：a-(-b)改为a+b
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::subOfNeg(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_SUB_I) {
+        return false;
+    }
+
+    Value * val = getNegated(inst->getOperand(1));
+    if (!val || !isStable(val)) {
+        return false;
+    }
+
+    Value * add = insertBinary(inst, IRInstOperator::IRINST_OP_ADD_I, inst->getOperand(0), val, inst->getType());
+    replaceInst(inst, add);
+
+    return true;
+}
+
+///
+/// @brief 加上负数：a+(-b)改为a-b，(-a)+b改为b-a
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::addOfNeg(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_ADD_I) {
+        return false;
+    }
+
+    Value * lhs = inst->getOperand(0);
+    Value * rhs = inst->getOperand(1);
+
+    Value * val = getNegated(rhs);
+    if (!val || !isStable(val)) {
+        std::swap(lhs, rhs);
+        val = getNegated(rhs);
+        if (!val || !isStable(val)) {
+            return false;
+        }
+    }
+
+    replaceInst(inst, insertBinary(inst, IRInstOperator::IRINST_OP_SUB_I, lhs, val, inst->getType()));
+
+    return true;
+}
+
+///
+/// @brief 比较结果与0比较：(a<b)!=0改为a<b，(a<b)==0改为a>=b
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::compareOfCompare(Instruction * inst)
+{
+    IRInstOperator op = inst->getOp();
+    if ((op != IRInstOperator::IRINST_OP_EQ_I && op != IRInstOperator::IRINST_OP_NEQ_I) ||
+        !isConstant(inst->getOperand(1), 0)) {
+        return false;
+    }
+
+    auto cmp = dynamic_cast<Instruction *>(inst->getOperand(0));
+    if (!cmp || !isComparison(cmp->getOp())) {
+        return false;
+    }
+
+    // 比较的结果只有0和1，不等于0就是比较本身
+    if (op == IRInstOperator::IRINST_OP_NEQ_I) {
+        replaceInst(inst, cmp);
+        return true;
+    }
+
+    Value * lhs = cmp->getOperand(0);
+    Value * rhs = cmp->getOperand(1);
+    if (!isStable(lhs) || !isStable(rhs)) {
+        return false;
+    }
+
+    replaceInst(inst, insertBinary(inst, invertComparison(cmp->getOp()), lhs, rhs, inst->getType()));
+
+    return true;
+}
+
+///
+/// @brief 条件与0比较的条件跳转：x!=0时直接用x，x==0时用x并交换真假目标
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::branchOnCompareZero(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_COND_BR) {
+        return false;
+    }
+
+    auto condBrInst = static_cast<CondBrInstruction *>(inst);
+    auto cmp = dynamic_cast<Instruction *>(condBrInst->getCondition());
+    if (!cmp || !isConstant(cmp->getOperand(1), 0) ||
+        (cmp->getOp() != IRInstOperator::IRINST_OP_EQ_I && cmp->getOp() != IRInstOperator::IRINST_OP_NEQ_I)) {
+        return false;
+    }
+
+    // 条件跳转本身就是与0比较
+    Value * val = cmp->getOperand(0);
+    if (!isStable(val)) {
+        return false;
+    }
+
+    condBrInst->setOperand(0, val);
+
+    if (cmp->getOp() == IRInstOperator::IRINST_OP_EQ_I) {
+        LabelInstruction * trueTarget = condBrInst->getTrueTarget();
+        condBrInst->setTrueTarget(condBrInst->getFalseTarget());
+        condBrInst->setFalseTarget(trueTarget);
+    }
+
+    return true;
+}
+
+///
+/// @brief 乘以2的幂改为左移，乘以-1改为求负
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::mulPowerOfTwo(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_MUL_I) {
+        return false;
+    }
+
+    Value * lhs = inst->getOperand(0);
+    Value * rhs = inst->getOperand(1);
+
+    if (isConstant(rhs, -1)) {
+        Value * zero = module->newConstInt(0);
+        replaceInst(inst, insertBinary(inst, IRInstOperator::IRINST_OP_NEG_I, zero, lhs, inst->getType()));
+        return true;
+    }
+
+    // 乘以1由常量折叠与化简处理
+    int32_t k = getPowerOfTwo(rhs);
+    if (k < 1) {
+        return false;
+    }
+
+    Value * shift = insertBinary(inst, IRInstOperator::IRINST_OP_SHL_I, lhs, module->newConstInt(k), inst->getType());
+    replaceInst(inst, shift);
+
+    return true;
+}
+
+///
+/// @brief 除以2的幂改为加上偏置后算术右移，使负数向0取整：
+/// x/2^k = (x + ((x >> 31) >>> (32-k))) >> k，偏置在x为负数时为2^k-1，否则为0
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::divPowerOfTwo(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_DIV_I) {
+        return false;
+    }
+
+    // 2^31不是int32范围的正数，除以1由常量折叠与化简处理
+    int32_t k = getPowerOfTwo(inst->getOperand(1));
+    if (k < 1) {
+        return false;
+    }
+
+    // 新指令都紧挨在除法之前，多次读取的变量之间没有赋值
+    Value * val = inst->getOperand(0);
+    Type * type = inst->getType();
+
+    Value * bias;
+    if (k == 1) {
+        // 偏置就是符号位
+        bias = insertBinary(inst, IRInstOperator::IRINST_OP_LSHR_I, val, module->newConstInt(31), type);
+    } else {
+        Value * sign = insertBinary(inst, IRInstOperator::IRINST_OP_ASHR_I, val, module->newConstInt(31), type);
+        bias = insertBinary(inst, IRInstOperator::IRINST_OP_LSHR_I, sign, module->newConstInt(32 - k), type);
+    }
+
+    Value * sum = insertBinary(inst, IRInstOperator::IRINST_OP_ADD_I, val, bias, type);
+    replaceInst(inst, insertBinary(inst, IRInstOperator::IRINST_OP_ASHR_I, sum, module->newConstInt(k), type));
+
+    return true;
+}
+
+///
+/// @brief 消去只对值二选一的菱形或三角形分支：分支臂中的运算提前到条件跳转之前计算，
+/// 汇合处的Phi指令全部识别为等价的运算后，条件跳转改为无条件跳转，删除分支臂
+/// @param inst 指令
+/// @return true 命中
+///
+bool InstCombine::selectDiamond(Instruction * inst)
+{
+    if (inst->getOp() != IRInstOperator::IRINST_OP_COND_BR) {
+        return false;
+    }
+
+    auto condBrInst = static_cast<CondBrInstruction *>(inst);
+    BasicBlock * bb = inst->getParent();
+    BasicBlock * trueBlock = condBrInst->getTrueTarget()->getParent();
+    BasicBlock * falseBlock = condBrInst->getFalseTarget()->getParent();
+
+    if (trueBlock == falseBlock) {
+        return false;
+    }
+
+    // 进入汇合基本块的两条边的源基本块，三角形时其中一个就是分支基本块本身
+    BasicBlock * join;
+    BasicBlock * trueSource = bb;
+    BasicBlock * falseSource = bb;
+    std::vector<BasicBlock *> arms;
+
+    if (isSpeculatableArm(trueBlock, bb, falseBlock)) {
+        join = falseBlock;
+        trueSource = trueBlock;
+    } else if (isSpeculatableArm(falseBlock, bb, trueBlock)) {
+        join = trueBlock;
+        falseSource = falseBlock;
+    } else if (trueBlock->getSuccessors().size() == 1) {
+        join = trueBlock->getSuccessors().front();
+        if (!isSpeculatableArm(trueBlock, bb, join) || !isSpeculatableArm(falseBlock, bb, join)) {
+            return false;
+        }
+        trueSource = trueBlock;
+        falseSource = falseBlock;
+    } else {
+        return false;
+    }
+
+    if (join == bb || join->getPredecessors().size() != 2) {
+        return false;
+    }
+
+    for (auto source: {trueSource, falseSource}) {
+        if (source != bb) {
+            arms.push_back(source);
+        }
+    }
+
+    // 先识别所有的Phi指令，有一个不能识别就放弃
+    std::vector<std::tuple<PhiInstruction *, SelectResult, size_t>> selects;
+
+    for (auto joinInst: join->getInsts()) {
+
+        if (joinInst == join->getLabel()) {
+            continue;
+        }
+        if (joinInst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            break;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(joinInst);
+        if (phi->getIncomingNum() != 2) {
+            return false;
+        }
+
+        int32_t trueNo = phi->getIncomingBlock(0) == trueSource ? 0 : 1;
+        Value * trueVal = phi->getIncomingValue(trueNo);
+        Value * falseVal = phi->getIncomingValue(1 - trueNo);
+
+        size_t k = 0;
+        SelectResult result{};
+        while (k < std::size(selectRules) &&
+               !((this->*selectRules[k].match)(condBrInst->getCondition(), trueVal, falseVal, result) &&
+                 isStable(result.lhs) && isStable(result.rhs))) {
+            k++;
+        }
+
+        if (k == std::size(selectRules)) {
+            return false;
+        }
+
+        selects.emplace_back(phi, result, k);
+    }
+
+    // 分支臂中的运算没有副作用，提前到条件跳转之前
+    for (auto arm: arms) {
+
+        std::vector<Instruction *> armInsts;
+        for (auto armInst: arm->getInsts()) {
+            if (armInst != arm->getLabel() && armInst != arm->getTerminator()) {
+                armInsts.push_back(armInst);
+            }
+        }
+
+        for (auto armInst: armInsts) {
+            arm->erase(armInst);
+            bb->insert(bb->getIterator(inst), armInst);
+        }
+    }
+
+    for (auto & select: selects) {
+
+        PhiInstruction * phi = std::get<0>(select);
+        const SelectResult & result = std::get<1>(select);
+
+        replaceInst(phi, insertBinary(inst, result.op, result.lhs, result.rhs, phi->getType()));
+        selectHits[std::get<2>(select)]++;
+    }
+
+    bb->addInst(func->newInst<GotoInstruction>(static_cast<LabelInstruction *>(join->getLabel())));
+    bb->erase(inst);
+    inst->clearOperands();
+
+    func->removeBasicBlocks(arms);
+
+    return true;
+}
+
+///
+/// @brief 识别最小值、最大值：a<b ? a : b为min(a,b)，a<b ? b : a为max(a,b)，小于等于时同样成立
+/// @param cond 条件
+/// @param trueVal 条件为真时的值
+/// @param falseVal 条件为假时的值
+/// @param result 等价的运算
+/// @return true 识别成功
+///
+bool InstCombine::matchMinMax(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result)
+{
+    auto cmp = dynamic_cast<Instruction *>(cond);
+    if (!cmp || !isComparison(cmp->getOp())) {
+        return false;
+    }
+
+    IRInstOperator op = cmp->getOp();
+    Value * lhs = cmp->getOperand(0);
+    Value * rhs = cmp->getOperand(1);
+
+    if (op == IRInstOperator::IRINST_OP_GT_I || op == IRInstOperator::IRINST_OP_GE_I) {
+        op = swapComparison(op);
+        std::swap(lhs, rhs);
+    }
+
+    if (op != IRInstOperator::IRINST_OP_LT_I && op != IRInstOperator::IRINST_OP_LE_I) {
+        return false;
+    }
+
+    if (trueVal == lhs && falseVal == rhs) {
+        result = {IRInstOperator::IRINST_OP_MIN_I, lhs, rhs};
+        return true;
+    }
+
+    if (trueVal == rhs && falseVal == lhs) {
+        result = {IRInstOperator::IRINST_OP_MAX_I, lhs, rhs};
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 识别绝对值：x<0 ? -x : x以及0<x ? x : -x为abs(x)，小于等于时同样成立
+/// @param cond 条件
+/// @param trueVal 条件为真时的值
+/// @param falseVal 条件为假时的值
+/// @param result 等价的运算
+/// @return true 识别成功
+///
+bool InstCombine::matchAbs(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result)
+{
+    auto cmp = dynamic_cast<Instruction *>(cond);
+    if (!cmp || !isComparison(cmp->getOp())) {
+        return false;
+    }
+
+    IRInstOperator op = cmp->getOp();
+    Value * lhs = cmp->getOperand(0);
+    Value * rhs = cmp->getOperand(1);
+
+    if (op == IRInstOperator::IRINST_OP_GT_I || op == IRInstOperator::IRINST_OP_GE_I) {
+        op = swapComparison(op);
+        std::swap(lhs, rhs);
+    }
+
+    if (op != IRInstOperator::IRINST_OP_LT_I && op != IRInstOperator::IRINST_OP_LE_I) {
+        return false;
+    }
+
+    Value * val = nullptr;
+    if (isConstant(rhs, 0) && falseVal == lhs && getNegated(trueVal) == lhs) {
+        val = lhs;
+    } else if (isConstant(lhs, 0) && trueVal == rhs && getNegated(falseVal) == rhs) {
+        val = rhs;
+    } else {
+        return false;
+    }
+
+    result = {IRInstOperator::IRINST_OP_ABS_I, module->newConstInt(0), val};
+    return true;
+}
+
+///
+/// @brief 识别比较：c ? 1 : 0为c!=0，c ? 0 : 1为c==0，由其它规则进一步化简
+/// @param cond 条件
+/// @param trueVal 条件为真时的值
+/// @param falseVal 条件为假时的值
+/// @param result 等价的运算
+/// @return true 识别成功
+///
+bool InstCombine::matchBool(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result)
+{
+    if (isConstant(trueVal, 1) && isConstant(falseVal, 0)) {
+        result = {IRInstOperator::IRINST_OP_NEQ_I, cond, module->newConstInt(0)};
+        return true;
+    }
+
+    if (isConstant(trueVal, 0) && isConstant(falseVal, 1)) {
+        result = {IRInstOperator::IRINST_OP_EQ_I, cond, module->newConstInt(0)};
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 判断基本块是否为只含可提前计算的运算的分支臂：唯一前驱为from，唯一后继为to。
+/// 可提前计算的运算没有副作用且不会出错，除法与求余可能除以0，不能提前
+/// @param bb 基本块
+/// @param from 分支基本块
+/// @param to 汇合基本块
+/// @return true 是
+///
+bool InstCombine::isSpeculatableArm(BasicBlock * bb, BasicBlock * from, BasicBlock * to)
+{
+    // 提前计算的运算在另一分支上是多余的，只允许很少的几条
+    const int32_t maxInsts = 2;
+
+    if (bb == from || bb == to || bb->getPredecessors().size() != 1 || bb->getPredecessors().front() != from ||
+        bb->getSuccessors().size() != 1 || bb->getSuccessors().front() != to) {
+        return false;
+    }
+
+    Instruction * term = bb->getTerminator();
+    if (!term || term->getOp() != IRInstOperator::IRINST_OP_GOTO) {
+        return false;
+    }
+
+    int32_t count = 0;
+    for (auto inst: bb->getInsts()) {
+
+        if (inst == bb->getLabel() || inst == term) {
+            continue;
+        }
+
+        switch (inst->getOp()) {
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_NEG_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NEQ_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_SHL_I:
+            case IRInstOperator::IRINST_OP_ASHR_I:
+            case IRInstOperator::IRINST_OP_LSHR_I:
+            case IRInstOperator::IRINST_OP_MIN_I:
+            case IRInstOperator::IRINST_OP_MAX_I:
+            case IRInstOperator::IRINST_OP_ABS_I:
+            case IRInstOperator::IRINST_OP_MULH_I:
+                break;
+            default:
+                return false;
+        }
+
+        if (++count > maxInsts) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 在pos之前插入二元运算
+/// @param pos 插入位置
+/// @param op 运算符
+/// @param lhs 左操作数
+/// @param rhs 右操作数
+/// @param type 结果类型
+/// @return Instruction* 新指令
+///
+Instruction * InstCombine::insertBinary(Instruction * pos, IRInstOperator op, Value * lhs, Value * rhs, Type * type)
+{
+    Instruction * inst = func->newInst<BinaryInstruction>(op, lhs, rhs, type);
+
+    BasicBlock * bb = pos->getParent();
+    bb->insert(bb->getIterator(pos), inst);
+
+    return inst;
+}
+
+///
+/// @brief 用值代替指令的所有使用并删除指令
+/// @param inst 指令
+/// @param val 值
+///
+void InstCombine::replaceInst(Instruction * inst, Value * val)
+{
+    inst->replaceAllUsesWith(val);
+    inst->getParent()->erase(inst);
+    inst->clearOperands();
+}
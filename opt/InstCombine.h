@@ -0,0 +1,213 @@
+///
+/// @file InstCombine.h
+/// @brief 指令合并，按规则表对IR进行代数化简与规范化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Pass.h"
+
+class BasicBlock;
+class CondBrInstruction;
+class PhiInstruction;
+
+///
+/// @brief 指令合并（窥孔化简）。按规则表逐条指令尝试改写，直到没有规则命中为止：
+/// 常量操作数规范到右边，0-x规范为求负，消去双重求负，减去负数改为加法，
+/// 比较结果与0比较时直接使用或取反原比较，条件跳转的条件与0比较时直接用原值并按需交换目标，
+/// 乘以2的幂改为左移，除以2的幂改为移位序列，
+/// 只对一个值二选一的菱形或三角形分支识别为最小值、最大值、绝对值或者比较，消去分支。
+/// 新增规则只需实现改写函数并在规则表中登记，每条规则统计命中次数，由--stats输出。
+/// 改写时会把其它指令的操作数移到当前位置使用，只对SSA值与常量进行，变量在两处之间可能被赋值
+///
+class InstCombine final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    InstCombine();
+
+    ///
+    /// @brief 对函数执行指令合并
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 输出每条规则的命中次数
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp) const override;
+
+protected:
+    ///
+    /// @brief 指令改写规则，命中时完成改写并返回true
+    ///
+    using RuleFunc = bool (InstCombine::*)(Instruction * inst);
+
+    ///
+    /// @brief 规则表的表项
+    ///
+    struct Rule {
+
+        /// @brief 规则名，用于统计输出
+        const char * name;
+
+        /// @brief 改写函数
+        RuleFunc apply;
+    };
+
+    ///
+    /// @brief 二选一的结果：op(lhs, rhs)
+    ///
+    struct SelectResult {
+
+        /// @brief 运算符
+        IRInstOperator op;
+
+        /// @brief 左操作数
+        Value * lhs;
+
+        /// @brief 右操作数
+        Value * rhs;
+    };
+
+    ///
+    /// @brief 二选一的识别规则，cond为真时取trueVal，否则取falseVal，识别成功时给出等价的运算
+    ///
+    using SelectFunc = bool (InstCombine::*)(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result);
+
+    ///
+    /// @brief 二选一识别规则表的表项
+    ///
+    struct SelectRule {
+
+        /// @brief 规则名，用于统计输出
+        const char * name;
+
+        /// @brief 识别函数
+        SelectFunc match;
+    };
+
+    ///
+    /// @brief 对所有指令尝试一遍规则
+    /// @return true 函数被修改
+    ///
+    bool combine();
+
+    /// @brief 常量操作数规范到右边：可交换运算交换操作数，比较运算交换操作数并改用对称的比较
+    bool commuteConstantRight(Instruction * inst);
+
+    /// @brief 0-x改为求负
+    bool subZeroToNeg(Instruction * inst);
+
+    /// @brief 双重求负：-(-x)改为x
+    bool doubleNeg(Instruction * inst);
+
+    /// @brief 差的求负：-(a-b)改为b-a
+    bool negOfSub(Instruction * inst);
+
+    /// @brief 减去负数：a-(-b)改为a+b
+    bool subOfNeg(Instruction * inst);
+
+    /// @brief 加上负数：a+(-b)改为a-b，(-a)+b改为b-a
+    bool addOfNeg(Instruction * inst);
+
+    /// @brief 比较结果与0比较：(a<b)!=0改为a<b，(a<b)==0改为a>=b
+    bool compareOfCompare(Instruction * inst);
+
+    /// @brief 条件与0比较的条件跳转：x!=0时直接用x，x==0时用x并交换真假目标
+    bool branchOnCompareZero(Instruction * inst);
+
+    /// @brief 乘以2的幂改为左移，乘以-1改为求负
+    bool mulPowerOfTwo(Instruction * inst);
+
+    /// @brief 除以2的幂改为加上偏置后算术右移，使负数向0取整
+    bool divPowerOfTwo(Instruction * inst);
+
+    /// @brief 消去只对值二选一的菱形或三角形分支
+    bool selectDiamond(Instruction * inst);
+
+    /// @brief 识别最小值、最大值：a<b ? a : b为min(a,b)，a<b ? b : a为max(a,b)
+    bool matchMinMax(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result);
+
+    /// @brief 识别绝对值：x<0 ? -x : x以及0<x ? x : -x为abs(x)
+    bool matchAbs(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result);
+
+    /// @brief 识别比较：c ? 1 : 0为c!=0，c ? 0 : 1为c==0
+    bool matchBool(Value * cond, Value * trueVal, Value * falseVal, SelectResult & result);
+
+    ///
+    /// @brief 判断基本块是否为只含可提前计算的运算的分支臂：唯一前驱为from，唯一后继为to
+    /// @param bb 基本块
+    /// @param from 分支基本块
+    /// @param to 汇合基本块
+    /// @return true 是
+    ///
+    static bool isSpeculatableArm(BasicBlock * bb, BasicBlock * from, BasicBlock * to);
+
+    ///
+    /// @brief 在pos之前插入二元运算
+    /// @param pos 插入位置
+    /// @param op 运算符
+    /// @param lhs 左操作数
+    /// @param rhs 右操作数
+    /// @param type 结果类型
+    /// @return Instruction* 新指令
+    ///
+    Instruction * insertBinary(Instruction * pos, IRInstOperator op, Value * lhs, Value * rhs, Type * type);
+
+    ///
+    /// @brief 用值代替指令的所有使用并删除指令
+    /// @param inst 指令
+    /// @param val 值
+    ///
+    static void replaceInst(Instruction * inst, Value * val);
+
+private:
+    ///
+    /// @brief 指令改写规则表，按顺序尝试，一条指令命中一条规则后处理下一条指令
+    ///
+    static const Rule rules[];
+
+    ///
+    /// @brief 二选一识别规则表
+    ///
+    static const SelectRule selectRules[];
+
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+
+    ///
+    /// @brief 按规则表顺序的命中次数，所有函数累计
+    ///
+    std::vector<int64_t> ruleHits;
+
+    ///
+    /// @brief 按二选一识别规则表顺序的命中次数，所有函数累计
+    ///
+    std::vector<int64_t> selectHits;
+};
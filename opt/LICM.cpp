@@ -0,0 +1,176 @@
+///
+/// @file LICM.cpp
+/// @brief 循环不变量外提
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <vector>
+
+#include "LICM.h"
+#include "LoopInfo.h"
+#include "LoopUtils.h"
+#include "SideEffect.h"
+#include "BinaryInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GlobalVariable.h"
+
+///
+/// @brief 构造函数
+///
+LICM::LICM() : FunctionPass("licm")
+{}
+
+///
+/// @brief 对函数执行循环不变量外提
+/// @param _func 要处理的函数
+/// @param _module 模块，用于副作用分析
+/// @return true 函数被修改
+///
+bool LICM::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+
+    if (func->getBasicBlocks().empty() || func->getLoopInfo()->getLoops().empty()) {
+        return false;
+    }
+
+    int32_t inserted = insertPreheaders(func);
+    preheaderCount += inserted;
+
+    // 其它函数在前面的遍中只会删除对全局变量的赋值，每次重新计算保证结果是保守的
+    SideEffectInfo sideEffects(_module->getFunctionList());
+
+    // 内层循环在前，外提到内层前置基本块的指令在处理外层循环时可以继续外提
+    bool changed = inserted > 0;
+    for (auto loop: func->getLoopInfo()->getLoops()) {
+        changed |= hoistLoop(loop, sideEffects);
+    }
+
+    return changed;
+}
+
+///
+/// @brief 输出插入的前置基本块与外提的指令的个数
+/// @param fp 输出的文件
+///
+void LICM::printStatistics(FILE * fp) const
+{
+    fprintf(fp, "%s:\n", getName().c_str());
+    fprintf(fp, "%12lld  preheaders\n", (long long) preheaderCount);
+    fprintf(fp, "%12lld  hoisted\n", (long long) hoistedCount);
+}
+
+///
+/// @brief 外提一个循环中的不变量到其前置基本块
+/// @param loop 循环
+/// @param sideEffects 副作用分析的结果
+/// @return true 有指令外提
+///
+bool LICM::hoistLoop(Loop * loop, const SideEffectInfo & sideEffects)
+{
+    BasicBlock * preheader = loop->getPreheader();
+    if (!preheader) {
+        return false;
+    }
+
+    writtenVars.clear();
+    for (auto bb: loop->getBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                writtenVars.insert(inst->getOperand(0));
+            } else if (inst->getOp() == IRInstOperator::IRINST_OP_FUNC_CALL) {
+                Function * callee = static_cast<FuncCallInstruction *>(inst)->calledFunction;
+                const auto & globals = sideEffects.getWrittenGlobals(callee);
+                writtenVars.insert(globals.begin(), globals.end());
+            }
+        }
+    }
+
+    Instruction * branch = preheader->getTerminator();
+    bool changed = false;
+
+    // 按布局顺序扫描，同一基本块内前面的指令外提后，后面使用它的指令随之成为不变量；
+    // 使用的指令在后面的基本块中时，等它外提后的下一轮再外提
+    bool hoisted = true;
+    while (hoisted) {
+
+        hoisted = false;
+        for (auto bb: loop->getBlocks()) {
+
+            std::vector<Instruction *> insts(bb->begin(), bb->end());
+            for (auto inst: insts) {
+                if (isHoistable(loop, inst)) {
+                    bb->erase(inst);
+                    preheader->insert(preheader->getIterator(branch), inst);
+                    hoistedCount++;
+                    hoisted = true;
+                }
+            }
+        }
+
+        changed |= hoisted;
+    }
+
+    return changed;
+}
+
+///
+/// @brief 判断值在循环内是否不变
+/// @param loop 循环
+/// @param val 值
+/// @return true 不变
+///
+bool LICM::isInvariant(Loop * loop, Value * val) const
+{
+    if (dynamic_cast<ConstInt *>(val)) {
+        return true;
+    }
+
+    if (auto inst = dynamic_cast<Instruction *>(val)) {
+        return !loop->contains(inst->getParent());
+    }
+
+    if (dynamic_cast<GlobalVariable *>(val) || dynamic_cast<LocalVariable *>(val)) {
+        return writtenVars.count(val) == 0;
+    }
+
+    return false;
+}
+
+///
+/// @brief 判断指令是否可以外提：没有副作用的二元运算，且操作数都是循环不变量
+/// @param loop 循环
+/// @param inst 指令
+/// @return true 可以外提
+///
+bool LICM::isHoistable(Loop * loop, Instruction * inst) const
+{
+    if (!dynamic_cast<BinaryInstruction *>(inst)) {
+        return false;
+    }
+
+    // 除数可能为0时，提前到循环一次也不执行的路径上计算会改变程序的行为
+    if (inst->getOp() == IRInstOperator::IRINST_OP_DIV_I || inst->getOp() == IRInstOperator::IRINST_OP_MOD_I) {
+        auto divisor = dynamic_cast<ConstInt *>(inst->getOperand(1));
+        if (!divisor || divisor->getVal() == 0) {
+            return false;
+        }
+    }
+
+    for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+        if (!isInvariant(loop, inst->getOperand(k))) {
+            return false;
+        }
+    }
+
+    return true;
+}
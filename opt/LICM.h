@@ -0,0 +1,102 @@
+///
+/// @file LICM.h
+/// @brief 循环不变量外提
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+
+#include "Pass.h"
+
+class Loop;
+class SideEffectInfo;
+
+///
+/// @brief 循环不变量外提。先为每个循环插入前置基本块，再由内向外处理各层循环，
+/// 把操作数都是循环不变量的二元运算移到前置基本块中，每次进入循环只计算一次。
+/// 循环不变量为常量、定义在循环外的指令，以及循环内没有被赋值的全局变量与局部变量。
+/// IR中全局变量作为操作数直接使用，读取全局变量的运算外提后，对全局变量的读取也随之外提；
+/// 循环内的函数调用按副作用分析的结果只使其可能修改的全局变量不再是不变量。
+/// 二元运算没有副作用，即使所在的基本块不是每次迭代都执行，或者循环一次也不执行，提前计算也是安全的；
+/// 只有除法与求余在除数可能为0时不外提
+///
+class LICM final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    LICM();
+
+    ///
+    /// @brief 对函数执行循环不变量外提
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于副作用分析
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 输出插入的前置基本块与外提的指令的个数
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp) const override;
+
+protected:
+    ///
+    /// @brief 外提一个循环中的不变量到其前置基本块
+    /// @param loop 循环
+    /// @param sideEffects 副作用分析的结果
+    /// @return true 有指令外提
+    ///
+    bool hoistLoop(Loop * loop, const SideEffectInfo & sideEffects);
+
+    ///
+    /// @brief 判断值在循环内是否不变
+    /// @param loop 循环
+    /// @param val 值
+    /// @return true 不变
+    ///
+    bool isInvariant(Loop * loop, Value * val) const;
+
+    ///
+    /// @brief 判断指令是否可以外提：没有副作用的二元运算，且操作数都是循环不变量
+    /// @param loop 循环
+    /// @param inst 指令
+    /// @return true 可以外提
+    ///
+    bool isHoistable(Loop * loop, Instruction * inst) const;
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 当前循环内被赋值的全局变量与局部变量，含调用的函数可能修改的全局变量
+    ///
+    std::unordered_set<Value *> writtenVars;
+
+    ///
+    /// @brief 插入的前置基本块个数，所有函数累计
+    ///
+    int64_t preheaderCount = 0;
+
+    ///
+    /// @brief 外提的指令个数，所有函数累计
+    ///
+    int64_t hoistedCount = 0;
+};
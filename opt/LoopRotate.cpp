@@ -0,0 +1,260 @@
+///
+/// @file LoopRotate.cpp
+/// @brief 循环旋转，while形状的循环改为带入口检查的do-while形状
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <iterator>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+#include "LoopRotate.h"
+#include "LoopInfo.h"
+#include "LoopUtils.h"
+#include "BinaryInstruction.h"
+#include "CondBrInstruction.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 循环头中除Phi指令与跳转指令外的运算条数上限，旋转时复制两份
+///
+static const int32_t maxHeaderSize = 8;
+
+///
+/// @brief 把循环头的运算与条件跳转复制到基本块的末尾，代替其原来的无条件跳转。
+/// 条件跳转进入循环体的目标改为循环头，循环头此后顺序进入循环体
+/// @param func 函数
+/// @param bb 前置基本块或者latch
+/// @param header 循环头
+/// @param bodyLabel 循环体的入口
+/// @param valueMap 值的映射，调用前含有循环头Phi指令在bb末尾的值
+///
+static void cloneHeaderInto(Function * func,
+                            BasicBlock * bb,
+                            BasicBlock * header,
+                            LabelInstruction * bodyLabel,
+                            std::unordered_map<Value *, Value *> & valueMap)
+{
+    std::vector<Instruction *> insts = cloneBlocks(func, {header}, valueMap);
+
+    auto condBr = static_cast<CondBrInstruction *>(insts.back());
+    auto headerLabel = static_cast<LabelInstruction *>(header->getLabel());
+    if (condBr->getTrueTarget() == bodyLabel) {
+        condBr->setTrueTarget(headerLabel);
+    } else {
+        condBr->setFalseTarget(headerLabel);
+    }
+
+    // 复制出的Label不需要
+    bb->erase(bb->getTerminator());
+    for (size_t k = 1; k < insts.size(); ++k) {
+        bb->addInst(insts[k]);
+    }
+}
+
+///
+/// @brief 构造函数
+///
+LoopRotate::LoopRotate() : FunctionPass("rotate")
+{}
+
+///
+/// @brief 对函数执行循环旋转
+/// @param _func 要处理的函数
+/// @param _module 模块
+/// @return true 函数被修改
+///
+bool LoopRotate::runOnFunction(Function * _func, Module * _module)
+{
+    (void) _module;
+
+    func = _func;
+    visited.clear();
+
+    if (func->getBasicBlocks().empty() || func->getLoopInfo()->getLoops().empty()) {
+        return false;
+    }
+
+    bool changed = insertPreheaders(func) > 0;
+    changed |= insertDedicatedExits(func) > 0;
+
+    // 每旋转一个循环都会重新划分基本块，循环信息随之重新计算，循环头的Label保持不变
+    bool rotated = true;
+    while (rotated) {
+
+        rotated = false;
+        for (auto loop: func->getLoopInfo()->getLoops()) {
+
+            Instruction * label = loop->getHeader()->getLabel();
+            if (visited.count(label)) {
+                continue;
+            }
+
+            visited.insert(label);
+            if (rotateLoop(loop)) {
+                rotated = changed = true;
+                break;
+            }
+        }
+    }
+
+    // 旋转后循环头只以无条件跳转顺序进入循环体，二者合并，省去只有Phi指令与跳转的空基本块
+    if (changed) {
+        mergedBlocks += mergeStraightLineBlocks(func);
+    }
+
+    return changed;
+}
+
+///
+/// @brief 输出旋转的循环个数与合并的基本块个数
+/// @param fp 输出的文件
+///
+void LoopRotate::printStatistics(FILE * fp) const
+{
+    fprintf(fp, "%s:\n", getName().c_str());
+    fprintf(fp, "%12lld  rotated\n", (long long) rotatedCount);
+    fprintf(fp, "%12lld  blocks-merged\n", (long long) mergedBlocks);
+}
+
+///
+/// @brief 旋转一个循环
+/// @param loop 循环
+/// @return true 旋转了循环，之前取得的基本块与循环信息都失效
+///
+bool LoopRotate::rotateLoop(Loop * loop)
+{
+    if (!isRotatable(loop)) {
+        return false;
+    }
+
+    BasicBlock * header = loop->getHeader();
+    BasicBlock * preheader = loop->getPreheader();
+    BasicBlock * latch = loop->getLatch();
+    BasicBlock * exit = loop->getExitBlocks().front();
+
+    auto condBr = static_cast<CondBrInstruction *>(header->getTerminator());
+    LabelInstruction * bodyLabel = loop->contains(condBr->getTrueTarget()->getParent()) ? condBr->getTrueTarget()
+                                                                                        : condBr->getFalseTarget();
+
+    // 入口检查取进入循环时的值，latch中的检查取下一次迭代的值
+    std::unordered_map<Value *, Value *> guardMap;
+    std::unordered_map<Value *, Value *> latchMap;
+    for (auto inst: header->getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            auto phi = static_cast<PhiInstruction *>(inst);
+            guardMap[phi] = phi->getIncomingValueForBlock(preheader);
+            latchMap[phi] = phi->getIncomingValueForBlock(latch);
+        }
+    }
+
+    cloneHeaderInto(func, preheader, header, bodyLabel, guardMap);
+    cloneHeaderInto(func, latch, header, bodyLabel, latchMap);
+
+    header->erase(condBr);
+    condBr->clearOperands();
+    header->addInst(func->newInst<GotoInstruction>(bodyLabel));
+
+    // 出口的前驱由循环头变为前置基本块与latch，原有Phi指令来自循环头的来源先取出，
+    // 新的来源是循环内的值，不能被下面循环外使用的替换改写
+    std::vector<std::pair<PhiInstruction *, Value *>> exitIncoming;
+    for (auto inst: exit->getInsts()) {
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            continue;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(inst);
+        for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+            if (phi->getIncomingLabel(k) == header->getLabel()) {
+                exitIncoming.emplace_back(phi, phi->getIncomingValue(k));
+                phi->removeIncoming(k);
+                break;
+            }
+        }
+    }
+
+    // 循环外使用的循环头中的值，在出口处用Phi指令汇合两份复制
+    std::vector<std::pair<Instruction *, PhiInstruction *>> exitPhis;
+    for (auto inst: header->getInsts()) {
+        if (inst->hasResultValue()) {
+            auto phi = func->newInst<PhiInstruction>(inst->getType());
+            if (replaceUsesOutside(loop, inst, phi)) {
+                exitPhis.emplace_back(inst, phi);
+            }
+        }
+    }
+
+    auto pos = std::next(exit->begin());
+    for (auto & item: exitPhis) {
+        item.second->addIncoming(mapValue(guardMap, item.first), preheader);
+        item.second->addIncoming(mapValue(latchMap, item.first), latch);
+        exit->insert(pos, item.second);
+    }
+
+    for (auto & item: exitIncoming) {
+        item.first->addIncoming(mapValue(guardMap, item.second), preheader);
+        item.first->addIncoming(mapValue(latchMap, item.second), latch);
+    }
+
+    rotatedCount++;
+    func->buildCFG();
+
+    return true;
+}
+
+///
+/// @brief 判断循环是否为可以旋转的while形状
+/// @param loop 循环
+/// @return true 可以旋转
+///
+bool LoopRotate::isRotatable(Loop * loop)
+{
+    BasicBlock * header = loop->getHeader();
+    BasicBlock * preheader = loop->getPreheader();
+    BasicBlock * latch = loop->getLatch();
+
+    // 循环头同时是latch时已经是do-while形状
+    if (!preheader || !latch || latch == header) {
+        return false;
+    }
+
+    if (loop->getExitingBlocks().size() != 1 || loop->getExitingBlocks().front() != header) {
+        return false;
+    }
+
+    if (loop->getExitBlocks().size() != 1 || loop->getExitBlocks().front()->getPredecessors().size() != 1) {
+        return false;
+    }
+
+    if (header->getTerminator()->getOp() != IRInstOperator::IRINST_OP_COND_BR ||
+        latch->getTerminator()->getOp() != IRInstOperator::IRINST_OP_GOTO ||
+        preheader->getTerminator()->getOp() != IRInstOperator::IRINST_OP_GOTO) {
+        return false;
+    }
+
+    // 循环头的运算在入口检查与latch中各复制一份，循环头中原来的仍然执行，不能有副作用
+    int32_t size = 0;
+    for (auto inst: header->getInsts()) {
+        if (inst == header->getLabel() || inst == header->getTerminator() ||
+            inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            continue;
+        }
+
+        if (!dynamic_cast<BinaryInstruction *>(inst) || ++size > maxHeaderSize) {
+            return false;
+        }
+    }
+
+    return true;
+}
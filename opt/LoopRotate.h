@@ -0,0 +1,93 @@
+///
+/// @file LoopRotate.h
+/// @brief 循环旋转，while形状的循环改为带入口检查的do-while形状
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_set>
+
+#include "Pass.h"
+
+class Loop;
+
+///
+/// @brief 循环旋转。while语句翻译出的循环在循环头判断条件、在latch无条件跳回循环头，
+/// 每次迭代执行一次条件跳转与一次无条件跳转。旋转后：
+/// 前置基本块中复制一份循环头的运算作为入口检查，条件不成立时直接跳到出口；
+/// latch中再复制一份，以下一次迭代的值计算条件，成立时跳回循环头，否则离开循环；
+/// 循环头的条件跳转改为顺序进入循环体，随后与循环体合并。每次迭代只在latch执行一次条件跳转。
+/// 循环头原来的运算仍然保留，供循环体使用，只用于条件跳转的比较由死代码删除负责删除；
+/// 循环外使用的循环头中的值改为出口处新建的Phi指令，汇合入口检查与latch的两份复制。
+/// 先为循环插入前置基本块与专用的出口基本块，要求循环有唯一的latch，唯一的出口在循环头，
+/// 循环头除Phi指令外只有没有副作用的二元运算，且条数不超过上限
+///
+class LoopRotate final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    LoopRotate();
+
+    ///
+    /// @brief 对函数执行循环旋转
+    /// @param _func 要处理的函数
+    /// @param _module 模块
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 输出旋转的循环个数与合并的基本块个数
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp) const override;
+
+protected:
+    ///
+    /// @brief 旋转一个循环
+    /// @param loop 循环
+    /// @return true 旋转了循环，之前取得的基本块与循环信息都失效
+    ///
+    bool rotateLoop(Loop * loop);
+
+    ///
+    /// @brief 判断循环是否为可以旋转的while形状
+    /// @param loop 循环
+    /// @return true 可以旋转
+    ///
+    static bool isRotatable(Loop * loop);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 已经处理过的循环头的Label
+    ///
+    std::unordered_set<Instruction *> visited;
+
+    ///
+    /// @brief 旋转的循环个数，所有函数累计
+    ///
+    int64_t rotatedCount = 0;
+
+    ///
+    /// @brief 旋转后合并进前一基本块的基本块个数，所有函数累计
+    ///
+    int64_t mergedBlocks = 0;
+};
@@ -0,0 +1,518 @@
+///
+/// @file LoopUnroll.cpp
+/// @brief 循环展开，迭代次数已知的小循环完全展开，其余按因子部分展开并保留余数循环
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <limits>
+
+#include "LoopUnroll.h"
+#include "InductionVariable.h"
+#include "LoopInfo.h"
+#include "LoopUtils.h"
+#include "BinaryInstruction.h"
+#include "CondBrInstruction.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+#include "IntegerType.h"
+
+///
+/// @brief -O2时完全展开后的指令条数上限
+///
+static const int64_t fullUnrollBudget = 160;
+
+///
+/// @brief -O2时自动选择的部分展开的因子
+///
+static const int32_t defaultUnrollCount = 4;
+
+///
+/// @brief -O2时自动选择因子，主循环的指令条数上限
+///
+static const int32_t partialUnrollBudget = 80;
+
+///
+/// @brief 判断64位的值是否在int32的范围内
+/// @param val 值
+/// @return true 在范围内
+///
+static bool fitsInt32(int64_t val)
+{
+    return val >= std::numeric_limits<int32_t>::min() && val <= std::numeric_limits<int32_t>::max();
+}
+
+///
+/// @brief 获取循环头的条件跳转在循环内或者循环外的目标
+/// @param loop 循环
+/// @param inside true 循环内的目标，false 循环外的目标
+/// @return LabelInstruction* 跳转目标
+///
+static LabelInstruction * getHeaderTarget(Loop * loop, bool inside)
+{
+    auto condBr = static_cast<CondBrInstruction *>(loop->getHeader()->getTerminator());
+    bool trueInside = loop->contains(condBr->getTrueTarget()->getParent());
+    return trueInside == inside ? condBr->getTrueTarget() : condBr->getFalseTarget();
+}
+
+///
+/// @brief 把复制出的指令中的old替换为newInst，并解除old对操作数的使用
+/// @param insts 复制出的指令
+/// @param old 要替换的指令
+/// @param newInst 新指令
+///
+static void replaceClone(std::vector<Instruction *> & insts, Instruction * old, Instruction * newInst)
+{
+    std::replace(insts.begin(), insts.end(), old, newInst);
+    old->clearOperands();
+}
+
+///
+/// @brief 构造函数
+///
+LoopUnroll::LoopUnroll() : FunctionPass("unroll")
+{}
+
+///
+/// @brief 设置部分展开的因子，0表示按循环大小自动选择，1表示不做部分展开
+/// @param _count 展开因子
+///
+void LoopUnroll::setCount(int32_t _count)
+{
+    count = _count;
+}
+
+///
+/// @brief 设置是否以代码大小优先，即-Os，此时只做不增大代码的完全展开
+/// @param _forSize 是否以代码大小优先
+///
+void LoopUnroll::setForSize(bool _forSize)
+{
+    forSize = _forSize;
+}
+
+///
+/// @brief 设置是否对界限不是常量的循环做部分展开，即运行时计算主循环的界限
+/// @param _runtime 是否做运行时的部分展开
+///
+void LoopUnroll::setRuntime(bool _runtime)
+{
+    runtime = _runtime;
+}
+
+///
+/// @brief 对函数执行循环展开
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool LoopUnroll::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+    visited.clear();
+
+    if (func->getBasicBlocks().empty() || func->getLoopInfo()->getLoops().empty()) {
+        return false;
+    }
+
+    bool changed = insertPreheaders(func) > 0;
+
+    // 每展开一个循环都会重新划分基本块，循环信息随之重新计算；
+    // 内层循环完全展开后，外层循环成为最内层循环，可以继续展开
+    bool unrolled = true;
+    while (unrolled) {
+
+        unrolled = false;
+        for (auto loop: func->getLoopInfo()->getLoops()) {
+
+            Instruction * label = loop->getHeader()->getLabel();
+            if (!loop->getSubLoops().empty() || visited.count(label)) {
+                continue;
+            }
+
+            visited.insert(label);
+            if (unrollLoop(loop)) {
+                unrolled = changed = true;
+                break;
+            }
+        }
+    }
+
+    // 复制出的循环头只剩跳转，与前后的基本块直线相连，合并后不再生成只有跳转的Label
+    if (changed) {
+        mergedBlocks += mergeStraightLineBlocks(func);
+    }
+
+    return changed;
+}
+
+///
+/// @brief 输出完全展开与部分展开的循环个数
+/// @param fp 输出的文件
+///
+void LoopUnroll::printStatistics(FILE * fp) const
+{
+    fprintf(fp, "%s:\n", getName().c_str());
+    fprintf(fp, "%12lld  fully-unrolled\n", (long long) fullCount);
+    fprintf(fp, "%12lld  partially-unrolled\n", (long long) partialCount);
+    fprintf(fp, "%12lld  runtime-guarded\n", (long long) runtimeCount);
+    fprintf(fp, "%12lld  skipped-pressure\n", (long long) pressureSkips);
+    fprintf(fp, "%12lld  blocks-merged\n", (long long) mergedBlocks);
+}
+
+///
+/// @brief 按大小选择展开的方式并展开一个循环
+/// @param loop 最内层循环
+/// @return true 展开了循环，之前取得的基本块与循环信息都失效
+///
+bool LoopUnroll::unrollLoop(Loop * loop)
+{
+    InductionVariableInfo info(loop);
+
+    // 出口在latch时isExitAtLatch为真，循环头同时是latch的情况也在其中
+    if (!info.getExitCompare() || info.isExitAtLatch() || info.isExitOnNext()) {
+        return false;
+    }
+
+    if (loop->getLatch()->getTerminator()->getOp() != IRInstOperator::IRINST_OP_GOTO) {
+        return false;
+    }
+
+    int64_t size = getLoopSize(loop);
+
+    // -Os时展开后的大小不能超过原来的循环
+    if (info.hasTripCount() && info.getTripCount() * size <= (forSize ? size : fullUnrollBudget)) {
+        fullyUnroll(info);
+        fullCount++;
+        return true;
+    }
+
+    if (forSize) {
+        return false;
+    }
+
+    // 界限不是常量时需要在运行时计算主循环的界限，默认不做
+    if (!runtime && !dynamic_cast<ConstInt *>(info.getExitBound())) {
+        return false;
+    }
+
+    int32_t factor = count;
+    if (factor == 0) {
+
+        // 寄存器压力已达上限时，展开后相邻迭代合并的值延长了活跃范围，只会带来更多的溢出
+        if (getMaxLiveValues(func, loop) >= loopRegisterLimit) {
+            pressureSkips++;
+            return false;
+        }
+
+        factor = (int32_t) std::min<int64_t>(defaultUnrollCount, partialUnrollBudget / size);
+    }
+
+    // 迭代次数不足一次主循环时展开没有收益
+    if (factor < 2 || (info.hasTripCount() && info.getTripCount() < factor)) {
+        return false;
+    }
+
+    if (!partiallyUnroll(info, factor)) {
+        return false;
+    }
+
+    partialCount++;
+    return true;
+}
+
+///
+/// @brief 完全展开循环
+/// @param info 循环的归纳变量信息，迭代次数已知
+///
+void LoopUnroll::fullyUnroll(const InductionVariableInfo & info)
+{
+    Loop * loop = info.getLoop();
+    BasicBlock * header = loop->getHeader();
+    BasicBlock * preheader = loop->getPreheader();
+    BasicBlock * latch = loop->getLatch();
+
+    // 第一次迭代的循环头Phi指令取进入循环时的值
+    std::unordered_map<Value *, Value *> valueMap;
+    for (auto inst: header->getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            valueMap[inst] = static_cast<PhiInstruction *>(inst)->getIncomingValueForBlock(preheader);
+        }
+    }
+
+    std::vector<Instruction *> unrolled;
+    GotoInstruction * backEdge = nullptr;
+
+    for (int64_t k = 0; k < info.getTripCount(); ++k) {
+
+        std::vector<Instruction *> insts = cloneIteration(loop, valueMap);
+        if (backEdge) {
+            backEdge->setTarget(static_cast<LabelInstruction *>(insts.front()));
+        }
+
+        unrolled.insert(unrolled.end(), insts.begin(), insts.end());
+        backEdge = static_cast<GotoInstruction *>(valueMap[latch->getTerminator()]);
+        valueMap = nextIteration(loop, valueMap);
+    }
+
+    // 最后一次执行循环头时比较不成立，离开循环
+    std::vector<Instruction *> exitInsts = cloneBlocks(func, {header}, valueMap);
+    auto exitLabel = static_cast<LabelInstruction *>(exitInsts.front());
+    replaceClone(exitInsts,
+                 static_cast<Instruction *>(valueMap[header->getTerminator()]),
+                 func->newInst<GotoInstruction>(getHeaderTarget(loop, false)));
+
+    if (backEdge) {
+        backEdge->setTarget(exitLabel);
+    }
+    unrolled.insert(unrolled.end(), exitInsts.begin(), exitInsts.end());
+
+    // 出口唯一且在循环头，循环外只能使用循环头中定义的值，改为使用最后一份复制
+    for (auto inst: header->getInsts()) {
+        if (inst->hasResultValue()) {
+            replaceUsesOutside(loop, inst, mapValue(valueMap, inst));
+        }
+    }
+
+    for (auto exit: loop->getExitBlocks()) {
+        for (auto inst: exit->getInsts()) {
+            if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                continue;
+            }
+
+            auto phi = static_cast<PhiInstruction *>(inst);
+            for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+                if (phi->getIncomingLabel(k) == header->getLabel()) {
+                    Value * val = phi->getIncomingValue(k);
+                    phi->removeIncoming(k);
+                    phi->addIncoming(val, exitLabel);
+                    break;
+                }
+            }
+        }
+    }
+
+    static_cast<GotoInstruction *>(preheader->getTerminator())
+        ->setTarget(static_cast<LabelInstruction *>(unrolled.front()));
+
+    InstList & list = func->getInterCode().getInsts();
+    InstList::iterator pos = list.getIterator(header->getLabel());
+    for (auto inst: unrolled) {
+        list.insert(pos, inst);
+    }
+
+    std::vector<BasicBlock *> loopBlocks = loop->getBlocks();
+    func->removeBasicBlocks(loopBlocks);
+}
+
+///
+/// @brief 按因子部分展开循环，原来的循环作为余数循环
+/// @param info 循环的归纳变量信息
+/// @param factor 展开因子
+/// @return true 展开了循环
+///
+bool LoopUnroll::partiallyUnroll(const InductionVariableInfo & info, int32_t factor)
+{
+    Loop * loop = info.getLoop();
+    BasicBlock * header = loop->getHeader();
+    BasicBlock * preheader = loop->getPreheader();
+    BasicBlock * latch = loop->getLatch();
+    const InductionVariable * iv = info.getExitVariable();
+    IRInstOperator op = info.getExitPredicate();
+
+    // 只处理归纳变量单调地逼近界限的比较
+    bool up = op == IRInstOperator::IRINST_OP_LT_I || op == IRInstOperator::IRINST_OP_LE_I;
+    bool down = op == IRInstOperator::IRINST_OP_GT_I || op == IRInstOperator::IRINST_OP_GE_I;
+    if (!(up && iv->step > 0) && !(down && iv->step < 0)) {
+        return false;
+    }
+
+    // iv op bound - delta成立时，iv到iv + delta的factor个值都满足比较且不会溢出。
+    // bound - delta不超出int32的条件为：递增时bound >= INT32_MIN + delta，递减时bound <= INT32_MAX + delta
+    int64_t delta = (int64_t) (factor - 1) * iv->step;
+    int64_t guard = delta + (up ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max());
+    if (!fitsInt32(delta) || !fitsInt32(guard)) {
+        return false;
+    }
+
+    Value * bound = info.getExitBound();
+    Instruction * branch = preheader->getTerminator();
+    Value * limit;
+    Instruction * guardCmp = nullptr;
+
+    if (auto boundConst = dynamic_cast<ConstInt *>(bound)) {
+        int64_t val = boundConst->getVal() - delta;
+        if (!fitsInt32(val)) {
+            return false;
+        }
+        limit = module->newConstInt((int32_t) val);
+    } else {
+        Instruction * sub = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_SUB_I,
+                                                             bound,
+                                                             module->newConstInt((int32_t) delta),
+                                                             bound->getType());
+        preheader->insert(preheader->getIterator(branch), sub);
+        limit = sub;
+
+        IRInstOperator guardOp = up ? IRInstOperator::IRINST_OP_GE_I : IRInstOperator::IRINST_OP_LE_I;
+        guardCmp = func->newInst<BinaryInstruction>(guardOp,
+                                                    bound,
+                                                    module->newConstInt((int32_t) guard),
+                                                    IntegerType::getTypeBool());
+        preheader->insert(preheader->getIterator(branch), guardCmp);
+        runtimeCount++;
+    }
+
+    // 主循环头：Phi指令从前置基本块取进入循环时的值，从主循环的latch取factor次迭代之后的值
+    auto mainLabel = func->newInst<LabelInstruction>();
+    std::vector<Instruction *> mainLoop{mainLabel};
+    std::vector<PhiInstruction *> phis;
+    std::vector<PhiInstruction *> mainPhis;
+    std::unordered_map<Value *, Value *> valueMap;
+
+    for (auto inst: header->getInsts()) {
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            continue;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(inst);
+        auto mainPhi = func->newInst<PhiInstruction>(phi->getType());
+        mainPhi->addIncoming(phi->getIncomingValueForBlock(preheader), preheader);
+        mainLoop.push_back(mainPhi);
+        phis.push_back(phi);
+        mainPhis.push_back(mainPhi);
+        valueMap[phi] = mainPhi;
+    }
+
+    auto mainCmp = func->newInst<BinaryInstruction>(op, valueMap[iv->phi], limit, IntegerType::getTypeBool());
+    mainLoop.push_back(mainCmp);
+
+    std::vector<Instruction *> body;
+    GotoInstruction * backEdge = nullptr;
+    Instruction * mainLatch = nullptr;
+
+    for (int32_t k = 0; k < factor; ++k) {
+
+        std::vector<Instruction *> insts = cloneIteration(loop, valueMap);
+        if (backEdge) {
+            backEdge->setTarget(static_cast<LabelInstruction *>(insts.front()));
+        }
+
+        body.insert(body.end(), insts.begin(), insts.end());
+        backEdge = static_cast<GotoInstruction *>(valueMap[latch->getTerminator()]);
+        mainLatch = static_cast<Instruction *>(valueMap[latch->getLabel()]);
+        valueMap = nextIteration(loop, valueMap);
+    }
+
+    backEdge->setTarget(mainLabel);
+    for (size_t k = 0; k < phis.size(); ++k) {
+        mainPhis[k]->addIncoming(valueMap[phis[k]], mainLatch);
+    }
+
+    mainLoop.push_back(func->newInst<CondBrInstruction>(mainCmp,
+                                                        static_cast<LabelInstruction *>(body.front()),
+                                                        static_cast<LabelInstruction *>(header->getLabel())));
+    mainLoop.insert(mainLoop.end(), body.begin(), body.end());
+
+    // 余数循环从主循环头进入；需要运行时检查时，检查不通过也从前置基本块直接进入
+    for (size_t k = 0; k < phis.size(); ++k) {
+        if (!guardCmp) {
+            for (int32_t j = 0; j < phis[k]->getIncomingNum(); ++j) {
+                if (phis[k]->getIncomingLabel(j) == preheader->getLabel()) {
+                    phis[k]->removeIncoming(j);
+                    break;
+                }
+            }
+        }
+        phis[k]->addIncoming(mainPhis[k], mainLabel);
+    }
+
+    if (guardCmp) {
+        preheader->erase(branch);
+        preheader->addInst(
+            func->newInst<CondBrInstruction>(guardCmp, mainLabel, static_cast<LabelInstruction *>(header->getLabel())));
+    } else {
+        static_cast<GotoInstruction *>(branch)->setTarget(mainLabel);
+    }
+
+    InstList & list = func->getInterCode().getInsts();
+    InstList::iterator pos = list.getIterator(header->getLabel());
+    for (auto inst: mainLoop) {
+        list.insert(pos, inst);
+    }
+
+    visited.insert(mainLabel);
+    func->buildCFG();
+
+    return true;
+}
+
+///
+/// @brief 复制一次迭代：循环头与循环体的所有基本块，循环头的条件跳转改为直接进入循环体
+/// @param loop 循环
+/// @param valueMap 值的映射，调用前含有循环头Phi指令在本次迭代的值
+/// @return std::vector<Instruction *> 复制出的指令
+///
+std::vector<Instruction *> LoopUnroll::cloneIteration(Loop * loop, std::unordered_map<Value *, Value *> & valueMap)
+{
+    std::vector<Instruction *> insts = cloneBlocks(func, loop->getBlocks(), valueMap);
+
+    auto bodyLabel = static_cast<LabelInstruction *>(valueMap[getHeaderTarget(loop, true)]);
+    replaceClone(insts,
+                 static_cast<Instruction *>(valueMap[loop->getHeader()->getTerminator()]),
+                 func->newInst<GotoInstruction>(bodyLabel));
+
+    return insts;
+}
+
+///
+/// @brief 由本次迭代的值映射得到下一次迭代循环头Phi指令的值
+/// @param loop 循环
+/// @param valueMap 本次迭代的值映射
+/// @return std::unordered_map<Value *, Value *> 下一次迭代的值映射
+///
+std::unordered_map<Value *, Value *> LoopUnroll::nextIteration(Loop * loop,
+                                                               const std::unordered_map<Value *, Value *> & valueMap)
+{
+    BasicBlock * header = loop->getHeader();
+    BasicBlock * latch = loop->getLatch();
+
+    std::unordered_map<Value *, Value *> nextMap;
+    for (auto inst: header->getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            Value * val = static_cast<PhiInstruction *>(inst)->getIncomingValueForBlock(latch);
+            nextMap[inst] = mapValue(valueMap, val);
+        }
+    }
+
+    return nextMap;
+}
+
+///
+/// @brief 计算循环的大小，即Label与Phi指令以外的指令条数
+/// @param loop 循环
+/// @return int32_t 指令条数
+///
+int32_t LoopUnroll::getLoopSize(Loop * loop)
+{
+    int32_t size = 0;
+    for (auto bb: loop->getBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            if (inst != bb->getLabel() && inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                size++;
+            }
+        }
+    }
+
+    return size;
+}
@@ -0,0 +1,186 @@
+///
+/// @file LoopUnroll.h
+/// @brief 循环展开，迭代次数已知的小循环完全展开，其余按因子部分展开并保留余数循环
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Pass.h"
+
+class Loop;
+class InductionVariableInfo;
+
+///
+/// @brief 循环展开。只处理最内层的while形状的循环：有前置基本块与唯一的latch，
+/// 唯一的出口在循环头，出口条件为基本归纳变量的Phi指令与循环不变量的比较。
+/// 每次迭代的比较、条件跳转与回跳的无条件跳转在展开后只执行一次或者不再执行，
+/// 相邻迭代的运算也能被后面的值编号合并。
+/// (1) 完全展开：迭代次数已知且展开后的大小不超过预算时，把循环头与循环体按迭代次数依次复制，
+/// 最后再复制一次循环头用于计算出口处的值，删除原来的循环；
+/// (2) 部分展开：按因子factor复制出主循环，每次执行factor次迭代，只在主循环头比较一次，
+/// 条件为归纳变量的第factor - 1次递推仍满足出口条件；主循环不满足时转入原来的循环，
+/// 由它作为余数循环执行剩余的迭代。界限不是常量时在前置基本块中计算主循环的界限，
+/// 并检查计算不会溢出，会溢出时直接进入余数循环；这种运行时的部分展开默认不做，需要setRuntime打开。
+/// 自动选择因子时，寄存器压力已达上限的循环不做部分展开，复制的迭代只会带来更多的溢出。
+/// 展开后合并复制出的直线相连的基本块。
+/// 标准序列只在-O2与-Os时加入：-O2按预算展开；-Os时只做不增大代码的完全展开，
+/// 即迭代次数不超过1的循环，不做部分展开；-O1不展开
+///
+class LoopUnroll final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    LoopUnroll();
+
+    ///
+    /// @brief 设置部分展开的因子，0表示按循环大小自动选择，1表示不做部分展开
+    /// @param _count 展开因子
+    ///
+    void setCount(int32_t _count);
+
+    ///
+    /// @brief 设置是否以代码大小优先，即-Os，此时只做不增大代码的完全展开
+    /// @param _forSize 是否以代码大小优先
+    ///
+    void setForSize(bool _forSize);
+
+    ///
+    /// @brief 设置是否对界限不是常量的循环做部分展开，即运行时计算主循环的界限
+    /// @param _runtime 是否做运行时的部分展开
+    ///
+    void setRuntime(bool _runtime);
+
+    ///
+    /// @brief 对函数执行循环展开
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+    ///
+    /// @brief 输出完全展开与部分展开的循环个数
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp) const override;
+
+protected:
+    ///
+    /// @brief 按大小选择展开的方式并展开一个循环
+    /// @param loop 最内层循环
+    /// @return true 展开了循环，之前取得的基本块与循环信息都失效
+    ///
+    bool unrollLoop(Loop * loop);
+
+    ///
+    /// @brief 完全展开循环
+    /// @param info 循环的归纳变量信息，迭代次数已知
+    ///
+    void fullyUnroll(const InductionVariableInfo & info);
+
+    ///
+    /// @brief 按因子部分展开循环，原来的循环作为余数循环
+    /// @param info 循环的归纳变量信息
+    /// @param factor 展开因子
+    /// @return true 展开了循环
+    ///
+    bool partiallyUnroll(const InductionVariableInfo & info, int32_t factor);
+
+    ///
+    /// @brief 复制一次迭代：循环头与循环体的所有基本块，循环头的条件跳转改为直接进入循环体。
+    /// 复制出的latch仍然跳转到原来的循环头，由调用者改为下一次迭代
+    /// @param loop 循环
+    /// @param valueMap 值的映射，调用前含有循环头Phi指令在本次迭代的值
+    /// @return std::vector<Instruction *> 复制出的指令
+    ///
+    std::vector<Instruction *> cloneIteration(Loop * loop, std::unordered_map<Value *, Value *> & valueMap);
+
+    ///
+    /// @brief 由本次迭代的值映射得到下一次迭代循环头Phi指令的值
+    /// @param loop 循环
+    /// @param valueMap 本次迭代的值映射
+    /// @return std::unordered_map<Value *, Value *> 下一次迭代的值映射
+    ///
+    static std::unordered_map<Value *, Value *> nextIteration(Loop * loop,
+                                                               const std::unordered_map<Value *, Value *> & valueMap);
+
+    ///
+    /// @brief 计算循环的大小，即Label与Phi指令以外的指令条数
+    /// @param loop 循环
+    /// @return int32_t 指令条数
+    ///
+    static int32_t getLoopSize(Loop * loop);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+
+    ///
+    /// @brief 是否以代码大小优先
+    ///
+    bool forSize = false;
+
+    ///
+    /// @brief 是否对界限不是常量的循环做部分展开
+    ///
+    bool runtime = false;
+
+    ///
+    /// @brief 部分展开的因子，0表示自动选择
+    ///
+    int32_t count = 0;
+
+    ///
+    /// @brief 已经处理过的循环头的Label，含部分展开新建的主循环
+    ///
+    std::unordered_set<Instruction *> visited;
+
+    ///
+    /// @brief 完全展开的循环个数，所有函数累计
+    ///
+    int64_t fullCount = 0;
+
+    ///
+    /// @brief 部分展开的循环个数，所有函数累计
+    ///
+    int64_t partialCount = 0;
+
+    ///
+    /// @brief 部分展开时界限不是常量、需要运行时检查的循环个数，所有函数累计
+    ///
+    int64_t runtimeCount = 0;
+
+    ///
+    /// @brief 寄存器压力已达上限而没有部分展开的循环个数，所有函数累计
+    ///
+    int64_t pressureSkips = 0;
+
+    ///
+    /// @brief 展开后合并掉的基本块个数，所有函数累计
+    ///
+    int64_t mergedBlocks = 0;
+};
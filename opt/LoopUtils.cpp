@@ -0,0 +1,488 @@
+///
+/// @file LoopUtils.cpp
+/// @brief 循环变换共用的控制流图调整
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "LoopUtils.h"
+#include "LoopInfo.h"
+#include "Liveness.h"
+#include "Function.h"
+#include "BinaryInstruction.h"
+#include "CondBrInstruction.h"
+#include "GotoInstruction.h"
+#include "MoveInstruction.h"
+#include "FuncCallInstruction.h"
+#include "ArgInstruction.h"
+#include "LoadInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 把基本块的Phi指令中来自preds的来源合并为来自新的前驱，如循环头来自循环外的来源合并为来自前置基本块
+/// @param func 函数
+/// @param bb 基本块
+/// @param newPred 新的前驱，只含跳转到bb的指令
+/// @param preds 改为经由newPred进入bb的原前驱
+///
+static void mergeIncoming(Function * func,
+                          BasicBlock * bb,
+                          BasicBlock * newPred,
+                          const std::vector<BasicBlock *> & preds)
+{
+    Instruction * branch = newPred->getTerminator();
+
+    for (auto inst: bb->getInsts()) {
+
+        if (inst == bb->getLabel()) {
+            continue;
+        }
+
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            break;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(inst);
+
+        // 取出来自preds的来源，保持原有的先后顺序
+        std::vector<Value *> vals;
+        std::vector<BasicBlock *> blocks;
+        for (int32_t k = 0; k < phi->getIncomingNum();) {
+            BasicBlock * pred = phi->getIncomingBlock(k);
+            if (std::find(preds.begin(), preds.end(), pred) != preds.end()) {
+                vals.push_back(phi->getIncomingValue(k));
+                blocks.push_back(pred);
+                phi->removeIncoming(k);
+            } else {
+                ++k;
+            }
+        }
+
+        if (vals.empty()) {
+            continue;
+        }
+
+        bool same = std::all_of(vals.begin(), vals.end(), [&](Value * val) { return val == vals.front(); });
+        if (same) {
+            phi->addIncoming(vals.front(), newPred);
+            continue;
+        }
+
+        auto merged = func->newInst<PhiInstruction>(phi->getType());
+        for (size_t k = 0; k < vals.size(); ++k) {
+            merged->addIncoming(vals[k], blocks[k]);
+        }
+        newPred->insert(newPred->getIterator(branch), merged);
+
+        phi->addIncoming(merged, newPred);
+    }
+}
+
+///
+/// @brief 在bb之前新建只含跳转到bb的基本块，preds中跳转到bb的边都改为跳转到新基本块
+/// @param func 函数
+/// @param bb 基本块
+/// @param preds 改为经由新基本块进入bb的前驱
+/// @return BasicBlock* 新基本块，还不在基本块列表中
+///
+static BasicBlock * splitPredecessors(Function * func, BasicBlock * bb, const std::vector<BasicBlock *> & preds)
+{
+    // 新基本块紧接在bb之前，原来顺序进入bb的前驱仍然可以顺序执行
+    LabelInstruction * label = func->newInst<LabelInstruction>();
+    func->getInterCode().getInsts().insert(bb->begin(), label);
+    BasicBlock * newBlock = new BasicBlock(func, label);
+    newBlock->addInst(func->newInst<GotoInstruction>(bb->getLabel()));
+
+    for (auto pred: preds) {
+
+        Instruction * term = pred->getTerminator();
+        if (term->getOp() == IRInstOperator::IRINST_OP_GOTO) {
+            static_cast<GotoInstruction *>(term)->setTarget(label);
+        } else if (term->getOp() == IRInstOperator::IRINST_OP_COND_BR) {
+            auto condBrInst = static_cast<CondBrInstruction *>(term);
+            if (condBrInst->getTrueTarget() == bb->getLabel()) {
+                condBrInst->setTrueTarget(label);
+            }
+            if (condBrInst->getFalseTarget() == bb->getLabel()) {
+                condBrInst->setFalseTarget(label);
+            }
+        }
+    }
+
+    mergeIncoming(func, bb, newBlock, preds);
+
+    return newBlock;
+}
+
+///
+/// @brief 把新建的基本块放到布局中对应基本块之前，并重新划分基本块
+/// @param func 函数
+/// @param newBlocks 原基本块到放在其前面的新基本块
+///
+static void layoutNewBlocks(Function * func, const std::unordered_map<BasicBlock *, BasicBlock *> & newBlocks)
+{
+    std::vector<BasicBlock *> layout;
+    for (auto bb: func->getBasicBlocks()) {
+        auto iter = newBlocks.find(bb);
+        if (iter != newBlocks.end()) {
+            layout.push_back(iter->second);
+        }
+        layout.push_back(bb);
+    }
+
+    func->getBasicBlocks() = layout;
+    func->linearizeCFG();
+    func->buildCFG();
+}
+
+///
+/// @brief 为没有前置基本块的循环插入前置基本块
+/// @param func 函数
+/// @return int32_t 插入的前置基本块个数
+///
+int32_t insertPreheaders(Function * func)
+{
+    LoopInfo * loopInfo = func->getLoopInfo();
+
+    // 循环头到新建的前置基本块
+    std::unordered_map<BasicBlock *, BasicBlock *> preheaders;
+
+    for (auto loop: loopInfo->getLoops()) {
+
+        if (loop->getPreheader()) {
+            continue;
+        }
+
+        BasicBlock * header = loop->getHeader();
+
+        std::vector<BasicBlock *> outsidePreds;
+        for (auto pred: header->getPredecessors()) {
+            if (!loop->contains(pred) &&
+                std::find(outsidePreds.begin(), outsidePreds.end(), pred) == outsidePreds.end()) {
+                outsidePreds.push_back(pred);
+            }
+        }
+
+        if (outsidePreds.empty()) {
+            continue;
+        }
+
+        preheaders[header] = splitPredecessors(func, header, outsidePreds);
+    }
+
+    if (preheaders.empty()) {
+        return 0;
+    }
+
+    layoutNewBlocks(func, preheaders);
+
+    return (int32_t) preheaders.size();
+}
+
+///
+/// @brief 为有循环外前驱的出口基本块插入专用的出口基本块
+/// @param func 函数
+/// @return int32_t 插入的出口基本块个数
+///
+int32_t insertDedicatedExits(Function * func)
+{
+    LoopInfo * loopInfo = func->getLoopInfo();
+
+    // 出口基本块到新建的专用出口，同一个出口只为最先处理的内层循环拆分
+    std::unordered_map<BasicBlock *, BasicBlock *> exits;
+
+    for (auto loop: loopInfo->getLoops()) {
+        for (auto exit: loop->getExitBlocks()) {
+
+            if (exits.count(exit)) {
+                continue;
+            }
+
+            std::vector<BasicBlock *> insidePreds;
+            bool hasOutsidePred = false;
+            for (auto pred: exit->getPredecessors()) {
+                if (!loop->contains(pred)) {
+                    hasOutsidePred = true;
+                } else if (std::find(insidePreds.begin(), insidePreds.end(), pred) == insidePreds.end()) {
+                    insidePreds.push_back(pred);
+                }
+            }
+
+            if (hasOutsidePred) {
+                exits[exit] = splitPredecessors(func, exit, insidePreds);
+            }
+        }
+    }
+
+    if (exits.empty()) {
+        return 0;
+    }
+
+    layoutNewBlocks(func, exits);
+
+    return (int32_t) exits.size();
+}
+
+///
+/// @brief 合并直线相连的基本块
+/// @param func 函数
+/// @return int32_t 合并掉的基本块个数
+///
+int32_t mergeStraightLineBlocks(Function * func)
+{
+    // 被合并的基本块的Label到合并进的基本块，连续的一串合并到第一个基本块
+    std::unordered_map<Instruction *, BasicBlock *> merged;
+    std::vector<Instruction *> deadInsts;
+
+    const std::vector<BasicBlock *> & blocks = func->getBasicBlocks();
+    for (size_t k = 0; k + 1 < blocks.size(); ++k) {
+
+        BasicBlock * bb = blocks[k];
+        BasicBlock * next = blocks[k + 1];
+        Instruction * term = bb->getTerminator();
+
+        if (!term || term->getOp() != IRInstOperator::IRINST_OP_GOTO ||
+            static_cast<GotoInstruction *>(term)->getTarget() != next->getLabel() ||
+            next->getPredecessors().size() != 1 || next->getLabel() == func->getExitLabel()) {
+            continue;
+        }
+
+        auto second = std::next(next->begin());
+        if (second != next->end() && (*second)->getOp() == IRInstOperator::IRINST_OP_PHI) {
+            continue;
+        }
+
+        auto iter = merged.find(bb->getLabel());
+        merged[next->getLabel()] = iter == merged.end() ? bb : iter->second;
+        deadInsts.push_back(term);
+        deadInsts.push_back(next->getLabel());
+    }
+
+    if (merged.empty()) {
+        return 0;
+    }
+
+    // 后继的Phi指令中来自被合并基本块的来源改为来自合并进的基本块
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            continue;
+        }
+
+        auto phi = static_cast<PhiInstruction *>(inst);
+        for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+            auto iter = merged.find(phi->getIncomingLabel(k));
+            if (iter != merged.end()) {
+                phi->setIncomingBlock(k, iter->second);
+            }
+        }
+    }
+
+    // 跳转与Label都没有操作数，先释放基本块，再直接从线性IR中移除
+    func->clearCFG();
+    for (auto inst: deadInsts) {
+        func->getInterCode().getInsts().remove(inst);
+    }
+
+    func->buildCFG();
+
+    return (int32_t) merged.size();
+}
+
+///
+/// @brief 把循环外对值的使用替换为新的值
+/// @param loop 循环
+/// @param val 循环内定义的值
+/// @param newVal 新的值
+/// @return true 有使用被替换
+///
+bool replaceUsesOutside(Loop * loop, Value * val, Value * newVal)
+{
+    std::vector<Use *> uses;
+    for (auto use: val->getUses()) {
+        auto user = dynamic_cast<Instruction *>(use->getUser());
+        if (user && user->getParent() && !loop->contains(user->getParent())) {
+            uses.push_back(use);
+        }
+    }
+
+    for (auto use: uses) {
+        use->setUsee(newVal);
+    }
+
+    return !uses.empty();
+}
+
+///
+/// @brief 循环内的值可使用的寄存器个数，与ARM32后端寄存器分配可指派的寄存器（r5-r9）一致
+///
+const int32_t loopRegisterLimit = 5;
+
+///
+/// @brief 估计循环的寄存器压力，即循环内各位置同时活跃的值的最大个数
+/// @param func 函数，必须已经划分基本块
+/// @param loop 循环
+/// @return int32_t 同时活跃的值的最大个数
+///
+int32_t getMaxLiveValues(Function * func, Loop * loop)
+{
+    Liveness liveness(func, false);
+    liveness.run();
+
+    int32_t maxLive = 0;
+
+    for (auto bb: loop->getBlocks()) {
+
+        std::vector<Instruction *> insts(bb->begin(), bb->end());
+
+        // 逆序遍历基本块，live为当前指令之后活跃的值
+        BitVector live = liveness.getLiveOut(bb);
+        maxLive = std::max(maxLive, live.count());
+
+        for (auto iter = insts.rbegin(); iter != insts.rend(); ++iter) {
+
+            Instruction * inst = *iter;
+
+            // Phi指令在基本块入口处定值，其来源在前驱的出口处使用
+            if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                break;
+            }
+
+            int32_t defNo = inst->hasResultValue() ? liveness.getValueNo(inst) : -1;
+            if (defNo != -1) {
+                live.reset(defNo);
+            }
+
+            for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                int32_t no = liveness.getValueNo(inst->getOperand(k));
+                if (no != -1) {
+                    live.set(no);
+                }
+            }
+
+            maxLive = std::max(maxLive, live.count());
+        }
+    }
+
+    return maxLive;
+}
+
+///
+/// @brief 按映射取值，不在映射中时为原值
+/// @param valueMap 值的映射
+/// @param val 原值
+/// @return Value* 映射后的值
+///
+Value * mapValue(const std::unordered_map<Value *, Value *> & valueMap, Value * val)
+{
+    auto iter = valueMap.find(val);
+    return iter == valueMap.end() ? val : iter->second;
+}
+
+///
+/// @brief 复制一条指令，操作数暂时与原指令相同，跳转目标与Phi指令的来源基本块按映射修改
+/// @param func 函数
+/// @param inst 原指令
+/// @param valueMap 值的映射，已含有所有基本块的Label
+/// @return Instruction* 新指令
+///
+static Instruction *
+cloneInstruction(Function * func, Instruction * inst, const std::unordered_map<Value *, Value *> & valueMap)
+{
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_GOTO: {
+            auto target = static_cast<GotoInstruction *>(inst)->getTarget();
+            return func->newInst<GotoInstruction>(static_cast<Instruction *>(mapValue(valueMap, target)));
+        }
+        case IRInstOperator::IRINST_OP_COND_BR: {
+            auto condBrInst = static_cast<CondBrInstruction *>(inst);
+            auto trueTarget = static_cast<LabelInstruction *>(mapValue(valueMap, condBrInst->getTrueTarget()));
+            auto falseTarget = static_cast<LabelInstruction *>(mapValue(valueMap, condBrInst->getFalseTarget()));
+            return func->newInst<CondBrInstruction>(condBrInst->getCondition(), trueTarget, falseTarget);
+        }
+        case IRInstOperator::IRINST_OP_PHI: {
+            auto phi = static_cast<PhiInstruction *>(inst);
+            auto newPhi = func->newInst<PhiInstruction>(phi->getType());
+            for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+                auto label = static_cast<Instruction *>(mapValue(valueMap, phi->getIncomingLabel(k)));
+                newPhi->addIncoming(phi->getIncomingValue(k), label);
+            }
+            return newPhi;
+        }
+        case IRInstOperator::IRINST_OP_ASSIGN:
+            return func->newInst<MoveInstruction>(inst->getOperand(0), inst->getOperand(1));
+        case IRInstOperator::IRINST_OP_FUNC_CALL: {
+            std::vector<Value *> args;
+            for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                args.push_back(inst->getOperand(k));
+            }
+            Function * callee = static_cast<FuncCallInstruction *>(inst)->calledFunction;
+            return func->newInst<FuncCallInstruction>(callee, args, inst->getType());
+        }
+        case IRInstOperator::IRINST_OP_ARG:
+            return func->newInst<ArgInstruction>(inst->getOperand(0));
+        case IRInstOperator::IRINST_OP_LOAD:
+            return func->newInst<LoadInstruction>(inst->getOperand(0));
+        default:
+            // 其余都是二元运算
+            return func->newInst<BinaryInstruction>(inst->getOp(),
+                                                    inst->getOperand(0),
+                                                    inst->getOperand(1),
+                                                    inst->getType());
+    }
+}
+
+///
+/// @brief 复制一组基本块的指令，用于循环展开等
+/// @param func 函数
+/// @param blocks 要复制的基本块，不能含有入口与出口指令
+/// @param valueMap 值的映射
+/// @return std::vector<Instruction *> 复制出的指令，按基本块的顺序排列
+///
+std::vector<Instruction *>
+cloneBlocks(Function * func, const std::vector<BasicBlock *> & blocks, std::unordered_map<Value *, Value *> & valueMap)
+{
+    // 先新建所有的Label，跳转与Phi指令可能引用后面的基本块
+    for (auto bb: blocks) {
+        valueMap[bb->getLabel()] = func->newInst<LabelInstruction>();
+    }
+
+    std::vector<Instruction *> clones;
+    std::vector<Instruction *> newInsts;
+
+    for (auto bb: blocks) {
+
+        clones.push_back(static_cast<Instruction *>(valueMap[bb->getLabel()]));
+
+        for (auto inst: bb->getInsts()) {
+            if (inst == bb->getLabel() || valueMap.count(inst)) {
+                continue;
+            }
+
+            Instruction * newInst = cloneInstruction(func, inst, valueMap);
+            valueMap[inst] = newInst;
+            clones.push_back(newInst);
+            newInsts.push_back(newInst);
+        }
+    }
+
+    // 全部复制后再映射操作数，Phi指令可能使用后面的基本块中定义的值
+    for (auto inst: newInsts) {
+        for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+            inst->setOperand(k, mapValue(valueMap, inst->getOperand(k)));
+        }
+    }
+
+    return clones;
+}
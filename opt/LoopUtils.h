@@ -0,0 +1,101 @@
+///
+/// @file LoopUtils.h
+/// @brief 循环变换共用的控制流图调整
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Function;
+class Loop;
+class BasicBlock;
+class Instruction;
+class Value;
+
+///
+/// @brief 为没有前置基本块的循环插入前置基本块。新基本块放在循环头之前，只含跳转到循环头的指令，
+/// 循环外进入循环头的边都改为进入它；循环头的Phi指令中来自循环外的来源合并为来自前置基本块，
+/// 多个来源的值不同时在前置基本块中新建Phi指令汇合。插入后重新划分基本块，
+/// 之前取得的基本块与循环信息都失效
+/// @param func 函数
+/// @return int32_t 插入的前置基本块个数
+///
+int32_t insertPreheaders(Function * func);
+
+///
+/// @brief 为有循环外前驱的出口基本块插入专用的出口基本块。新基本块放在出口之前，只含跳转到出口的指令，
+/// 循环内进入出口的边都改为进入它，出口的Phi指令中来自循环内的来源随之合并。
+/// 之后出口处的值只来自循环内，如循环旋转后在出口处新建的Phi指令。插入后重新划分基本块，
+/// 之前取得的基本块与循环信息都失效
+/// @param func 函数
+/// @return int32_t 插入的出口基本块个数
+///
+int32_t insertDedicatedExits(Function * func);
+
+///
+/// @brief 合并直线相连的基本块：基本块以无条件跳转结束，目标紧跟其后且只有它一个前驱、没有Phi指令时，
+/// 删除跳转与目标的Label，两个基本块合为一个；出口基本块的Label由其它优化使用，保留。
+/// 用于删除循环展开、旋转后只含跳转的基本块，
+/// 避免生成跳转到下一条指令与只有跳转的Label。合并后重新划分基本块，之前取得的基本块与循环信息都失效
+/// @param func 函数
+/// @return int32_t 合并掉的基本块个数
+///
+int32_t mergeStraightLineBlocks(Function * func);
+
+///
+/// @brief 把循环外对值的使用替换为新的值，如出口处的常量或者展开后的最后一份复制
+/// @param loop 循环
+/// @param val 循环内定义的值
+/// @param newVal 新的值
+/// @return true 有使用被替换
+///
+bool replaceUsesOutside(Loop * loop, Value * val, Value * newVal);
+
+///
+/// @brief 循环内的值可使用的寄存器个数，与ARM32后端寄存器分配可指派的寄存器（r5-r9）一致。
+/// 同时活跃的值超过这个个数时，多出的值溢出到栈中，循环内的每次使用都要访存
+///
+extern const int32_t loopRegisterLimit;
+
+///
+/// @brief 估计循环的寄存器压力，即循环内各位置同时活跃的值的最大个数。
+/// 按SSA模式的活跃分析，从每个基本块出口处的活跃集合逆序扫描指令得到各位置的活跃个数
+/// @param func 函数，必须已经划分基本块
+/// @param loop 循环
+/// @return int32_t 同时活跃的值的最大个数
+///
+int32_t getMaxLiveValues(Function * func, Loop * loop);
+
+///
+/// @brief 按映射取值，不在映射中时为原值
+/// @param valueMap 值的映射
+/// @param val 原值
+/// @return Value* 映射后的值
+///
+Value * mapValue(const std::unordered_map<Value *, Value *> & valueMap, Value * val);
+
+///
+/// @brief 复制一组基本块的指令，用于循环展开等。先为每个基本块新建Label，再逐条复制指令，
+/// 操作数、跳转目标与Phi指令的来源基本块都按valueMap映射，不在valueMap中的保持不变。
+/// 调用前已在valueMap中的指令视为由调用者替换，不复制，如展开时的循环头Phi指令；
+/// 复制完成后valueMap含有原指令到新指令的映射。复制出的指令还不在线性IR中，由调用者插入并重新划分基本块
+/// @param func 函数
+/// @param blocks 要复制的基本块，不能含有入口与出口指令
+/// @param valueMap 值的映射
+/// @return std::vector<Instruction *> 复制出的指令，按基本块的顺序排列
+///
+std::vector<Instruction *>
+cloneBlocks(Function * func, const std::vector<BasicBlock *> & blocks, std::unordered_map<Value *, Value *> & valueMap);
@@ -0,0 +1,411 @@
+///
+/// @file Mem2Reg.cpp
+/// @brief 局部变量提升为SSA值的优化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <unordered_set>
+
+#include "Mem2Reg.h"
+#include "DominatorTree.h"
+#include "MoveInstruction.h"
+#include "LoadInstruction.h"
+#include "GlobalVariable.h"
+
+///
+/// @brief 构造函数
+///
+Mem2Reg::Mem2Reg() : FunctionPass("mem2reg")
+{}
+
+///
+/// @brief 获取变量的编号
+/// @param val 值
+/// @return int32_t 编号，不是要提升的变量时返回-1
+///
+int32_t Mem2Reg::getVarNo(Value * val)
+{
+    auto iter = varNos.find(val);
+    return iter == varNos.end() ? -1 : iter->second;
+}
+
+///
+/// @brief 获取变量当前到达的定值
+/// @param varNo 变量编号
+/// @return Value* 定值，没有定值时为常量0
+///
+Value * Mem2Reg::currentDef(int32_t varNo)
+{
+    if (defStacks[varNo].empty()) {
+        return module->newConstInt(0);
+    }
+
+    return defStacks[varNo].back();
+}
+
+///
+/// @brief 对函数执行提升
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改，false 没有可提升的变量
+///
+bool Mem2Reg::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    vars.clear();
+    varNos.clear();
+    defBlocks.clear();
+    useBlocks.clear();
+    phiVars.clear();
+    defStacks.clear();
+    deadMoves.clear();
+
+    if (func->getBasicBlocks().empty() || func->getVarValues().empty()) {
+        return false;
+    }
+
+    // 目前局部变量都是标量，且只通过Move指令定值
+    for (auto var: func->getVarValues()) {
+        varNos[var] = (int32_t) vars.size();
+        vars.push_back(var);
+    }
+
+    // 全局变量是内存而不是SSA值，其值在赋值与变量的使用之间可能被修改（如函数调用），
+    // 因此在赋值处读取全局变量的值，变量的定值为读取的结果
+    for (auto bb: func->getBasicBlocks()) {
+        for (auto inst: bb->getInsts()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN && getVarNo(inst->getOperand(0)) != -1 &&
+                dynamic_cast<GlobalVariable *>(inst->getOperand(1))) {
+                Instruction * load = func->newInst<LoadInstruction>(inst->getOperand(1));
+                bb->insert(bb->getIterator(inst), load);
+                inst->setOperand(1, load);
+            }
+        }
+    }
+
+    int32_t varNum = (int32_t) vars.size();
+    defBlocks.resize(varNum);
+    useBlocks.resize(varNum);
+    defStacks.resize(varNum);
+
+    // 收集每个变量的定值基本块以及先使用后定值的基本块，后者用于计算变量的活跃范围
+    std::vector<int32_t> defMark(varNum, -1);
+    std::vector<int32_t> useMark(varNum, -1);
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        int32_t bbNo = bb->getIndex();
+
+        for (auto inst: bb->getInsts()) {
+
+            int32_t dstNo = -1;
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                dstNo = getVarNo(inst->getOperand(0));
+            }
+
+            for (int32_t k = (dstNo == -1) ? 0 : 1; k < inst->getOperandsNum(); ++k) {
+                int32_t useNo = getVarNo(inst->getOperand(k));
+                if (useNo != -1 && defMark[useNo] != bbNo && useMark[useNo] != bbNo) {
+                    useMark[useNo] = bbNo;
+                    useBlocks[useNo].push_back(bb);
+                }
+            }
+
+            if (dstNo != -1 && defMark[dstNo] != bbNo) {
+                defMark[dstNo] = bbNo;
+                defBlocks[dstNo].push_back(bb);
+            }
+        }
+    }
+
+    for (int32_t varNo = 0; varNo < varNum; ++varNo) {
+        insertPhis(varNo);
+    }
+
+    rename();
+
+    cleanup();
+
+    return true;
+}
+
+///
+/// @brief 为变量插入Phi指令
+/// @param varNo 变量编号
+///
+void Mem2Reg::insertPhis(int32_t varNo)
+{
+    DominatorTree * domTree = func->getDominatorTree();
+    size_t blockNum = func->getBasicBlocks().size();
+
+    std::vector<char> defined(blockNum, 0);
+    std::vector<char> liveIn(blockNum, 0);
+    std::vector<char> hasPhi(blockNum, 0);
+
+    for (auto bb: defBlocks[varNo]) {
+        defined[bb->getIndex()] = 1;
+    }
+
+    // 从先使用后定值的基本块出发逆向传播，遇到定值的基本块截止，得到变量入口活跃的基本块
+    std::vector<BasicBlock *> worklist = useBlocks[varNo];
+    for (auto bb: worklist) {
+        liveIn[bb->getIndex()] = 1;
+    }
+
+    while (!worklist.empty()) {
+        BasicBlock * bb = worklist.back();
+        worklist.pop_back();
+
+        for (auto pred: bb->getPredecessors()) {
+            if (!liveIn[pred->getIndex()] && !defined[pred->getIndex()]) {
+                liveIn[pred->getIndex()] = 1;
+                worklist.push_back(pred);
+            }
+        }
+    }
+
+    // 在迭代支配边界上插入Phi指令，变量不活跃的地方不插入
+    worklist = defBlocks[varNo];
+    while (!worklist.empty()) {
+        BasicBlock * bb = worklist.back();
+        worklist.pop_back();
+
+        for (auto frontier: domTree->getDominanceFrontier(bb)) {
+
+            if (hasPhi[frontier->getIndex()]) {
+                continue;
+            }
+            hasPhi[frontier->getIndex()] = 1;
+
+            if (liveIn[frontier->getIndex()]) {
+                PhiInstruction * phi = func->newInst<PhiInstruction>(vars[varNo]->getType());
+                phiVars[phi] = varNo;
+
+                // Phi指令放在Label指令之后
+                frontier->insert(std::next(frontier->begin()), phi);
+            }
+
+            // Phi指令本身也是定值，继续传播
+            if (!defined[frontier->getIndex()]) {
+                defined[frontier->getIndex()] = 1;
+                worklist.push_back(frontier);
+            }
+        }
+    }
+}
+
+///
+/// @brief 沿支配树先序遍历，把变量的使用替换为到达的定值，并填写Phi指令的来源
+///
+void Mem2Reg::rename()
+{
+    DominatorTree * domTree = func->getDominatorTree();
+
+    // 非递归遍历支配树，每层记录本基本块压入定值的变量，离开时弹出
+    struct Frame {
+        BasicBlock * bb;
+        size_t next;
+        std::vector<int32_t> pushed;
+    };
+
+    std::vector<Frame> stack;
+    stack.push_back({func->getEntryBlock(), 0, {}});
+
+    bool enter = true;
+
+    while (!stack.empty()) {
+
+        Frame & frame = stack.back();
+
+        if (enter) {
+
+            for (auto inst: frame.bb->getInsts()) {
+
+                if (inst->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                    auto iter = phiVars.find(static_cast<PhiInstruction *>(inst));
+                    if (iter != phiVars.end()) {
+                        defStacks[iter->second].push_back(inst);
+                        frame.pushed.push_back(iter->second);
+                    }
+                    continue;
+                }
+
+                if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                    int32_t dstNo = getVarNo(inst->getOperand(0));
+                    if (dstNo != -1) {
+                        // 对变量的赋值，变量的定值变为源操作数，Move指令随后删除
+                        Value * src = inst->getOperand(1);
+                        int32_t srcNo = getVarNo(src);
+                        defStacks[dstNo].push_back(srcNo == -1 ? src : currentDef(srcNo));
+                        frame.pushed.push_back(dstNo);
+                        deadMoves.push_back(inst);
+                        continue;
+                    }
+                }
+
+                for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                    int32_t useNo = getVarNo(inst->getOperand(k));
+                    if (useNo != -1) {
+                        inst->setOperand(k, currentDef(useNo));
+                    }
+                }
+            }
+
+            // 填写后继基本块中Phi指令的来源
+            for (auto succ: frame.bb->getSuccessors()) {
+                for (auto inst: succ->getInsts()) {
+                    if (inst == succ->getLabel()) {
+                        continue;
+                    }
+                    if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                        break;
+                    }
+                    auto iter = phiVars.find(static_cast<PhiInstruction *>(inst));
+                    if (iter != phiVars.end()) {
+                        static_cast<PhiInstruction *>(inst)->addIncoming(currentDef(iter->second), frame.bb);
+                    }
+                }
+            }
+        }
+
+        const std::vector<BasicBlock *> & children = domTree->getChildren(frame.bb);
+        if (frame.next < children.size()) {
+            BasicBlock * child = children[frame.next++];
+            stack.push_back({child, 0, {}});
+            enter = true;
+            continue;
+        }
+
+        // 离开基本块，弹出本基本块压入的定值
+        for (auto varNo: frame.pushed) {
+            defStacks[varNo].pop_back();
+        }
+        stack.pop_back();
+        enter = false;
+    }
+}
+
+///
+/// @brief 处理入口不可达的基本块，删除提升后多余的指令与变量，并删除冗余的Phi指令
+///
+void Mem2Reg::cleanup()
+{
+    DominatorTree * domTree = func->getDominatorTree();
+
+    // 不可达的基本块没有被重命名，其中变量的使用按照没有初值处理
+    for (auto bb: func->getBasicBlocks()) {
+
+        if (domTree->isReachable(bb)) {
+            continue;
+        }
+
+        for (auto inst: bb->getInsts()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN && getVarNo(inst->getOperand(0)) != -1) {
+                deadMoves.push_back(inst);
+                continue;
+            }
+            for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                if (getVarNo(inst->getOperand(k)) != -1) {
+                    inst->setOperand(k, module->newConstInt(0));
+                }
+            }
+        }
+
+        // 保证Phi指令对每个前驱都有来源
+        for (auto succ: bb->getSuccessors()) {
+            for (auto inst: succ->getInsts()) {
+                if (inst == succ->getLabel()) {
+                    continue;
+                }
+                if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                    break;
+                }
+                if (phiVars.count(static_cast<PhiInstruction *>(inst))) {
+                    static_cast<PhiInstruction *>(inst)->addIncoming(module->newConstInt(0), bb);
+                }
+            }
+        }
+    }
+
+    // 删除对变量赋值的Move指令
+    std::unordered_set<Instruction *> deadInsts(deadMoves.begin(), deadMoves.end());
+
+    // 删除所有来源都相同的Phi指令，直接使用该来源的值
+    std::vector<PhiInstruction *> worklist;
+    for (auto & item: phiVars) {
+        worklist.push_back(item.first);
+    }
+
+    while (!worklist.empty()) {
+        PhiInstruction * phi = worklist.back();
+        worklist.pop_back();
+
+        if (deadInsts.count(phi)) {
+            continue;
+        }
+
+        Value * same = nullptr;
+        bool trivial = true;
+        for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+            Value * val = phi->getIncomingValue(k);
+            if (val == phi || val == same) {
+                continue;
+            }
+            if (same) {
+                trivial = false;
+                break;
+            }
+            same = val;
+        }
+
+        if (!trivial) {
+            continue;
+        }
+
+        if (!same) {
+            same = module->newConstInt(0);
+        }
+
+        // 使用该Phi指令的其它Phi指令可能也变得冗余
+        for (auto use: phi->getUses()) {
+            User * user = use->getUser();
+            if (user != phi && static_cast<Instruction *>(user)->getOp() == IRInstOperator::IRINST_OP_PHI) {
+                worklist.push_back(static_cast<PhiInstruction *>(user));
+            }
+        }
+
+        phi->replaceAllUsesWith(same);
+        deadInsts.insert(phi);
+    }
+
+    // 从基本块中移除，指令的内存随函数统一释放，这里只解除对操作数的使用
+    for (auto inst: deadInsts) {
+        inst->getParent()->erase(inst);
+        inst->clearOperands();
+    }
+
+    // 删除已提升的变量
+    std::vector<LocalVariable *> & varValues = func->getVarValues();
+    varValues.erase(std::remove_if(varValues.begin(),
+                                   varValues.end(),
+                                   [this](LocalVariable * var) { return getVarNo(var) != -1 && var->getUses().empty(); }),
+                    varValues.end());
+
+    for (auto var: vars) {
+        if (var->getUses().empty() && func->getReturnValue() == var) {
+            func->setReturnValue(nullptr);
+        }
+    }
+}
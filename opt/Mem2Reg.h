@@ -0,0 +1,123 @@
+///
+/// @file Mem2Reg.h
+/// @brief 局部变量提升为SSA值的优化
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Pass.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 把函数内的标量局部变量（含返回值变量）提升为SSA值。
+/// 局部变量的定值只有Move指令，提升后Move指令删除，变量的使用替换为到达的定值，
+/// 在迭代支配边界上插入Phi指令。只在变量活跃的基本块插入Phi指令，即剪枝的SSA。
+/// 没有初值的变量按0处理。全局变量不是SSA值，从全局变量赋值时在赋值处读取其值。
+///
+class Mem2Reg final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    Mem2Reg();
+
+    ///
+    /// @brief 对函数执行提升
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改，false 没有可提升的变量
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+protected:
+    ///
+    /// @brief 为变量插入Phi指令
+    /// @param varNo 变量编号
+    ///
+    void insertPhis(int32_t varNo);
+
+    ///
+    /// @brief 沿支配树先序遍历，把变量的使用替换为到达的定值，并填写Phi指令的来源
+    ///
+    void rename();
+
+    ///
+    /// @brief 处理入口不可达的基本块，删除提升后多余的指令与变量，并删除冗余的Phi指令
+    ///
+    void cleanup();
+
+    ///
+    /// @brief 获取变量的编号
+    /// @param val 值
+    /// @return int32_t 编号，不是要提升的变量时返回-1
+    ///
+    int32_t getVarNo(Value * val);
+
+    ///
+    /// @brief 获取变量当前到达的定值
+    /// @param varNo 变量编号
+    /// @return Value* 定值，没有定值时为常量0
+    ///
+    Value * currentDef(int32_t varNo);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+
+    ///
+    /// @brief 要提升的变量
+    ///
+    std::vector<LocalVariable *> vars;
+
+    ///
+    /// @brief 变量到编号的映射
+    ///
+    std::unordered_map<Value *, int32_t> varNos;
+
+    ///
+    /// @brief 变量的定值基本块
+    ///
+    std::vector<std::vector<BasicBlock *>> defBlocks;
+
+    ///
+    /// @brief 变量在基本块内先使用后定值的基本块，即入口处肯定活跃的基本块
+    ///
+    std::vector<std::vector<BasicBlock *>> useBlocks;
+
+    ///
+    /// @brief 插入的Phi指令对应的变量编号
+    ///
+    std::unordered_map<PhiInstruction *, int32_t> phiVars;
+
+    ///
+    /// @brief 每个变量的定值栈，用于重命名
+    ///
+    std::vector<std::vector<Value *>> defStacks;
+
+    ///
+    /// @brief 提升后需要删除的Move指令
+    ///
+    std::vector<Instruction *> deadMoves;
+};
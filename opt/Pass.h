@@ -0,0 +1,133 @@
+///
+/// @file Pass.h
+/// @brief 优化遍的基类，分为函数级的遍与模块级的遍
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#include "Function.h"
+#include "Module.h"
+
+///
+/// @brief 优化遍的基类
+///
+class Pass {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _name 遍的名字，即--passes=以及--print-after=中使用的名字
+    ///
+    explicit Pass(std::string _name) : name(std::move(_name))
+    {}
+
+    ///
+    /// @brief 析构函数
+    ///
+    virtual ~Pass() = default;
+
+    ///
+    /// @brief 获取遍的名字
+    /// @return const std::string& 名字
+    ///
+    [[nodiscard]] const std::string & getName() const
+    {
+        return name;
+    }
+
+    ///
+    /// @brief 是否是模块级的遍
+    /// @return true 模块级，false 函数级
+    ///
+    [[nodiscard]] virtual bool isModulePass() const = 0;
+
+    ///
+    /// @brief 修改函数后是否保持控制流图不变。不保持时，遍管理器在函数被修改后
+    /// 使基于控制流图的分析结果（支配树等）失效
+    /// @return true 保持
+    ///
+    [[nodiscard]] virtual bool preservesCFG() const
+    {
+        return false;
+    }
+
+    ///
+    /// @brief 输出遍的统计信息，如各改写规则的命中次数，用于调优。没有统计信息的遍不输出
+    /// @param fp 输出的文件
+    ///
+    virtual void printStatistics(FILE * fp) const
+    {
+        (void) fp;
+    }
+
+private:
+    ///
+    /// @brief 遍的名字
+    ///
+    std::string name;
+};
+
+///
+/// @brief 函数级的遍，逐个处理非内置函数
+///
+class FunctionPass : public Pass {
+
+public:
+    using Pass::Pass;
+
+    ///
+    /// @brief 是否是模块级的遍
+    /// @return false
+    ///
+    [[nodiscard]] bool isModulePass() const override
+    {
+        return false;
+    }
+
+    ///
+    /// @brief 对一个函数执行优化
+    /// @param func 函数，不会是内置函数
+    /// @param module 函数所在的模块
+    /// @return true 函数被修改
+    ///
+    virtual bool runOnFunction(Function * func, Module * module) = 0;
+};
+
+///
+/// @brief 模块级的遍，可跨函数进行处理
+///
+class ModulePass : public Pass {
+
+public:
+    using Pass::Pass;
+
+    ///
+    /// @brief 是否是模块级的遍
+    /// @return true
+    ///
+    [[nodiscard]] bool isModulePass() const override
+    {
+        return true;
+    }
+
+    ///
+    /// @brief 对模块执行优化
+    /// @param module 模块
+    /// @return true 模块被修改
+    ///
+    virtual bool runOnModule(Module * module) = 0;
+};
@@ -0,0 +1,454 @@
+///
+/// @file PassManager.cpp
+/// @brief 优化遍的管理器，按优化级别或指定的序列执行优化遍
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <chrono>
+#include <sstream>
+
+#include "Common.h"
+#include "PassManager.h"
+#include "Mem2Reg.h"
+#include "SCCP.h"
+#include "GVN.h"
+#include "DCE.h"
+#include "CopyPropagation.h"
+#include "InstCombine.h"
+#include "DivByConstant.h"
+#include "LICM.h"
+#include "IndVarSimplify.h"
+#include "LoopUnroll.h"
+#include "LoopRotate.h"
+
+///
+/// @brief 可按名字创建的遍
+///
+struct PassInfo {
+
+    /// @brief 遍的名字
+    const char * name;
+
+    /// @brief 创建遍的函数
+    Pass * (*create)();
+};
+
+///
+/// @brief 所有可按名字创建的遍，新增的遍需要在这里登记
+///
+static const PassInfo passRegistry[] = {
+    {"mem2reg", []() -> Pass * { return new Mem2Reg(); }},
+    {"sccp", []() -> Pass * { return new SCCP(); }},
+    {"gvn", []() -> Pass * { return new GVN(); }},
+    {"dce", []() -> Pass * { return new DCE(); }},
+    {"copyprop", []() -> Pass * { return new CopyPropagation(); }},
+    {"instcombine", []() -> Pass * { return new InstCombine(); }},
+    {"divconst", []() -> Pass * { return new DivByConstant(); }},
+    {"licm", []() -> Pass * { return new LICM(); }},
+    {"indvars", []() -> Pass * { return new IndVarSimplify(); }},
+    {"unroll", []() -> Pass * { return new LoopUnroll(); }},
+    {"rotate", []() -> Pass * { return new LoopRotate(); }},
+};
+
+///
+/// @brief 按逗号拆分字符串，忽略空项
+/// @param str 字符串
+/// @return std::vector<std::string> 拆分后的各项
+///
+static std::vector<std::string> splitNames(const std::string & str)
+{
+    std::vector<std::string> names;
+    std::stringstream stream(str);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            names.push_back(item);
+        }
+    }
+
+    return names;
+}
+
+///
+/// @brief 构造函数
+/// @param _module 要优化的模块
+///
+PassManager::PassManager(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 析构函数，释放所有的遍
+///
+PassManager::~PassManager()
+{
+    for (auto pass: passes) {
+        delete pass;
+    }
+}
+
+///
+/// @brief 按名字创建遍并追加到执行序列中
+/// @param name 遍的名字
+/// @return true 成功，false 不存在该名字的遍
+///
+bool PassManager::addPass(const std::string & name)
+{
+    for (auto & info: passRegistry) {
+        if (name == info.name) {
+            addPass(info.create());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief 追加遍到执行序列中，遍由管理器负责释放
+/// @param pass 遍
+///
+void PassManager::addPass(Pass * pass)
+{
+    // 按名字创建的遍没有参数，在这里统一设置
+    if (auto unroll = dynamic_cast<LoopUnroll *>(pass)) {
+        unroll->setCount(unrollCount);
+        unroll->setForSize(forSize);
+        unroll->setRuntime(unrollRuntime);
+    }
+
+    passes.push_back(pass);
+    passTimes.push_back(0);
+}
+
+///
+/// @brief 按优化级别追加标准的遍序列，-O1只做标量优化，-O2另做除法改写与循环优化
+/// @param level 优化级别，0、1、2
+/// @param _forSize 是否以代码大小优先，即-Os
+///
+void PassManager::addPipeline(int level, bool _forSize)
+{
+    setForSize(_forSize);
+
+    if (level <= 0) {
+        return;
+    }
+
+    // 局部变量提升为SSA值，后续的优化都基于SSA形式
+    addPass("mem2reg");
+
+    // 常量传播，同时删除条件恒定的分支与不可达的基本块
+    addPass("sccp");
+
+    // 代数化简与规范化，识别最值、绝对值等二选一的分支，规范后相同的运算可被后面的值编号删除
+    addPass("instcombine");
+
+    // 删除被支配的相同运算
+    addPass("gvn");
+
+    // -O1到此为止，只做不增大代码的标量优化；-O2与-Os再做除法改写与循环优化
+    if (level >= 2) {
+
+        // 除以常量改为乘法取高位与移位，在值编号之后进行，相同的除法只改写一次；指令序列变长，-Os时不做
+        if (!_forSize) {
+            addPass("divconst");
+        }
+
+        // 循环不变量外提到前置基本块，放在除法改写之后，不变的被除数的乘法序列也一起外提
+        addPass("licm");
+
+        // 归纳变量的强度削弱与出口条件替换，乘数已由不变量外提移出循环
+        addPass("indvars");
+
+        // 循环展开，按-O2的预算展开，-Os时只做不增大代码的完全展开（由addPass设置）；
+        // 展开后相邻迭代的常量与相同运算由后面的常量传播和值编号合并
+        addPass("unroll");
+
+        // 循环旋转为do-while形状，在只处理while形状的展开之后；入口检查的条件恒成立时由常量传播删除
+        addPass("rotate");
+        addPass("sccp");
+        addPass("gvn");
+    }
+
+    // 没有提升的变量之间的复写传播，之后不再活跃的赋值由死代码删除负责删除
+    addPass("copyprop");
+
+    // 删除前面的优化留下的无用运算与赋值，以及不可达的基本块
+    addPass("dce");
+}
+
+///
+/// @brief 按逗号分隔的遍名字追加遍序列，即--passes=的内容
+/// @param passNames 逗号分隔的遍名字
+/// @return true 成功，false 含有不存在的遍
+///
+bool PassManager::addPipeline(const std::string & passNames)
+{
+    for (auto & name: splitNames(passNames)) {
+        if (!addPass(name)) {
+            minic_log(LOG_ERROR, "不存在的优化遍(%s)，可用的优化遍有：%s", name.c_str(), getPassNames().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 设置循环展开的因子，需在追加遍之前设置
+/// @param count 展开因子，0表示按循环大小自动选择
+///
+void PassManager::setUnrollCount(int32_t count)
+{
+    unrollCount = count;
+}
+
+///
+/// @brief 设置是否以代码大小优先，即-Os，需在追加遍之前设置
+/// @param enable 是否以代码大小优先
+///
+void PassManager::setForSize(bool enable)
+{
+    forSize = enable;
+}
+
+///
+/// @brief 设置循环展开是否对界限不是常量的循环做部分展开，需在追加遍之前设置
+/// @param enable 是否做运行时的部分展开
+///
+void PassManager::setUnrollRuntime(bool enable)
+{
+    unrollRuntime = enable;
+}
+
+///
+/// @brief 设置是否统计每个遍的执行时间
+/// @param enable 是否统计
+///
+void PassManager::setTimePasses(bool enable)
+{
+    timePasses = enable;
+}
+
+///
+/// @brief 设置是否在执行后输出各个遍的统计信息
+/// @param enable 是否输出
+///
+void PassManager::setStats(bool enable)
+{
+    stats = enable;
+}
+
+///
+/// @brief 设置在哪些遍执行后输出IR
+/// @param passNames 逗号分隔的遍名字，all表示所有的遍
+///
+void PassManager::setPrintAfter(const std::string & passNames)
+{
+    printAfter = splitNames(passNames);
+}
+
+///
+/// @brief 执行所有的遍
+/// @return true 模块被修改
+///
+bool PassManager::run()
+{
+    bool changed = false;
+
+    for (size_t first = 0; first < passes.size();) {
+
+        if (passes[first]->isModulePass()) {
+
+            auto start = std::chrono::steady_clock::now();
+            bool passChanged = static_cast<ModulePass *>(passes[first])->runOnModule(module);
+            auto end = std::chrono::steady_clock::now();
+
+            if (passChanged && !passes[first]->preservesCFG()) {
+                for (auto func: module->getFunctionList()) {
+                    func->invalidateCFG();
+                }
+            }
+
+            changed = changed || passChanged;
+            afterPass(first, nullptr, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            first++;
+            continue;
+        }
+
+        // 连续的函数级遍，按函数逐个执行
+        size_t last = first;
+        while (last < passes.size() && !passes[last]->isModulePass()) {
+            last++;
+        }
+
+        for (auto func: module->getFunctionList()) {
+            if (!func->isBuiltin()) {
+                changed = runFunctionPasses(func, first, last) || changed;
+            }
+        }
+
+        first = last;
+    }
+
+    if (timePasses) {
+        printTimings(stderr);
+    }
+
+    if (stats) {
+        printStatistics(stderr);
+    }
+
+    return changed;
+}
+
+///
+/// @brief 对一个函数执行一段连续的函数级遍
+/// @param func 函数
+/// @param first 第一个遍的下标
+/// @param last 最后一个遍之后的下标
+/// @return true 函数被修改
+///
+bool PassManager::runFunctionPasses(Function * func, size_t first, size_t last)
+{
+    bool changed = false;
+
+    for (size_t passNo = first; passNo < last; ++passNo) {
+
+        auto pass = static_cast<FunctionPass *>(passes[passNo]);
+
+        auto start = std::chrono::steady_clock::now();
+        bool passChanged = pass->runOnFunction(func, module);
+        auto end = std::chrono::steady_clock::now();
+
+        // 控制流图被修改后，支配树等分析结果失效，下次使用时重新计算
+        if (passChanged && !pass->preservesCFG()) {
+            func->invalidateCFG();
+        }
+
+        changed = changed || passChanged;
+        afterPass(passNo, func, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    return changed;
+}
+
+///
+/// @brief 遍执行之后的处理：累计时间，需要时输出IR
+/// @param passNo 遍的下标
+/// @param func 函数，模块级的遍为nullptr
+/// @param nanoseconds 执行时间
+///
+void PassManager::afterPass(size_t passNo, Function * func, int64_t nanoseconds)
+{
+    passTimes[passNo] += nanoseconds;
+
+    if (!shouldPrintAfter(passes[passNo])) {
+        return;
+    }
+
+    std::vector<Function *> funcs;
+    if (func) {
+        funcs.push_back(func);
+    } else {
+        funcs = module->getFunctionList();
+    }
+
+    for (auto printFunc: funcs) {
+
+        if (printFunc->isBuiltin()) {
+            continue;
+        }
+
+        std::string str;
+        printFunc->renameIR();
+        printFunc->toString(str);
+
+        fprintf(stderr,
+                "; *** IR Dump After %s on %s ***\n%s\n",
+                passes[passNo]->getName().c_str(),
+                printFunc->getName().c_str(),
+                str.c_str());
+    }
+}
+
+///
+/// @brief 是否在指定的遍之后输出IR
+/// @param pass 遍
+/// @return true 输出
+///
+bool PassManager::shouldPrintAfter(Pass * pass)
+{
+    for (auto & name: printAfter) {
+        if (name == "all" || name == pass->getName()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief 输出每个遍的执行时间
+/// @param fp 输出的文件
+///
+void PassManager::printTimings(FILE * fp)
+{
+    int64_t total = 0;
+    for (auto time: passTimes) {
+        total += time;
+    }
+
+    fprintf(fp, "===--- Pass execution timing report ---===\n");
+    fprintf(fp, "%12s %8s  %s\n", "time(us)", "percent", "pass");
+
+    for (size_t passNo = 0; passNo < passes.size(); ++passNo) {
+        fprintf(fp,
+                "%12.1f %7.1f%%  %s\n",
+                (double) passTimes[passNo] / 1000.0,
+                total ? (double) passTimes[passNo] * 100.0 / (double) total : 0.0,
+                passes[passNo]->getName().c_str());
+    }
+
+    fprintf(fp, "%12.1f %7.1f%%  %s\n", (double) total / 1000.0, 100.0, "total");
+}
+
+///
+/// @brief 输出各个遍的统计信息
+/// @param fp 输出的文件
+///
+void PassManager::printStatistics(FILE * fp)
+{
+    fprintf(fp, "===--- Pass statistics report ---===\n");
+
+    for (auto pass: passes) {
+        pass->printStatistics(fp);
+    }
+}
+
+///
+/// @brief 获取所有可用的遍名字，用于帮助信息
+/// @return std::string 逗号分隔的遍名字
+///
+std::string PassManager::getPassNames()
+{
+    std::string names;
+
+    for (auto & info: passRegistry) {
+        if (!names.empty()) {
+            names += ",";
+        }
+        names += info.name;
+    }
+
+    return names;
+}
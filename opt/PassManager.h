@@ -0,0 +1,200 @@
+///
+/// @file PassManager.h
+/// @brief 优化遍的管理器，按优化级别或指定的序列执行优化遍
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Pass.h"
+
+///
+/// @brief 优化遍的管理器。连续的函数级遍按函数逐个执行，使同一函数的分析结果能够被后续的遍复用；
+/// 遍修改了函数且不保持控制流图时，使该函数基于控制流图的分析结果失效。
+///
+class PassManager {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要优化的模块
+    ///
+    explicit PassManager(Module * _module);
+
+    ///
+    /// @brief 析构函数，释放所有的遍
+    ///
+    ~PassManager();
+
+    ///
+    /// @brief 按名字创建遍并追加到执行序列中
+    /// @param name 遍的名字
+    /// @return true 成功，false 不存在该名字的遍
+    ///
+    bool addPass(const std::string & name);
+
+    ///
+    /// @brief 追加遍到执行序列中，遍由管理器负责释放
+    /// @param pass 遍
+    ///
+    void addPass(Pass * pass);
+
+    ///
+    /// @brief 按优化级别追加标准的遍序列
+    /// @param level 优化级别，0、1、2
+    /// @param _forSize 是否以代码大小优先，即-Os
+    ///
+    void addPipeline(int level, bool _forSize);
+
+    ///
+    /// @brief 按逗号分隔的遍名字追加遍序列，即--passes=的内容
+    /// @param passNames 逗号分隔的遍名字
+    /// @return true 成功，false 含有不存在的遍
+    ///
+    bool addPipeline(const std::string & passNames);
+
+    ///
+    /// @brief 设置循环展开的因子，需在追加遍之前设置
+    /// @param count 展开因子，0表示按循环大小自动选择
+    ///
+    void setUnrollCount(int32_t count);
+
+    ///
+    /// @brief 设置是否以代码大小优先，即-Os，需在追加遍之前设置
+    /// @param enable 是否以代码大小优先
+    ///
+    void setForSize(bool enable);
+
+    ///
+    /// @brief 设置循环展开是否对界限不是常量的循环做部分展开，需在追加遍之前设置
+    /// @param enable 是否做运行时的部分展开
+    ///
+    void setUnrollRuntime(bool enable);
+
+    ///
+    /// @brief 设置是否统计每个遍的执行时间
+    /// @param enable 是否统计
+    ///
+    void setTimePasses(bool enable);
+
+    ///
+    /// @brief 设置在哪些遍执行后输出IR
+    /// @param passNames 逗号分隔的遍名字，all表示所有的遍
+    ///
+    void setPrintAfter(const std::string & passNames);
+
+    ///
+    /// @brief 设置是否在执行后输出各个遍的统计信息
+    /// @param enable 是否输出
+    ///
+    void setStats(bool enable);
+
+    ///
+    /// @brief 执行所有的遍
+    /// @return true 模块被修改
+    ///
+    bool run();
+
+    ///
+    /// @brief 输出每个遍的执行时间
+    /// @param fp 输出的文件
+    ///
+    void printTimings(FILE * fp);
+
+    ///
+    /// @brief 输出各个遍的统计信息
+    /// @param fp 输出的文件
+    ///
+    void printStatistics(FILE * fp);
+
+    ///
+    /// @brief 获取所有可用的遍名字，用于帮助信息
+    /// @return std::string 逗号分隔的遍名字
+    ///
+    static std::string getPassNames();
+
+protected:
+    ///
+    /// @brief 对一个函数执行一段连续的函数级遍
+    /// @param func 函数
+    /// @param first 第一个遍的下标
+    /// @param last 最后一个遍之后的下标
+    /// @return true 函数被修改
+    ///
+    bool runFunctionPasses(Function * func, size_t first, size_t last);
+
+    ///
+    /// @brief 遍执行之后的处理：累计时间，需要时输出IR
+    /// @param passNo 遍的下标
+    /// @param func 函数，模块级的遍为nullptr
+    /// @param nanoseconds 执行时间
+    ///
+    void afterPass(size_t passNo, Function * func, int64_t nanoseconds);
+
+    ///
+    /// @brief 是否在指定的遍之后输出IR
+    /// @param pass 遍
+    /// @return true 输出
+    ///
+    bool shouldPrintAfter(Pass * pass);
+
+private:
+    ///
+    /// @brief 要优化的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 按执行次序排列的遍
+    ///
+    std::vector<Pass *> passes;
+
+    ///
+    /// @brief 每个遍累计的执行时间，单位纳秒
+    ///
+    std::vector<int64_t> passTimes;
+
+    ///
+    /// @brief 循环展开的因子，0表示按循环大小自动选择
+    ///
+    int32_t unrollCount = 0;
+
+    ///
+    /// @brief 是否以代码大小优先，即-Os
+    ///
+    bool forSize = false;
+
+    ///
+    /// @brief 循环展开是否对界限不是常量的循环做部分展开
+    ///
+    bool unrollRuntime = false;
+
+    ///
+    /// @brief 是否统计执行时间
+    ///
+    bool timePasses = false;
+
+    ///
+    /// @brief 是否输出统计信息
+    ///
+    bool stats = false;
+
+    ///
+    /// @brief 执行后需要输出IR的遍名字
+    ///
+    std::vector<std::string> printAfter;
+};
@@ -0,0 +1,441 @@
+///
+/// @file SCCP.cpp
+/// @brief 稀疏条件常量传播
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "SCCP.h"
+#include "ConstantFold.h"
+#include "CondBrInstruction.h"
+#include "GlobalVariable.h"
+#include "GotoInstruction.h"
+#include "PhiInstruction.h"
+
+///
+/// @brief 构造函数
+///
+SCCP::SCCP() : FunctionPass("sccp")
+{}
+
+///
+/// @brief 对函数执行常量传播
+/// @param _func 要处理的函数
+/// @param _module 模块，用于创建常量
+/// @return true 函数被修改
+///
+bool SCCP::runOnFunction(Function * _func, Module * _module)
+{
+    func = _func;
+    module = _module;
+
+    numbering.clear();
+    lattices.clear();
+    executable.clear();
+    executableEdges.clear();
+    blockWorklist.clear();
+    instWorklist.clear();
+    readOnlyGlobals.clear();
+    writtenGlobals.clear();
+
+    if (func->getBasicBlocks().empty()) {
+        return false;
+    }
+
+    numbering.numberInstructions(func);
+    lattices.assign((size_t) numbering.size(), LatticeValue());
+    executable.assign(func->getBasicBlocks().size(), 0);
+
+    solve();
+
+    return rewrite();
+}
+
+///
+/// @brief 求解常量格与可执行的控制流边
+///
+void SCCP::solve()
+{
+    BasicBlock * entry = func->getEntryBlock();
+    executable[entry->getIndex()] = 1;
+    blockWorklist.push_back(entry);
+
+    while (!blockWorklist.empty() || !instWorklist.empty()) {
+
+        // 先传播格值的变化，尽量在基本块第一次求值前得到其操作数的最终格值
+        while (!instWorklist.empty()) {
+
+            Instruction * inst = instWorklist.back();
+            instWorklist.pop_back();
+
+            for (auto use: inst->getUses()) {
+                auto user = static_cast<Instruction *>(use->getUser());
+                if (user->getParent() && executable[user->getParent()->getIndex()]) {
+                    visit(user);
+                }
+            }
+        }
+
+        if (!blockWorklist.empty()) {
+
+            BasicBlock * bb = blockWorklist.back();
+            blockWorklist.pop_back();
+
+            for (auto inst: bb->getInsts()) {
+                visit(inst);
+            }
+        }
+    }
+}
+
+///
+/// @brief 对指令求值
+/// @param inst 指令
+///
+void SCCP::visit(Instruction * inst)
+{
+    BasicBlock * bb = inst->getParent();
+    LatticeValue result;
+
+    switch (inst->getOp()) {
+
+        case IRInstOperator::IRINST_OP_PHI: {
+
+            // 只合并来自可执行边的来源，未定义的来源不影响结果
+            auto phi = static_cast<PhiInstruction *>(inst);
+            for (int32_t k = 0; k < phi->getIncomingNum(); ++k) {
+
+                if (!isEdgeExecutable(phi->getIncomingBlock(k), bb)) {
+                    continue;
+                }
+
+                LatticeValue incoming = getLattice(phi->getIncomingValue(k));
+                if (incoming.state == LatticeValue::UNDEFINED) {
+                    continue;
+                }
+
+                if (incoming.state == LatticeValue::OVERDEFINED ||
+                    (result.state == LatticeValue::CONSTANT && result.val != incoming.val)) {
+                    result.state = LatticeValue::OVERDEFINED;
+                    break;
+                }
+
+                result = incoming;
+            }
+
+            setLattice(inst, result);
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_LOAD:
+            // 只读的全局变量为常量，其余的全局变量不确定
+            setLattice(inst, getLattice(inst->getOperand(0)));
+            break;
+
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_NEG_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NEQ_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_SHL_I:
+        case IRInstOperator::IRINST_OP_ASHR_I:
+        case IRInstOperator::IRINST_OP_LSHR_I:
+        case IRInstOperator::IRINST_OP_MIN_I:
+        case IRInstOperator::IRINST_OP_MAX_I:
+        case IRInstOperator::IRINST_OP_ABS_I:
+        case IRInstOperator::IRINST_OP_MULH_I: {
+
+            LatticeValue lhs = getLattice(inst->getOperand(0));
+            LatticeValue rhs = getLattice(inst->getOperand(1));
+
+            if (lhs.state == LatticeValue::OVERDEFINED || rhs.state == LatticeValue::OVERDEFINED) {
+                result.state = LatticeValue::OVERDEFINED;
+            } else if (lhs.state == LatticeValue::CONSTANT && rhs.state == LatticeValue::CONSTANT) {
+                // 除数为0等不能折叠的运算保留到运行时
+                bool folded = constantFoldBinary(inst->getOp(), lhs.val, rhs.val, result.val);
+                result.state = folded ? LatticeValue::CONSTANT : LatticeValue::OVERDEFINED;
+            }
+
+            setLattice(inst, result);
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_GOTO:
+            markEdge(bb, static_cast<GotoInstruction *>(inst)->getTarget()->getParent());
+            break;
+
+        case IRInstOperator::IRINST_OP_COND_BR: {
+
+            auto condBrInst = static_cast<CondBrInstruction *>(inst);
+            LatticeValue cond = getLattice(condBrInst->getCondition());
+
+            if (cond.state == LatticeValue::CONSTANT) {
+                LabelInstruction * target = cond.val ? condBrInst->getTrueTarget() : condBrInst->getFalseTarget();
+                markEdge(bb, target->getParent());
+            } else if (cond.state == LatticeValue::OVERDEFINED) {
+                markEdge(bb, condBrInst->getTrueTarget()->getParent());
+                markEdge(bb, condBrInst->getFalseTarget()->getParent());
+            }
+            break;
+        }
+
+        default:
+            // 函数调用等其它有值的指令不能确定其值
+            if (inst->hasResultValue()) {
+                result.state = LatticeValue::OVERDEFINED;
+                setLattice(inst, result);
+            }
+            break;
+    }
+}
+
+///
+/// @brief 获取值在常量格上的值
+/// @param val 值
+/// @return LatticeValue 格值
+///
+SCCP::LatticeValue SCCP::getLattice(Value * val)
+{
+    LatticeValue lattice;
+
+    auto constInt = dynamic_cast<ConstInt *>(val);
+    if (constInt || isReadOnlyGlobal(val)) {
+        lattice.state = LatticeValue::CONSTANT;
+        lattice.val = constInt ? constInt->getVal() : 0;
+        return lattice;
+    }
+
+    int32_t no = numbering.getNo(val);
+    if (no != -1) {
+        return lattices[no];
+    }
+
+    // 局部变量、形参等不是SSA值，其值不确定
+    lattice.state = LatticeValue::OVERDEFINED;
+    return lattice;
+}
+
+///
+/// @brief 更新指令的格值，格值只能下降，变化后其使用者需要重新求值
+/// @param inst 指令
+/// @param lattice 新的格值
+///
+void SCCP::setLattice(Instruction * inst, const LatticeValue & lattice)
+{
+    LatticeValue & old = lattices[numbering.getNo(inst)];
+
+    if (old.state == lattice.state && (old.state != LatticeValue::CONSTANT || old.val == lattice.val)) {
+        return;
+    }
+
+    old = lattice;
+    instWorklist.push_back(inst);
+}
+
+///
+/// @brief 标记控制流边可执行
+/// @param from 源基本块
+/// @param to 目的基本块
+///
+void SCCP::markEdge(BasicBlock * from, BasicBlock * to)
+{
+    if (!executableEdges.emplace(from->getIndex(), to->getIndex()).second) {
+        return;
+    }
+
+    if (!executable[to->getIndex()]) {
+        executable[to->getIndex()] = 1;
+        blockWorklist.push_back(to);
+        return;
+    }
+
+    // 基本块已经求值过，新的可执行入边只影响其Phi指令
+    for (auto inst: to->getInsts()) {
+        if (inst == to->getLabel()) {
+            continue;
+        }
+        if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+            break;
+        }
+        visit(inst);
+    }
+}
+
+///
+/// @brief 判断控制流边是否可执行
+/// @param from 源基本块
+/// @param to 目的基本块
+/// @return true 可执行
+///
+bool SCCP::isEdgeExecutable(BasicBlock * from, BasicBlock * to)
+{
+    return executableEdges.count({from->getIndex(), to->getIndex()}) != 0;
+}
+
+///
+/// @brief 判断全局变量在整个模块内是否从未被赋值
+/// @param val 值
+/// @return true 是从未被赋值的全局变量
+///
+bool SCCP::isReadOnlyGlobal(Value * val)
+{
+    if (!dynamic_cast<GlobalVariable *>(val) || writtenGlobals.count(val)) {
+        return false;
+    }
+
+    if (readOnlyGlobals.count(val)) {
+        return true;
+    }
+
+    // 全局变量的use链表含有所有函数中的使用，只有Move指令能对其赋值
+    for (auto use: val->getUses()) {
+        auto user = dynamic_cast<Instruction *>(use->getUser());
+        if (user && user->getOp() == IRInstOperator::IRINST_OP_ASSIGN && user->getOperand(0) == val) {
+            writtenGlobals.insert(val);
+            return false;
+        }
+    }
+
+    readOnlyGlobals.insert(val);
+    return true;
+}
+
+///
+/// @brief 按求解的结果改写函数
+/// @return true 函数被修改
+///
+bool SCCP::rewrite()
+{
+    bool changed = false;
+    std::vector<Instruction *> deadInsts;
+
+    // 出口基本块即使不可执行也要保留，后端生成函数的epilogue需要
+    BasicBlock * exitBlock = func->getExitLabel()->getParent();
+
+    for (auto bb: func->getBasicBlocks()) {
+
+        if (!executable[bb->getIndex()]) {
+            continue;
+        }
+
+        for (auto inst: bb->getInsts()) {
+
+            // 值为常量的指令，其使用直接改为常量
+            int32_t no = numbering.getNo(inst);
+            if (no != -1 && lattices[no].state == LatticeValue::CONSTANT) {
+                inst->replaceAllUsesWith(module->newConstInt(lattices[no].val));
+                deadInsts.push_back(inst);
+                changed = true;
+                continue;
+            }
+
+            for (int32_t k = 0; k < inst->getOperandsNum(); ++k) {
+                if (isReadOnlyGlobal(inst->getOperand(k))) {
+                    inst->setOperand(k, module->newConstInt(0));
+                    changed = true;
+                }
+            }
+        }
+
+        // 条件为常量的条件跳转改为无条件跳转
+        Instruction * term = bb->getTerminator();
+        if (term && term->getOp() == IRInstOperator::IRINST_OP_COND_BR) {
+
+            auto condBrInst = static_cast<CondBrInstruction *>(term);
+            LatticeValue cond = getLattice(condBrInst->getCondition());
+
+            if (cond.state == LatticeValue::CONSTANT) {
+                LabelInstruction * target = cond.val ? condBrInst->getTrueTarget() : condBrInst->getFalseTarget();
+                bb->addInst(func->newInst<GotoInstruction>(target));
+                bb->erase(term);
+                term->clearOperands();
+                changed = true;
+            }
+        }
+    }
+
+    // Phi指令删除来自不可执行边的来源，只剩一个来源时直接使用该来源
+    for (auto bb: func->getBasicBlocks()) {
+
+        if (!executable[bb->getIndex()] && bb != exitBlock) {
+            continue;
+        }
+
+        for (auto inst: bb->getInsts()) {
+
+            if (inst == bb->getLabel()) {
+                continue;
+            }
+            if (inst->getOp() != IRInstOperator::IRINST_OP_PHI) {
+                break;
+            }
+
+            int32_t no = numbering.getNo(inst);
+            if (lattices[no].state == LatticeValue::CONSTANT) {
+                continue;
+            }
+
+            auto phi = static_cast<PhiInstruction *>(inst);
+            for (int32_t k = phi->getIncomingNum() - 1; k >= 0; --k) {
+                if (!isEdgeExecutable(phi->getIncomingBlock(k), bb)) {
+                    phi->removeIncoming(k);
+                    changed = true;
+                }
+            }
+
+            // 出口基本块不可执行时Phi指令没有来源，其值不会被用到
+            if (phi->getIncomingNum() <= 1) {
+                phi->replaceAllUsesWith(phi->getIncomingNum() ? phi->getIncomingValue(0) : module->newConstInt(0));
+                deadInsts.push_back(phi);
+                changed = true;
+            }
+        }
+    }
+
+    for (auto inst: deadInsts) {
+        inst->getParent()->erase(inst);
+        inst->clearOperands();
+    }
+
+    // 删除不可执行的基本块，其中的值只可能被其它不可执行的基本块或者不可执行的出口基本块使用
+    std::vector<BasicBlock *> deadBlocks;
+    for (auto bb: func->getBasicBlocks()) {
+        if (!executable[bb->getIndex()] && bb != exitBlock) {
+            deadBlocks.push_back(bb);
+        }
+    }
+
+    if (deadBlocks.empty()) {
+        if (changed) {
+            func->buildCFG();
+        }
+        return changed;
+    }
+
+    for (auto bb: deadBlocks) {
+        for (auto inst: bb->getInsts()) {
+            if (inst->hasResultValue()) {
+                inst->replaceAllUsesWith(module->newConstInt(0));
+            }
+        }
+    }
+
+    func->removeBasicBlocks(deadBlocks);
+
+    return true;
+}
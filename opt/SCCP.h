@@ -0,0 +1,165 @@
+///
+/// @file SCCP.h
+/// @brief 稀疏条件常量传播
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Pass.h"
+#include "ValueNumbering.h"
+
+///
+/// @brief 稀疏条件常量传播（Wegman-Zadeck）。在SSA形式上同时求值的常量格与控制流边的可执行性：
+/// 只有可执行的基本块内的指令参与求值，Phi指令只合并来自可执行边的来源，条件跳转的条件为常量时只有一条出边可执行。
+/// 求解后常量值替换其使用，条件为常量的条件跳转改为无条件跳转，删除不可执行的基本块与Phi指令中对应的来源。
+/// 全局变量只有零初值，整个模块内都没有被赋值的全局变量按常量0处理
+///
+class SCCP final : public FunctionPass {
+
+public:
+    ///
+    /// @brief 构造函数
+    ///
+    SCCP();
+
+    ///
+    /// @brief 对函数执行常量传播
+    /// @param _func 要处理的函数
+    /// @param _module 模块，用于创建常量
+    /// @return true 函数被修改
+    ///
+    bool runOnFunction(Function * _func, Module * _module) override;
+
+protected:
+    ///
+    /// @brief 常量格上的值：未定义（尚未求值）、常量、非常量
+    ///
+    struct LatticeValue {
+
+        /// @brief 状态
+        enum State : int8_t { UNDEFINED, CONSTANT, OVERDEFINED } state = UNDEFINED;
+
+        /// @brief 状态为常量时的值
+        int32_t val = 0;
+    };
+
+    ///
+    /// @brief 求解常量格与可执行的控制流边
+    ///
+    void solve();
+
+    ///
+    /// @brief 按求解的结果改写函数
+    /// @return true 函数被修改
+    ///
+    bool rewrite();
+
+    ///
+    /// @brief 对指令求值
+    /// @param inst 指令
+    ///
+    void visit(Instruction * inst);
+
+    ///
+    /// @brief 获取值在常量格上的值
+    /// @param val 值
+    /// @return LatticeValue 格值
+    ///
+    LatticeValue getLattice(Value * val);
+
+    ///
+    /// @brief 更新指令的格值，格值只能下降，变化后其使用者需要重新求值
+    /// @param inst 指令
+    /// @param lattice 新的格值
+    ///
+    void setLattice(Instruction * inst, const LatticeValue & lattice);
+
+    ///
+    /// @brief 标记控制流边可执行
+    /// @param from 源基本块
+    /// @param to 目的基本块
+    ///
+    void markEdge(BasicBlock * from, BasicBlock * to);
+
+    ///
+    /// @brief 判断控制流边是否可执行
+    /// @param from 源基本块
+    /// @param to 目的基本块
+    /// @return true 可执行
+    ///
+    bool isEdgeExecutable(BasicBlock * from, BasicBlock * to);
+
+    ///
+    /// @brief 判断全局变量在整个模块内是否从未被赋值
+    /// @param val 值
+    /// @return true 是从未被赋值的全局变量
+    ///
+    bool isReadOnlyGlobal(Value * val);
+
+private:
+    ///
+    /// @brief 要处理的函数
+    ///
+    Function * func = nullptr;
+
+    ///
+    /// @brief 模块
+    ///
+    Module * module = nullptr;
+
+    ///
+    /// @brief 有值的指令的稠密编号
+    ///
+    ValueNumbering numbering;
+
+    ///
+    /// @brief 按指令编号索引的格值
+    ///
+    std::vector<LatticeValue> lattices;
+
+    ///
+    /// @brief 按基本块布局序号索引的可执行标记
+    ///
+    std::vector<char> executable;
+
+    ///
+    /// @brief 可执行的控制流边，每项为(源基本块布局序号, 目的基本块布局序号)
+    ///
+    std::set<std::pair<int32_t, int32_t>> executableEdges;
+
+    ///
+    /// @brief 新变为可执行、需要对其所有指令求值的基本块
+    ///
+    std::vector<BasicBlock *> blockWorklist;
+
+    ///
+    /// @brief 格值变化、需要对其使用者重新求值的指令
+    ///
+    std::vector<Instruction *> instWorklist;
+
+    ///
+    /// @brief 已判断过的全局变量：从未被赋值的
+    ///
+    std::unordered_set<Value *> readOnlyGlobals;
+
+    ///
+    /// @brief 已判断过的全局变量：被赋值过的
+    ///
+    std::unordered_set<Value *> writtenGlobals;
+};
@@ -81,14 +81,15 @@ Function * Module::newFunction(std::string name, Type * returnType, std::vector<
     }
 
     // 根据形参创建形参类型清单
-    std::vector<Type *> paramsType(params.size());
+    std::vector<Type *> paramsType;
+    paramsType.reserve(params.size());
 
     for (auto & param: params) {
         paramsType.push_back(param->getType());
     }
 
-    /// 函数类型参数
-    FunctionType * type = new FunctionType(returnType, paramsType);
+    /// 函数类型参数，同样的函数类型只有一份
+    FunctionType * type = typeContext->getFunctionType(returnType, paramsType);
 
     // 新建函数对象
     tempFunc = new Function(name, type, builtin);
@@ -153,7 +154,7 @@ ConstInt * Module::newConstInt(int32_t intVal)
     if (!val) {
 
         // 不存在，则创建整数常量Value
-        val = new ConstInt(intVal);
+        val = arena.create<ConstInt>(intVal);
 
         insertConstIntDirectly(val);
     }
@@ -245,7 +246,7 @@ Value * Module::findVarValue(std::string name)
 ///
 GlobalVariable * Module::newGlobalVariable(Type * type, std::string name)
 {
-    GlobalVariable * val = new GlobalVariable(type, name);
+    GlobalVariable * val = arena.create<GlobalVariable>(type, name);
 
     insertGlobalValueDirectly(val);
 
@@ -277,14 +278,13 @@ void Module::Delete()
         delete func;
     }
 
-    // 清理全局变量
-    for (auto var: globalVariableVector) {
-        delete var;
-    }
-
     // 相关列表清空
     globalVariableMap.clear();
     globalVariableVector.clear();
+    constIntMap.clear();
+
+    // 全局变量与常量统一释放
+    arena.release();
 
     funcMap.clear();
     funcVector.clear();
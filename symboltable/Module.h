@@ -21,8 +21,10 @@
 
 #include "ConstInt.h"
 #include "Type.h"
+#include "TypeContext.h"
 #include "GlobalVariable.h"
 #include "Function.h"
+#include "Arena.h"
 
 class ScopeStack;
 
@@ -59,6 +61,15 @@ public:
         return name;
     }
 
+    ///
+    /// @brief 获取模块所用的类型上下文，模块内的类型都由它唯一化
+    /// @return TypeContext* 类型上下文
+    ///
+    [[nodiscard]] TypeContext * getTypeContext() const
+    {
+        return typeContext;
+    }
+
     /// @brief 进入作用域，如进入函数体块、语句块等
     void enterScope();
 
@@ -172,9 +183,9 @@ private:
     std::string name;
 
     ///
-    /// @brief 所有的类型，便于内存的释放
+    /// @brief 类型上下文，使用共享的上下文，多个模块并发编译时类型指针仍可直接比较
     ///
-    std::vector<Type *> types;
+    TypeContext * typeContext = &TypeContext::getContext();
 
     /// @brief  变量作用域栈
     ScopeStack * scopeStack;
@@ -196,4 +207,7 @@ private:
 
     /// @brief 常量表
     std::unordered_map<int32_t, ConstInt *> constIntMap;
+
+    /// @brief 内存池，全局变量与常量在其中分配，模块清理时统一释放
+    Arena arena;
 };
\ No newline at end of file
@@ -0,0 +1,35 @@
+int g;
+
+int main()
+{
+    int i, x, q, r, s;
+
+    g = 2147483647;
+    s = 0;
+    i = 0;
+    x = -2147483647 - 1;
+    while (i < 200) {
+        q = x / 2 + x / -4 + x / 8;
+        putint(q);
+        q = x / 7 + x / -10 + x / 641;
+        putint(q);
+        putint(x / -7);
+        putint(x / 1 + (x + 1) / -1);
+        putint(x / (-2147483647 - 1) + x / 2147483647);
+
+        r = x % 2 + x % 8 + x % -4 + x % 7 + x % -7 + x % 10 + x % 641 + x % 1 + (x + 1) % -1;
+        putint(r);
+        putint(x % 1000000007 + g % 1000);
+
+        s = s + q % 1000 + r;
+        i = i + 1;
+        x = (i - 100) * 21474833;
+        if (i % 2 == 1) {
+            x = -x;
+        }
+    }
+
+    putint(s);
+
+    return s % 256;
+}
@@ -0,0 +1,34 @@
+int g;
+int n;
+
+int f()
+{
+    int saved, r;
+
+    saved = g;
+    if (n <= 0) {
+        g = g + 1;
+        return saved;
+    }
+    g = g + n;
+    n = n - 1;
+    r = f();
+    return saved * 100 + r + g;
+}
+
+int main()
+{
+    int i, s;
+
+    s = 0;
+    i = 0;
+    while (i < 5) {
+        g = i;
+        n = i;
+        s = s + f();
+        putint(s);
+        i = i + 1;
+    }
+
+    return s % 256;
+}
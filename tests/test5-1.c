@@ -0,0 +1,49 @@
+int seed;
+
+int next()
+{
+    seed = (seed * 75 + 74) % 65537;
+    return seed;
+}
+
+int main()
+{
+    int a, b, c, t, i, s;
+
+    seed = 7;
+    a = 1;
+    b = 2;
+    c = 3;
+    s = 0;
+    i = 0;
+    while (i < 30) {
+        t = a;
+        a = b;
+        b = c;
+        c = t;
+        if (next() % 2 == 0) {
+            t = a;
+            a = b;
+            b = t;
+        } else {
+            s = s + c;
+        }
+        s = s + a * 100 + b * 10 + c;
+        i = i + 1;
+    }
+    putint(a);
+    putch(32);
+    putint(b);
+    putch(32);
+    putint(c);
+    putch(10);
+
+    a = seed;
+    seed = 3;
+    b = next();
+    putint(a + b + seed);
+    putch(10);
+    putint(s);
+
+    return s % 256;
+}
@@ -0,0 +1,51 @@
+int g;
+
+int main()
+{
+    int a, b, c, d, i, s;
+
+    a = 4;
+    b = a * 3 - 2;
+    c = 0;
+    if (b > 5) {
+        c = b / 2;
+    } else {
+        c = g + 100;
+    }
+    d = c * c - a;
+    putint(d);
+    putch(10);
+
+    s = 0;
+    i = 0;
+    while (i < 10) {
+        if (a == 4) {
+            s = s + c;
+        } else {
+            s = s + g;
+        }
+        if (d < 0) {
+            s = s - 1000;
+        }
+        i = i + 1;
+    }
+    putint(s);
+    putch(10);
+
+    g = 9;
+    a = 1;
+    i = 0;
+    while (i < 5) {
+        a = a + g;
+        i = i + 1;
+    }
+    if (a == 46) {
+        putint(1);
+    } else {
+        putint(0);
+    }
+    putch(10);
+    putint(a + b + c + d);
+
+    return (s + a) % 256;
+}
@@ -0,0 +1,47 @@
+int g;
+int seed;
+
+int next()
+{
+    seed = (seed * 75 + 74) % 65537;
+    return seed;
+}
+
+int bump()
+{
+    g = g + 3;
+    return g;
+}
+
+int main()
+{
+    int x, y, a, b, c, d, i, s;
+
+    seed = 11;
+    g = 5;
+    s = 0;
+    i = 0;
+    while (i < 20) {
+        x = next() % 100;
+        y = next() % 50;
+        a = x * y + g;
+        b = y * x + g;
+        if (x > y) {
+            c = x * y + g;
+        } else {
+            c = x - y;
+        }
+        d = x - y;
+        s = s + a + b + c + d;
+        a = x + g;
+        bump();
+        b = x + g;
+        s = s + b - a;
+        i = i + 1;
+    }
+    putint(s);
+    putch(10);
+    putint(g);
+
+    return s % 256;
+}
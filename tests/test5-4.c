@@ -0,0 +1,52 @@
+int seed;
+
+int next()
+{
+    seed = (seed * 75 + 74) % 65537;
+    return seed;
+}
+
+int main()
+{
+    int x, y, m, n, a, i, s;
+
+    seed = 13;
+    s = 0;
+    i = 0;
+    while (i < 40) {
+        x = next() % 200 - 100;
+        y = next() % 17 - 8;
+        if (x < y) {
+            m = x;
+        } else {
+            m = y;
+        }
+        if (x > y) {
+            n = x;
+        } else {
+            n = y;
+        }
+        if (x < 0) {
+            a = -x;
+        } else {
+            a = x;
+        }
+        s = s + m * 3 + n + a;
+        if (y >= 0) {
+            a = y;
+        } else {
+            a = -y;
+        }
+        s = s + a * 8 - (-(-a));
+        s = s + x * 16 + x / 4 + y / 2 + x / 8 + x % 16 + y * (-1);
+        s = s + (x - (-y)) + (-x + y);
+        if (!x) {
+            s = s + 1;
+        }
+        putint(s);
+        putch(10);
+        i = i + 1;
+    }
+
+    return s % 256;
+}
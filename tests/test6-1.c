@@ -0,0 +1,53 @@
+int g;
+int h;
+int k;
+
+int bump()
+{
+    h = h + 1;
+    return h;
+}
+
+int peek()
+{
+    return g + k;
+}
+
+int main()
+{
+    int i, j, s, a, t;
+
+    g = 5;
+    h = 3;
+    k = 11;
+    a = 7;
+    s = 0;
+    i = 0;
+    while (i < 30) {
+        s = s + g * 3 + a * 7 + h * 5;
+        if (i % 3 == 0) {
+            t = bump();
+            s = s + t;
+        }
+        s = s + peek() * (k + 2);
+        j = 0;
+        while (j < i) {
+            s = s + (g + a) * (k - 1) + j;
+            if (j > 20) {
+                g = g + 1;
+            }
+            s = s + h / 4 + k % 7;
+            j = j + 1;
+        }
+        if (i == 25) {
+            k = bump() + 1;
+        }
+        s = s % 1000003;
+        i = i + 1;
+    }
+    putint(s);
+    putch(10);
+    putint(g + h + k);
+
+    return s % 256;
+}
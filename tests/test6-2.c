@@ -0,0 +1,62 @@
+int g;
+
+int main()
+{
+    int i, j, s, k, t;
+
+    g = 3;
+    k = g + 2;
+    s = 0;
+    i = 0;
+    while (i < 100) {
+        s = s + i * 7 + i * k;
+        i = i + 1;
+    }
+    putint(s);
+    putch(10);
+    putint(i);
+    putch(10);
+
+    i = 50;
+    t = 0;
+    while (i >= 3) {
+        t = t + i * 13;
+        i = i - 4;
+    }
+    putint(t + i);
+    putch(10);
+
+    i = 1;
+    while (i != 61) {
+        j = 0;
+        while (j <= i) {
+            s = s + j * 5 + i * 3;
+            j = j + 2;
+        }
+        s = s % 100000 + j;
+        i = i + 3;
+    }
+    putint(s + i);
+    putch(10);
+
+    i = 2147483600;
+    t = 0;
+    while (i < 2147483640) {
+        t = t + 1;
+        i = i + 10;
+    }
+    putint(t);
+    putch(10);
+    putint(i);
+    putch(10);
+
+    g = 0;
+    i = 0;
+    while (i < 20) {
+        g = g + i * 11;
+        i = i + 1;
+    }
+    putint(g);
+
+    return s % 256;
+}
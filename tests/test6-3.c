@@ -0,0 +1,73 @@
+int n;
+int h;
+
+int f()
+{
+    h = h + 1;
+    return h;
+}
+
+int main()
+{
+    int i, j, s, t, m;
+
+    s = 0;
+    i = 0;
+    while (i < 5) {
+        s = s + i * i;
+        i = i + 1;
+    }
+    putint(s);
+    putch(10);
+
+    t = 0;
+    i = 3;
+    while (i < 64) {
+        t = t * 3 + i;
+        t = t % 10007;
+        i = i + 2;
+    }
+    putint(t + i);
+    putch(10);
+
+    m = 0;
+    while (m < 12) {
+        n = m * 5 + 1;
+        i = 0;
+        t = 0;
+        while (i < n) {
+            t = t + i % 3;
+            i = i + 1;
+        }
+        putint(t);
+        putch(32);
+        m = m + 1;
+    }
+    putch(10);
+
+    n = 0;
+    i = 0;
+    t = 0;
+    while (i < n) {
+        t = t + 1;
+        i = i + 1;
+    }
+    putint(t + i);
+    putch(10);
+
+    i = 0;
+    t = 0;
+    while (i < 10) {
+        j = 0;
+        while (j < 3) {
+            t = t + f() * j;
+            j = j + 1;
+        }
+        i = i + 1;
+    }
+    putint(t);
+    putch(10);
+    putint(h);
+
+    return (s + t) % 256;
+}
@@ -0,0 +1,71 @@
+int n;
+int g;
+
+int touch()
+{
+    g = g + 2;
+    return g;
+}
+
+int main()
+{
+    int i, j, s, t;
+
+    n = 40;
+    s = 0;
+    i = 0;
+    while (i < n) {
+        s = s + i * 3;
+        if (s > 1000) {
+            break;
+        }
+        i = i + 1;
+    }
+    putint(s);
+    putch(32);
+    putint(i);
+    putch(10);
+
+    t = 0;
+    i = 0;
+    while (i < 8) {
+        j = i;
+        while (j < n) {
+            t = t + j;
+            j = j + i + 1;
+        }
+        t = t + j;
+        i = i + 1;
+    }
+    putint(t);
+    putch(32);
+    putint(i);
+    putch(10);
+
+    g = 0;
+    i = 0;
+    while (i < n) {
+        j = 0;
+        while (j < i) {
+            if (touch() % 7 == 0) {
+                break;
+            }
+            j = j + 1;
+        }
+        s = s + j;
+        i = i + 5;
+    }
+    putint(s);
+    putch(32);
+    putint(g);
+    putch(10);
+
+    i = 10;
+    while (i < 5) {
+        s = s + 1;
+        i = i + 1;
+    }
+    putint(s + i);
+
+    return s % 256;
+}
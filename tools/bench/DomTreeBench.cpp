@@ -0,0 +1,210 @@
+///
+/// @file DomTreeBench.cpp
+/// @brief 支配树、后支配树以及支配边界计算的性能测试程序
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+/// 构造含有大量Label的合成函数（顺序块、前向条件跳转、回边形成的循环以及随机跳转），
+/// 统计支配树、后支配树与支配边界的计算时间，每个基本块的平均耗时应基本保持不变。
+/// 规模较小时还会与朴素的位集合迭代算法比对结果。
+///
+/// 用法：dombench [最大Label数，缺省65536]
+///
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "Function.h"
+#include "DominatorTree.h"
+#include "IntegerType.h"
+#include "TypeContext.h"
+#include "ConstInt.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "CondBrInstruction.h"
+
+/// @brief 确定性的伪随机数，保证每次运行生成同样的控制流图
+static uint32_t rngState = 12345;
+
+static uint32_t nextRandom()
+{
+    rngState = rngState * 1103515245u + 12345u;
+    return rngState >> 8;
+}
+
+///
+/// @brief 生成含有n个Label的函数
+/// @param n Label个数
+/// @param cond 条件跳转所用的条件值
+/// @return Function* 函数，已划分基本块
+///
+static Function * genFunction(int32_t n, Value * cond)
+{
+    Function * func = new Function("bench", TypeContext::getContext().getFunctionType(IntegerType::getTypeInt(), {}));
+    InterCode & code = func->getInterCode();
+
+    std::vector<LabelInstruction *> labels;
+    for (int32_t k = 0; k < n; ++k) {
+        labels.push_back(func->newInst<LabelInstruction>());
+    }
+
+    code.addInst(func->newInst<EntryInstruction>());
+    code.addInst(func->newInst<GotoInstruction>(labels[0]));
+
+    for (int32_t k = 0; k < n - 1; ++k) {
+
+        code.addInst(labels[k]);
+
+        LabelInstruction * next = labels[k + 1];
+        LabelInstruction * other;
+
+        switch (nextRandom() % 4) {
+            case 0:
+                // 顺序块
+                code.addInst(func->newInst<GotoInstruction>(next));
+                continue;
+            case 1:
+                // 前向跳过若干块，形成if/if-else
+                other = labels[std::min(n - 1, k + 2 + (int32_t) (nextRandom() % 8))];
+                break;
+            case 2:
+                // 回边，形成循环
+                other = labels[k - (int32_t) (nextRandom() % std::min(k + 1, 16))];
+                break;
+            default:
+                // 任意跳转，形成不规则的控制流
+                other = labels[nextRandom() % n];
+                break;
+        }
+
+        code.addInst(func->newInst<CondBrInstruction>(cond, next, other));
+    }
+
+    code.addInst(labels[n - 1]);
+    code.addInst(func->newInst<ExitInstruction>());
+
+    func->buildCFG();
+
+    return func;
+}
+
+///
+/// @brief 采用位集合的朴素迭代算法检查支配关系
+/// @param func 函数
+/// @param domTree 待检查的支配树
+/// @return true 结果一致
+///
+static bool verify(Function * func, DominatorTree * domTree)
+{
+    std::vector<BasicBlock *> & blocks = func->getBasicBlocks();
+    size_t n = blocks.size();
+
+    // dom[b][a]为真表示a支配b
+    std::vector<std::vector<char>> dom(n, std::vector<char>(n, 1));
+    dom[0].assign(n, 0);
+    dom[0][0] = 1;
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t b = 1; b < n; ++b) {
+            std::vector<char> newDom(n, 1);
+            bool hasPred = false;
+            for (auto pred: blocks[b]->getPredecessors()) {
+                if (!domTree->isReachable(pred)) {
+                    continue;
+                }
+                hasPred = true;
+                for (size_t a = 0; a < n; ++a) {
+                    newDom[a] = newDom[a] && dom[pred->getIndex()][a];
+                }
+            }
+            if (!hasPred) {
+                newDom.assign(n, 0);
+            }
+            newDom[b] = 1;
+            if (newDom != dom[b]) {
+                dom[b] = newDom;
+                changed = true;
+            }
+        }
+    }
+
+    for (size_t b = 0; b < n; ++b) {
+        if (!domTree->isReachable(blocks[b])) {
+            continue;
+        }
+        for (size_t a = 0; a < n; ++a) {
+            if (!domTree->isReachable(blocks[a])) {
+                continue;
+            }
+            if ((bool) dom[b][a] != domTree->dominates(blocks[a], blocks[b])) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char * argv[])
+{
+    int32_t maxLabels = (argc > 1) ? std::atoi(argv[1]) : 65536;
+
+    ConstInt * cond = new ConstInt(1);
+
+    printf("%10s %10s %12s %12s %12s\n", "labels", "blocks", "dom(us)", "postdom(us)", "ns/block");
+
+    for (int32_t n = 1024; n <= maxLabels; n *= 2) {
+
+        Function * func = genFunction(n, cond);
+
+        auto start = std::chrono::steady_clock::now();
+        DominatorTree * domTree = func->getDominatorTree();
+        size_t frontierSize = 0;
+        for (auto bb: func->getBasicBlocks()) {
+            frontierSize += domTree->getDominanceFrontier(bb).size();
+        }
+        auto middle = std::chrono::steady_clock::now();
+        DominatorTree * postDomTree = func->getPostDominatorTree();
+        auto end = std::chrono::steady_clock::now();
+
+        auto domUs = std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count();
+        auto postUs = std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count();
+        size_t blockNum = func->getBasicBlocks().size();
+
+        printf("%10d %10zu %12lld %12lld %12.1f\n",
+               n,
+               blockNum,
+               (long long) domUs,
+               (long long) postUs,
+               (domUs + postUs) * 1000.0 / (double) blockNum);
+
+        if ((n <= 2048) && !verify(func, domTree)) {
+            printf("verify failed at %d labels\n", n);
+            return 1;
+        }
+
+        (void) frontierSize;
+        (void) postDomTree;
+
+        delete func;
+    }
+
+    delete cond;
+
+    return 0;
+}
@@ -0,0 +1,389 @@
+///
+/// @file DivByConstantCheck.cpp
+/// @brief 除以常量的除法与求余改写的正确性检查程序
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+/// 对每个除数构造只含x/d与x%d的函数，执行divconst遍，再按ConstantFold的32位补码语义
+/// 逐条解释改写出的指令序列，与C的/和%比较。C的INT32_MIN/-1未定义，参考值按64位计算后回绕，
+/// 与目标机器一致。除数覆盖2的幂、负数、INT32_MIN、±1与一般的奇偶数，另有按固定种子生成的随机除数。
+/// 使用魔数的除数还直接按computeMagic的魔数与移位位数用64位乘法求商，与C的/比较。
+///
+/// 用法：divcheck [被除数的步长，缺省1即遍历整个int32范围，每个除数需要几分钟]
+/// 步长大于1时只检查等间隔的被除数，以及INT32_MIN、INT32_MAX、0、±1与除数倍数附近的被除数
+///
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Module.h"
+#include "Function.h"
+#include "IntegerType.h"
+#include "ConstInt.h"
+#include "FormalParam.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "BinaryInstruction.h"
+#include "ConstantFold.h"
+#include "DivByConstant.h"
+
+/// @brief 确定性的伪随机数，保证每次运行检查同样的除数
+static uint32_t rngState = 12345;
+
+static uint32_t nextRandom()
+{
+    rngState = rngState * 1103515245u + 12345u;
+    return rngState >> 8;
+}
+
+///
+/// @brief 解释执行的一条二元运算，操作数与结果都是槽位的下标
+///
+struct Step {
+    IRInstOperator op;
+    int32_t lhs;
+    int32_t rhs;
+    int32_t result;
+};
+
+///
+/// @brief 改写后的指令序列，槽位0为被除数，常量预先放在槽位中
+///
+struct Program {
+    std::vector<Step> steps;
+    std::vector<int32_t> slots;
+    int32_t quotient = 0;
+    int32_t remainder = 0;
+
+    /// @brief 除数是否使用魔数，以及computeMagic得到的魔数与移位位数
+    bool usesMagic = false;
+    int32_t magic = 0;
+    int32_t shift = 0;
+};
+
+///
+/// @brief 取值对应的槽位，常量第一次出现时分配槽位并写入值
+/// @param index 值到槽位的映射
+/// @param prog 指令序列
+/// @param val 值
+/// @return int32_t 槽位的下标，-1表示值不是常量也不是前面的运算结果
+///
+static int32_t slotOf(std::unordered_map<Value *, int32_t> & index, Program & prog, Value * val)
+{
+    auto iter = index.find(val);
+    if (iter != index.end()) {
+        return iter->second;
+    }
+
+    auto constVal = dynamic_cast<ConstInt *>(val);
+    if (!constVal) {
+        return -1;
+    }
+
+    int32_t slot = (int32_t) prog.slots.size();
+    prog.slots.push_back(constVal->getVal());
+    index[val] = slot;
+
+    return slot;
+}
+
+///
+/// @brief 构造x/d与x%d的函数，执行divconst遍后转换为解释执行的指令序列
+/// @param module 模块
+/// @param divisor 除数
+/// @param prog 指令序列
+/// @return true 成功，false 改写结果含有不能解释的指令
+///
+static bool buildProgram(Module * module, int32_t divisor, Program & prog)
+{
+    Type * intType = IntegerType::getTypeInt();
+    std::string name = "div" + std::to_string(module->getFunctionList().size());
+    auto param = new FormalParam{intType, "x"};
+    Function * func = module->newFunction(name, intType, {param});
+
+    // 商与余数各由一条加0的运算使用，改写后从它们的操作数取得结果
+    ConstInt * zero = module->newConstInt(0);
+    ConstInt * divisorConst = module->newConstInt(divisor);
+    auto div = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_DIV_I, param, divisorConst, intType);
+    auto mod = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_MOD_I, param, divisorConst, intType);
+    auto divUse = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_ADD_I, div, zero, intType);
+    auto modUse = func->newInst<BinaryInstruction>(IRInstOperator::IRINST_OP_ADD_I, mod, zero, intType);
+
+    InterCode & code = func->getInterCode();
+    code.addInst(func->newInst<EntryInstruction>());
+    code.addInst(div);
+    code.addInst(mod);
+    code.addInst(divUse);
+    code.addInst(modUse);
+    code.addInst(func->newInst<ExitInstruction>());
+    func->buildCFG();
+
+    DivByConstant pass;
+    pass.runOnFunction(func, module);
+
+    std::unordered_map<Value *, int32_t> index;
+    prog.slots.assign(1, 0);
+    index[param] = 0;
+
+    for (auto inst: code.getInsts()) {
+
+        IRInstOperator op = inst->getOp();
+        if (op == IRInstOperator::IRINST_OP_ENTRY || op == IRInstOperator::IRINST_OP_EXIT ||
+            op == IRInstOperator::IRINST_OP_LABEL) {
+            continue;
+        }
+
+        if (!dynamic_cast<BinaryInstruction *>(inst)) {
+            printf("d=%d: unexpected instruction %s\n", divisor, inst->getIRName().c_str());
+            return false;
+        }
+
+        Step step;
+        step.op = op;
+        step.lhs = slotOf(index, prog, inst->getOperand(0));
+        step.rhs = slotOf(index, prog, inst->getOperand(1));
+        if (step.lhs < 0 || step.rhs < 0) {
+            printf("d=%d: operand of %s is not defined before it\n", divisor, inst->getIRName().c_str());
+            return false;
+        }
+
+        step.result = (int32_t) prog.slots.size();
+        prog.slots.push_back(0);
+        index[inst] = step.result;
+        prog.steps.push_back(step);
+    }
+
+    prog.quotient = slotOf(index, prog, divUse->getOperand(0));
+    prog.remainder = slotOf(index, prog, modUse->getOperand(0));
+
+    return true;
+}
+
+///
+/// @brief 解释执行指令序列
+/// @param prog 指令序列，槽位保存本次执行的结果
+/// @param x 被除数
+/// @return true 成功，false 有不能按32位补码语义计算的运算
+///
+static bool run(Program & prog, int32_t x)
+{
+    prog.slots[0] = x;
+
+    for (auto & step: prog.steps) {
+        if (!constantFoldBinary(step.op, prog.slots[step.lhs], prog.slots[step.rhs], prog.slots[step.result])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 不经过改写的指令序列，直接用64位乘法按魔数计算商：x*m/2^(32+s)向下取整，商为负数时加1。
+/// 魔数按无符号数理解时才是真正的乘数，除数为负时乘数取负
+/// @param x 被除数
+/// @param divisor 除数
+/// @param magic computeMagic得到的魔数
+/// @param shift computeMagic得到的移位位数
+/// @return int64_t 商
+///
+static int64_t divideByMagic(int32_t x, int32_t divisor, int32_t magic, int32_t shift)
+{
+    int64_t m = (int64_t) (uint32_t) (divisor < 0 ? (int32_t) (0u - (uint32_t) magic) : magic);
+    if (divisor < 0) {
+        m = -m;
+    }
+
+    // |x*m| < 2^63，不会溢出；向下取整的除法不依赖负数右移的实现
+    int64_t product = (int64_t) x * m;
+    int64_t divisorPow = (int64_t) 1 << (32 + shift);
+    int64_t quotient = product / divisorPow;
+    if (product % divisorPow != 0 && product < 0) {
+        quotient--;
+    }
+
+    return quotient < 0 ? quotient + 1 : quotient;
+}
+
+///
+/// @brief 检查一个被除数，不一致时输出
+/// @param prog 指令序列
+/// @param divisor 除数
+/// @param x 被除数
+/// @return true 与C的/和%一致
+///
+static bool checkOne(Program & prog, int32_t divisor, int32_t x)
+{
+    // 64位下不会溢出，INT32_MIN/-1回绕为INT32_MIN，与目标机器的sdiv一致
+    auto quotient = (int32_t) (uint32_t) ((int64_t) x / divisor);
+    auto remainder = (int32_t) ((int64_t) x % divisor);
+
+    if (prog.usesMagic && divideByMagic(x, divisor, prog.magic, prog.shift) != quotient) {
+        printf("d=%d x=%d: magic %d shift %d gives %lld, expected %d\n",
+               divisor,
+               x,
+               prog.magic,
+               prog.shift,
+               (long long) divideByMagic(x, divisor, prog.magic, prog.shift),
+               quotient);
+        return false;
+    }
+
+    if (!run(prog, x)) {
+        printf("d=%d x=%d: sequence cannot be evaluated\n", divisor, x);
+        return false;
+    }
+
+    if (prog.slots[prog.quotient] != quotient || prog.slots[prog.remainder] != remainder) {
+        printf("d=%d x=%d: got %d %d, expected %d %d\n",
+               divisor,
+               x,
+               prog.slots[prog.quotient],
+               prog.slots[prog.remainder],
+               quotient,
+               remainder);
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 判断是否需要检查魔数，2的幂、±1与INT32_MIN不使用魔数
+/// @param divisor 除数
+/// @return true 使用魔数
+///
+static bool usesMagic(int32_t divisor)
+{
+    uint32_t ad = divisor < 0 ? 0u - (uint32_t) divisor : (uint32_t) divisor;
+    return ad > 1 && (ad & (ad - 1)) != 0;
+}
+
+///
+/// @brief 检查一个除数
+/// @param module 模块
+/// @param divisor 除数，不为0
+/// @param step 被除数的步长
+/// @return int64_t 不一致的被除数个数
+///
+static int64_t checkDivisor(Module * module, int32_t divisor, int64_t step)
+{
+    const int64_t intMin = std::numeric_limits<int32_t>::min();
+    const int64_t intMax = std::numeric_limits<int32_t>::max();
+
+    Program prog;
+    if (!buildProgram(module, divisor, prog)) {
+        return 1;
+    }
+
+    prog.usesMagic = usesMagic(divisor);
+    if (prog.usesMagic) {
+        DivByConstant::computeMagic(divisor, prog.magic, prog.shift);
+    }
+
+    int64_t errors = 0;
+    for (int64_t x = intMin; x <= intMax && errors < 10; x += step) {
+        errors += checkOne(prog, divisor, (int32_t) x) ? 0 : 1;
+    }
+
+    // 边界与除数倍数附近的被除数，商在这些位置变化
+    int64_t ad = divisor < 0 ? -(int64_t) divisor : divisor;
+    std::vector<int64_t> edges = {intMin, intMin + 1, -ad - 1, -ad, -ad + 1, -1, 0, 1, ad - 1, ad, ad + 1, intMax};
+    for (int64_t k = 1; k <= 3; ++k) {
+        edges.push_back(intMin / ad * ad + k - 2);
+        edges.push_back(intMax / ad * ad + k - 2);
+    }
+
+    for (auto x: edges) {
+        if (x >= intMin && x <= intMax && !checkOne(prog, divisor, (int32_t) x)) {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+int main(int argc, char * argv[])
+{
+    int64_t step = (argc > 1) ? std::atoll(argv[1]) : 1;
+    if (step < 1) {
+        step = 1;
+    }
+
+    const int32_t intMin = std::numeric_limits<int32_t>::min();
+    const int32_t intMax = std::numeric_limits<int32_t>::max();
+
+    std::vector<int32_t> divisors = {
+        // 2的幂，含负数与绝对值最大的2^30
+        2,
+        4,
+        8,
+        1 << 16,
+        1 << 30,
+        -2,
+        -8,
+        -(1 << 30),
+        intMin,
+        // ±1
+        1,
+        -1,
+        // 魔数不超过int32的范围与超过范围的除数，含负数
+        3,
+        5,
+        6,
+        7,
+        10,
+        641,
+        1000000007,
+        intMax,
+        -3,
+        -5,
+        -7,
+        -10,
+        -641,
+        intMin + 1,
+    };
+
+    // 步长较大时另外检查随机的除数
+    if (step > 1) {
+        for (int32_t k = 0; k < 200; ++k) {
+            auto divisor = (int32_t) (nextRandom() << 8 ^ nextRandom());
+            divisors.push_back(k % 2 ? divisor : divisor % 1000);
+        }
+    }
+
+    Module module("divcheck");
+
+    int64_t errors = 0;
+    for (auto divisor: divisors) {
+
+        if (divisor == 0) {
+            continue;
+        }
+
+        int64_t divisorErrors = checkDivisor(&module, divisor, step);
+        if (step == 1) {
+            printf("d=%d: %s\n", divisor, divisorErrors ? "FAILED" : "ok");
+            fflush(stdout);
+        }
+
+        errors += divisorErrors;
+    }
+
+    printf("%zu divisors, step %lld: %lld mismatches\n", divisors.size(), (long long) step, (long long) errors);
+
+    return errors ? 1 : 0;
+}
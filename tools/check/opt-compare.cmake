@@ -0,0 +1,61 @@
+#
+# @file opt-compare.cmake
+# @brief 优化正确性检查：同一个测试程序分别按-O0与-O2编译成ARM32程序，用qemu运行后比较输出与返回值
+# @author zenglj (zenglj@live.com)
+# @version 1.0
+# @date 2026-10-18
+#
+# @copyright Copyright (c) 2024
+#
+# 用法：cmake -DMINIC=... -DARM32_GCC=... -DARM32_QEMU=... -DSOURCE=... -DWORK_DIR=... -P opt-compare.cmake
+#   MINIC       minic编译器
+#   ARM32_GCC   ARM32交叉编译器，汇编并链接tests/std.c
+#   ARM32_QEMU  运行ARM32程序的qemu
+#   SOURCE      测试程序，同目录下需要有std.h与std.c
+#   WORK_DIR    中间文件的输出目录
+#
+
+foreach(var MINIC ARM32_GCC ARM32_QEMU SOURCE WORK_DIR)
+	if(NOT DEFINED ${var})
+		message(FATAL_ERROR "${var} is not set")
+	endif()
+endforeach()
+
+get_filename_component(CASE_NAME ${SOURCE} NAME_WE)
+get_filename_component(STD_DIR ${SOURCE} DIRECTORY)
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+foreach(level 0 2)
+	set(asm_file ${WORK_DIR}/${CASE_NAME}-O${level}.s)
+	set(exe_file ${WORK_DIR}/${CASE_NAME}-O${level})
+
+	execute_process(
+		COMMAND ${MINIC} -S -O ${level} -o ${asm_file} ${SOURCE}
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${CASE_NAME}: minic -O${level} failed")
+	endif()
+
+	execute_process(
+		COMMAND ${ARM32_GCC} -g -static --include ${STD_DIR}/std.h -o ${exe_file} ${asm_file} ${STD_DIR}/std.c
+		RESULT_VARIABLE result
+	)
+	if(NOT result EQUAL 0)
+		message(FATAL_ERROR "${CASE_NAME}: assembling -O${level} output failed")
+	endif()
+
+	# 返回值也是程序输出的一部分
+	execute_process(
+		COMMAND ${ARM32_QEMU} ${exe_file}
+		OUTPUT_VARIABLE output
+		RESULT_VARIABLE result
+	)
+	set(output_O${level} "${output}\nreturn ${result}\n")
+endforeach()
+
+if(NOT output_O0 STREQUAL output_O2)
+	message(FATAL_ERROR "${CASE_NAME}: -O2 output differs from -O0\n-O0:\n${output_O0}\n-O2:\n${output_O2}")
+endif()
+
+message(STATUS "${CASE_NAME}: -O0 and -O2 agree")
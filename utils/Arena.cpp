@@ -0,0 +1,86 @@
+///
+/// @file Arena.cpp
+/// @brief 内存池，按块顺序分配，统一释放
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <cstdint>
+#include <cstdlib>
+
+#include "Arena.h"
+
+///
+/// @brief 构造函数
+/// @param _slabSize 每次向系统申请的内存块大小
+///
+Arena::Arena(size_t _slabSize) : slabSize(_slabSize)
+{}
+
+///
+/// @brief 析构函数，释放所有对象与内存
+///
+Arena::~Arena()
+{
+    release();
+}
+
+///
+/// @brief 分配指定大小与对齐的空间
+/// @param size 大小
+/// @param align 对齐，必须是2的幂
+/// @return void* 空间的首地址
+///
+void * Arena::allocate(size_t size, size_t align)
+{
+    uintptr_t pos = ((uintptr_t) cur + align - 1) & ~(uintptr_t) (align - 1);
+
+    if (!cur || pos + size > (uintptr_t) end) {
+
+        // 当前内存块不够，申请新的内存块，超大的对象单独占用一块
+        size_t newSize = size + align > slabSize ? size + align : slabSize;
+
+        char * slab = static_cast<char *>(std::malloc(newSize));
+        if (!slab) {
+            throw std::bad_alloc();
+        }
+
+        slabs.push_back(slab);
+        cur = slab;
+        end = slab + newSize;
+
+        pos = ((uintptr_t) cur + align - 1) & ~(uintptr_t) (align - 1);
+    }
+
+    cur = (char *) (pos + size);
+
+    return (void *) pos;
+}
+
+///
+/// @brief 析构所有对象，释放所有内存块
+///
+void Arena::release()
+{
+    // 后创建的先析构
+    for (auto iter = destructors.rbegin(); iter != destructors.rend(); ++iter) {
+        iter->destroy(iter->obj);
+    }
+    destructors.clear();
+
+    for (auto slab: slabs) {
+        std::free(slab);
+    }
+    slabs.clear();
+
+    cur = nullptr;
+    end = nullptr;
+}
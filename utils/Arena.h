@@ -0,0 +1,123 @@
+///
+/// @file Arena.h
+/// @brief 内存池，按块顺序分配，统一释放
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///
+/// @brief 内存池。从大块内存中顺序切分空间，不支持单个对象的释放，
+/// 在release时统一调用对象的析构函数并释放所有内存块。
+/// 析构函数平凡的对象（如Use）不记录析构，释放时没有逐个对象的开销；
+/// 其余对象（如含有操作数列表的指令、变量）每个记录一次析构，release的代价与这些对象的个数成正比，
+/// 节省的是逐个对象的内存释放，而不是析构函数的调用。
+///
+class Arena {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _slabSize 每次向系统申请的内存块大小
+    ///
+    explicit Arena(size_t _slabSize = 64 * 1024);
+
+    ///
+    /// @brief 析构函数，释放所有对象与内存
+    ///
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    ///
+    /// @brief 分配指定大小与对齐的空间
+    /// @param size 大小
+    /// @param align 对齐，必须是2的幂
+    /// @return void* 空间的首地址
+    ///
+    void * allocate(size_t size, size_t align);
+
+    ///
+    /// @brief 在内存池中创建对象，对象在release时析构
+    /// @tparam T 对象类型
+    /// @param args 构造函数的参数
+    /// @return T* 对象
+    ///
+    template <typename T, typename... Args>
+    T * create(Args &&... args)
+    {
+        return track(new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...));
+    }
+
+    ///
+    /// @brief 登记在内存池空间上构造的对象，使其在release时析构。
+    /// 用于构造函数非公开、只能由友元类自行构造的对象
+    /// @tparam T 对象类型
+    /// @param obj 在allocate返回的空间上构造的对象
+    /// @return T* 对象
+    ///
+    template <typename T>
+    T * track(T * obj)
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            destructors.push_back({obj, [](void * p) { static_cast<T *>(p)->~T(); }});
+        }
+
+        return obj;
+    }
+
+    ///
+    /// @brief 析构所有对象，释放所有内存块
+    ///
+    void release();
+
+private:
+    ///
+    /// @brief 需要析构的对象以及析构函数
+    ///
+    struct Destructor {
+        void * obj;
+        void (*destroy)(void *);
+    };
+
+    ///
+    /// @brief 每次申请的内存块大小
+    ///
+    size_t slabSize;
+
+    ///
+    /// @brief 申请的内存块
+    ///
+    std::vector<char *> slabs;
+
+    ///
+    /// @brief 当前内存块中可分配的位置
+    ///
+    char * cur = nullptr;
+
+    ///
+    /// @brief 当前内存块的结束位置
+    ///
+    char * end = nullptr;
+
+    ///
+    /// @brief 按创建次序记录的析构
+    ///
+    std::vector<Destructor> destructors;
+};
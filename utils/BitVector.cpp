@@ -0,0 +1,326 @@
+///
+/// @file BitVector.cpp
+/// @brief 按64位字存储的位向量，用于数据流分析等稠密集合运算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include "BitVector.h"
+
+/// @brief 每个字的位数
+static const int32_t WORD_BITS = 64;
+
+///
+/// @brief 求最低的置位位的序号
+/// @param word 非0的字
+/// @return int32_t 序号
+///
+static int32_t lowestBit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int32_t n = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+///
+/// @brief 统计字中置位的个数
+/// @param word 字
+/// @return int32_t 个数
+///
+static int32_t popCount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int32_t n = 0;
+    while (word) {
+        word &= word - 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+///
+/// @brief 构造函数
+/// @param _size 位数
+/// @param val 所有位的初值
+///
+BitVector::BitVector(int32_t _size, bool val)
+{
+    resize(_size, val);
+}
+
+///
+/// @brief 调整位数，新增的位设置为val
+/// @param _size 位数
+/// @param val 新增位的值
+///
+void BitVector::resize(int32_t _size, bool val)
+{
+    int32_t oldNum = bitNum;
+
+    bitNum = _size;
+    words.resize((size_t) (_size + WORD_BITS - 1) / WORD_BITS, val ? ~(uint64_t) 0 : 0);
+
+    // 原来最后一个字中未使用的位也属于新增的位
+    if (val && oldNum < _size && oldNum % WORD_BITS) {
+        words[oldNum / WORD_BITS] |= ~(uint64_t) 0 << (oldNum % WORD_BITS);
+    }
+
+    clearUnusedBits();
+}
+
+///
+/// @brief 获取位数
+/// @return int32_t 位数
+///
+int32_t BitVector::size() const
+{
+    return bitNum;
+}
+
+///
+/// @brief 置位
+/// @param n 指定位
+///
+void BitVector::set(int32_t n)
+{
+    words[n / WORD_BITS] |= (uint64_t) 1 << (n % WORD_BITS);
+}
+
+///
+/// @brief 复位
+/// @param n 指定位
+///
+void BitVector::reset(int32_t n)
+{
+    words[n / WORD_BITS] &= ~((uint64_t) 1 << (n % WORD_BITS));
+}
+
+///
+/// @brief 获取指定位的值
+/// @param n 指定位
+/// @return true 置位
+///
+bool BitVector::test(int32_t n) const
+{
+    return (words[n / WORD_BITS] >> (n % WORD_BITS)) & 1;
+}
+
+///
+/// @brief 所有位置位
+///
+void BitVector::setAll()
+{
+    for (auto & word: words) {
+        word = ~(uint64_t) 0;
+    }
+
+    clearUnusedBits();
+}
+
+///
+/// @brief 所有位复位，位数不变
+///
+void BitVector::clear()
+{
+    for (auto & word: words) {
+        word = 0;
+    }
+}
+
+///
+/// @brief 是否有置位的位
+/// @return true 非空
+///
+bool BitVector::any() const
+{
+    for (auto word: words) {
+        if (word) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief 统计置位的个数
+/// @return int32_t 个数
+///
+int32_t BitVector::count() const
+{
+    int32_t num = 0;
+    for (auto word: words) {
+        num += popCount(word);
+    }
+
+    return num;
+}
+
+///
+/// @brief 并集运算，结果保存在自身，两者位数必须相同
+/// @param other 另一个位向量
+/// @return true 自身发生了变化
+///
+bool BitVector::unionWith(const BitVector & other)
+{
+    uint64_t changed = 0;
+
+    for (size_t k = 0; k < words.size(); ++k) {
+        uint64_t word = words[k] | other.words[k];
+        changed |= word ^ words[k];
+        words[k] = word;
+    }
+
+    return changed != 0;
+}
+
+///
+/// @brief 交集运算，结果保存在自身，两者位数必须相同
+/// @param other 另一个位向量
+/// @return true 自身发生了变化
+///
+bool BitVector::intersectWith(const BitVector & other)
+{
+    uint64_t changed = 0;
+
+    for (size_t k = 0; k < words.size(); ++k) {
+        uint64_t word = words[k] & other.words[k];
+        changed |= word ^ words[k];
+        words[k] = word;
+    }
+
+    return changed != 0;
+}
+
+///
+/// @brief 差集运算，即去掉other中置位的位，两者位数必须相同
+/// @param other 另一个位向量
+/// @return true 自身发生了变化
+///
+bool BitVector::subtract(const BitVector & other)
+{
+    uint64_t changed = 0;
+
+    for (size_t k = 0; k < words.size(); ++k) {
+        uint64_t word = words[k] & ~other.words[k];
+        changed |= word ^ words[k];
+        words[k] = word;
+    }
+
+    return changed != 0;
+}
+
+///
+/// @brief 查找第一个置位的位
+/// @return int32_t 位号，没有时为-1
+///
+int32_t BitVector::findFirst() const
+{
+    if (words.empty()) {
+        return -1;
+    }
+
+    return findFrom(0, words[0]);
+}
+
+///
+/// @brief 查找prev之后的第一个置位的位，
+/// 可按 for (n = bv.findFirst(); n != -1; n = bv.findNext(n)) 遍历
+/// @param prev 起始位，不含
+/// @return int32_t 位号，没有时为-1
+///
+int32_t BitVector::findNext(int32_t prev) const
+{
+    int32_t n = prev + 1;
+    if (n >= bitNum) {
+        return -1;
+    }
+
+    // 屏蔽掉n之前的位
+    size_t wordNo = (size_t) n / WORD_BITS;
+    return findFrom(wordNo, words[wordNo] & (~(uint64_t) 0 << (n % WORD_BITS)));
+}
+
+///
+/// @brief 查找从字wordNo开始的第一个置位的位
+/// @param wordNo 字的序号
+/// @param word 该字中还需要查找的位
+/// @return int32_t 位号，没有时为-1
+///
+int32_t BitVector::findFrom(size_t wordNo, uint64_t word) const
+{
+    while (!word) {
+        if (++wordNo >= words.size()) {
+            return -1;
+        }
+        word = words[wordNo];
+    }
+
+    return (int32_t) wordNo * WORD_BITS + lowestBit(word);
+}
+
+///
+/// @brief 比较运算（等于）
+/// @param other 另一个位向量
+/// @return true 位数与内容都相同
+///
+bool BitVector::operator==(const BitVector & other) const
+{
+    return bitNum == other.bitNum && words == other.words;
+}
+
+///
+/// @brief 比较运算（不等于）
+/// @param other 另一个位向量
+/// @return true 位数或内容不同
+///
+bool BitVector::operator!=(const BitVector & other) const
+{
+    return !(*this == other);
+}
+
+///
+/// @brief 变换成字符串显示，如{1,3,5}
+/// @return std::string 字符串
+///
+std::string BitVector::toString() const
+{
+    std::string str = "{";
+
+    for (int32_t n = findFirst(); n != -1; n = findNext(n)) {
+        if (str.size() > 1) {
+            str += ",";
+        }
+        str += std::to_string(n);
+    }
+
+    return str + "}";
+}
+
+///
+/// @brief 清除最后一个字中超出位数的位
+///
+void BitVector::clearUnusedBits()
+{
+    if (bitNum % WORD_BITS) {
+        words.back() &= ~(~(uint64_t) 0 << (bitNum % WORD_BITS));
+    }
+}
@@ -0,0 +1,174 @@
+///
+/// @file BitVector.h
+/// @brief 按64位字存储的位向量，用于数据流分析等稠密集合运算
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///
+/// @brief 位向量。元素为[0, size)内的整数，按64位字存储，
+/// 集合运算逐字进行，循环体简单无分支，编译器可自动向量化。
+/// 最后一个字中超出size的位始终为0，因此计数、比较等可直接按字进行
+///
+class BitVector {
+
+public:
+    ///
+    /// @brief 构造空的位向量
+    ///
+    BitVector() = default;
+
+    ///
+    /// @brief 构造函数
+    /// @param _size 位数
+    /// @param val 所有位的初值
+    ///
+    explicit BitVector(int32_t _size, bool val = false);
+
+    ///
+    /// @brief 调整位数，新增的位设置为val
+    /// @param _size 位数
+    /// @param val 新增位的值
+    ///
+    void resize(int32_t _size, bool val = false);
+
+    ///
+    /// @brief 获取位数
+    /// @return int32_t 位数
+    ///
+    int32_t size() const;
+
+    ///
+    /// @brief 置位
+    /// @param n 指定位
+    ///
+    void set(int32_t n);
+
+    ///
+    /// @brief 复位
+    /// @param n 指定位
+    ///
+    void reset(int32_t n);
+
+    ///
+    /// @brief 获取指定位的值
+    /// @param n 指定位
+    /// @return true 置位
+    ///
+    bool test(int32_t n) const;
+
+    ///
+    /// @brief 所有位置位
+    ///
+    void setAll();
+
+    ///
+    /// @brief 所有位复位，位数不变
+    ///
+    void clear();
+
+    ///
+    /// @brief 是否有置位的位
+    /// @return true 非空
+    ///
+    bool any() const;
+
+    ///
+    /// @brief 统计置位的个数
+    /// @return int32_t 个数
+    ///
+    int32_t count() const;
+
+    ///
+    /// @brief 并集运算，结果保存在自身，两者位数必须相同
+    /// @param other 另一个位向量
+    /// @return true 自身发生了变化
+    ///
+    bool unionWith(const BitVector & other);
+
+    ///
+    /// @brief 交集运算，结果保存在自身，两者位数必须相同
+    /// @param other 另一个位向量
+    /// @return true 自身发生了变化
+    ///
+    bool intersectWith(const BitVector & other);
+
+    ///
+    /// @brief 差集运算，即去掉other中置位的位，两者位数必须相同
+    /// @param other 另一个位向量
+    /// @return true 自身发生了变化
+    ///
+    bool subtract(const BitVector & other);
+
+    ///
+    /// @brief 查找第一个置位的位
+    /// @return int32_t 位号，没有时为-1
+    ///
+    int32_t findFirst() const;
+
+    ///
+    /// @brief 查找prev之后的第一个置位的位，
+    /// 可按 for (n = bv.findFirst(); n != -1; n = bv.findNext(n)) 遍历
+    /// @param prev 起始位，不含
+    /// @return int32_t 位号，没有时为-1
+    ///
+    int32_t findNext(int32_t prev) const;
+
+    ///
+    /// @brief 比较运算（等于）
+    /// @param other 另一个位向量
+    /// @return true 位数与内容都相同
+    ///
+    bool operator==(const BitVector & other) const;
+
+    ///
+    /// @brief 比较运算（不等于）
+    /// @param other 另一个位向量
+    /// @return true 位数或内容不同
+    ///
+    bool operator!=(const BitVector & other) const;
+
+    ///
+    /// @brief 变换成字符串显示，如{1,3,5}
+    /// @return std::string 字符串
+    ///
+    std::string toString() const;
+
+private:
+    ///
+    /// @brief 查找从字wordNo开始的第一个置位的位
+    /// @param wordNo 字的序号
+    /// @param word 该字中还需要查找的位
+    /// @return int32_t 位号，没有时为-1
+    ///
+    int32_t findFrom(size_t wordNo, uint64_t word) const;
+
+    ///
+    /// @brief 清除最后一个字中超出位数的位
+    ///
+    void clearUnusedBits();
+
+    ///
+    /// @brief 按字存储的位
+    ///
+    std::vector<uint64_t> words;
+
+    ///
+    /// @brief 位数
+    ///
+    int32_t bitNum = 0;
+};
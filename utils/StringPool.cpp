@@ -0,0 +1,49 @@
+///
+/// @file StringPool.cpp
+/// @brief 字符串驻留池，相同内容的字符串只保存一份
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <mutex>
+#include <unordered_set>
+
+#include "StringPool.h"
+
+///
+/// @brief 驻留字符串
+/// @param str 字符串
+/// @return const std::string* 池中的字符串，空串返回nullptr
+///
+const std::string * StringPool::intern(const std::string & str)
+{
+    // 基于结点的集合，插入新元素不会使已有元素的地址失效
+    static std::unordered_set<std::string> pool;
+    static std::mutex poolMutex;
+
+    if (str.empty()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+
+    return &*pool.insert(str).first;
+}
+
+///
+/// @brief 获取空串，用于没有名字的值
+/// @return const std::string& 空串
+///
+const std::string & StringPool::empty()
+{
+    static const std::string emptyStr;
+    return emptyStr;
+}
@@ -0,0 +1,39 @@
+///
+/// @file StringPool.h
+/// @brief 字符串驻留池，相同内容的字符串只保存一份
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-18
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-18 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <string>
+
+///
+/// @brief 字符串驻留池。源程序中的变量名、函数名等驻留后以指针保存，
+/// 同名的值共享同一份字符串，指针在程序运行期间一直有效，相等的字符串其指针也相等
+///
+class StringPool {
+
+public:
+    ///
+    /// @brief 驻留字符串
+    /// @param str 字符串
+    /// @return const std::string* 池中的字符串，空串返回nullptr
+    ///
+    static const std::string * intern(const std::string & str);
+
+    ///
+    /// @brief 获取空串，用于没有名字的值
+    /// @return const std::string& 空串
+    ///
+    static const std::string & empty();
+};